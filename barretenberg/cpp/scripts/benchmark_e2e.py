@@ -0,0 +1,267 @@
+#!/usr/bin/env python3
+"""End-to-end proving benchmarks: run a fixed corpus through every proving system and compare results.
+
+Run (from barretenberg/cpp, after building e.g. `cmake --preset op-count-time && cmake --build --preset op-count-time
+--target e2e_bench client_ivc_bench bb`):
+
+    scripts/benchmark_e2e.py run --build-dir build-op-count-time -o results.json [--acir-dir <dir>]
+
+Every benchmark runs in its own process, --repetitions times. For each one we record the samples of wall time, CPU time
+and peak RSS, plus the median op count breakdown (BB_OP_COUNT labels). The corpus is:
+  - e2e_bench: mock circuits proven with UltraPlonk, UltraHonk and GoblinUltraHonk, mock function circuits and AVM traces
+  - client_ivc_bench: the full client IVC with mock kernels
+  - ACIR programs (optional): every <program>/target/{acir,witness}.gz under --acir-dir, proven with bb
+
+Compare two result files; exits with status 1 if any metric regressed significantly, so it can gate CI:
+
+    scripts/benchmark_e2e.py compare baseline.json results.json [--alpha 0.05] [--threshold 0.05]
+
+A metric regresses if its mean grew by more than --threshold (relative) and Welch's t-test rejects equal means at
+significance level --alpha.
+"""
+import argparse
+import json
+import math
+import os
+import platform
+import statistics
+import subprocess
+import sys
+import tempfile
+import time
+from pathlib import Path
+
+METRICS = ["real_time_ns", "cpu_time_ns", "peak_rss_bytes"]
+
+# Benchmark binaries of the corpus and the filter selecting which of their benchmarks to run
+BENCH_CORPUS = [
+    ("e2e_bench", "."),
+    ("client_ivc_bench", "ClientIVCBench/Full/6$"),
+]
+
+# bb commands used to prove ACIR programs, keyed by proving system
+ACIR_SYSTEMS = {
+    "ultra_plonk": "prove",
+    "ultra_honk": "prove_ultra_honk",
+    "goblin_ultra_honk": "prove_goblin_ultra_honk",
+}
+
+# Fields of a Google Benchmark run that are not op counts
+NON_COUNTER_FIELDS = {
+    "name", "family_index", "per_family_instance_index", "run_name", "run_type", "repetitions", "repetition_index",
+    "threads", "iterations", "real_time", "cpu_time", "time_unit", "peak_rss_bytes", "aggregate_name",
+    "aggregate_unit", "label", "error_occurred", "error_message"
+}
+
+TIME_UNIT_NS = {"ns": 1, "us": 1e3, "ms": 1e6, "s": 1e9}
+
+
+def new_entry():
+    return {metric: [] for metric in METRICS} | {"op_counts": {}}
+
+
+def finalize_op_counts(entry, op_count_samples):
+    # Keep the median of each label over the repetitions
+    entry["op_counts"] = {label: statistics.median(values) for label, values in sorted(op_count_samples.items())}
+
+
+def run_bench_binary(binary, benchmark_filter, repetitions):
+    """Run each benchmark of a binary in its own process, so that peak RSS is per benchmark."""
+    listed = subprocess.run([binary, f"--benchmark_filter={benchmark_filter}", "--benchmark_list_tests"],
+                            check=True, capture_output=True, text=True).stdout.split()
+    results = {}
+    for name in listed:
+        entry = new_entry()
+        op_count_samples = {}
+        for _ in range(repetitions):
+            # Escape regex metacharacters of names like prove<UltraProver>/ultra_honk_sha256/10
+            pattern = "^" + "".join("\\" + c if c in "^$.|?*+()[]{}\\" else c for c in name) + "$"
+            output = subprocess.run([binary, f"--benchmark_filter={pattern}", "--benchmark_format=json"],
+                                    check=True, capture_output=True, text=True).stdout
+            run = json.loads(output)["benchmarks"][0]
+            scale = TIME_UNIT_NS[run.get("time_unit", "ns")]
+            entry["real_time_ns"].append(run["real_time"] * scale)
+            entry["cpu_time_ns"].append(run["cpu_time"] * scale)
+            entry["peak_rss_bytes"].append(run.get("peak_rss_bytes", 0))
+            for key, value in run.items():
+                if key not in NON_COUNTER_FIELDS and isinstance(value, (int, float)):
+                    op_count_samples.setdefault(key, []).append(value)
+        finalize_op_counts(entry, op_count_samples)
+        results[f"{Path(binary).name}/{name}"] = entry
+        print(f"{Path(binary).name}/{name}: {statistics.median(entry['real_time_ns']) / 1e6:.1f}ms", file=sys.stderr)
+    return results
+
+
+def run_acir_programs(bb, acir_dir, crs_dir, repetitions):
+    results = {}
+    for acir in sorted(Path(acir_dir).glob("*/target/acir.gz")):
+        program = acir.parent.parent.name
+        witness = acir.parent / "witness.gz"
+        for system, command in ACIR_SYSTEMS.items():
+            entry = new_entry()
+            op_count_samples = {}
+            for _ in range(repetitions):
+                with tempfile.TemporaryDirectory() as tmp:
+                    profile = Path(tmp) / "op_profile.json"
+                    args = [bb, command, "-b", str(acir), "-w", str(witness), "-o", str(Path(tmp) / "proof"),
+                            "--op-profile", str(profile)]
+                    if crs_dir:
+                        args += ["-c", crs_dir]
+                    start = time.perf_counter()
+                    process = subprocess.Popen(args, stdout=subprocess.DEVNULL)
+                    _, status, usage = os.wait4(process.pid, 0)
+                    elapsed = time.perf_counter() - start
+                    if status != 0:
+                        raise RuntimeError(f"{' '.join(args)} failed with status {status}")
+                    entry["real_time_ns"].append(elapsed * 1e9)
+                    entry["cpu_time_ns"].append((usage.ru_utime + usage.ru_stime) * 1e9)
+                    entry["peak_rss_bytes"].append(usage.ru_maxrss * 1024)  # KiB on Linux
+                    if profile.exists():
+                        for label, stats in json.loads(profile.read_text()).items():
+                            for field, value in stats.items():
+                                if value:
+                                    op_count_samples.setdefault(f"{label}({field})", []).append(value)
+            finalize_op_counts(entry, op_count_samples)
+            results[f"acir/{program}/{system}"] = entry
+            print(f"acir/{program}/{system}: {statistics.median(entry['real_time_ns']) / 1e6:.1f}ms", file=sys.stderr)
+    return results
+
+
+def git_commit():
+    try:
+        return subprocess.run(["git", "rev-parse", "HEAD"], check=True, capture_output=True, text=True).stdout.strip()
+    except (OSError, subprocess.CalledProcessError):
+        return None
+
+
+def run(args):
+    bin_dir = Path(args.build_dir) / "bin"
+    benchmarks = {}
+    for binary, benchmark_filter in BENCH_CORPUS:
+        if not (bin_dir / binary).exists():
+            print(f"warning: {bin_dir / binary} not built, skipping", file=sys.stderr)
+            continue
+        # Benchmarks resolve the CRS relative to the build directory
+        cwd = os.getcwd()
+        os.chdir(args.build_dir)
+        try:
+            benchmarks |= run_bench_binary(str(Path("bin") / binary), benchmark_filter, args.repetitions)
+        finally:
+            os.chdir(cwd)
+    if args.acir_dir:
+        benchmarks |= run_acir_programs(str(bin_dir / "bb"), args.acir_dir, args.crs_dir, args.repetitions)
+
+    result = {
+        "context": {
+            "date": time.strftime("%Y-%m-%dT%H:%M:%S%z"),
+            "host": platform.node(),
+            "machine": platform.machine(),
+            "num_cpus": os.cpu_count(),
+            "git_commit": git_commit(),
+            "build_dir": str(args.build_dir),
+            "repetitions": args.repetitions,
+        },
+        "benchmarks": benchmarks,
+    }
+    with open(args.output, "w") as file:
+        json.dump(result, file, indent=2)
+
+
+def betainc(a, b, x):
+    """Regularized incomplete beta function I_x(a, b), by continued fraction (Numerical Recipes, betacf)."""
+    if x <= 0 or x >= 1:
+        return 0.0 if x <= 0 else 1.0
+    if x > (a + 1) / (a + b + 2):
+        return 1.0 - betainc(b, a, 1.0 - x)
+    front = math.exp(math.lgamma(a + b) - math.lgamma(a) - math.lgamma(b) + a * math.log(x) + b * math.log(1 - x)) / a
+    tiny = 1e-300
+    c, d = 1.0, 1.0 - (a + b) * x / (a + 1)
+    d = 1.0 / (d if abs(d) > tiny else tiny)
+    result = d
+    for m in range(1, 300):
+        for numerator in (m * (b - m) * x / ((a + 2 * m - 1) * (a + 2 * m)),
+                          -(a + m) * (a + b + m) * x / ((a + 2 * m) * (a + 2 * m + 1))):
+            d = 1.0 + numerator * d
+            d = 1.0 / (d if abs(d) > tiny else tiny)
+            c = 1.0 + numerator / c
+            c = c if abs(c) > tiny else tiny
+            result *= c * d
+        if abs(c * d - 1.0) < 1e-12:
+            break
+    return front * result
+
+
+def welch_t_test(baseline, candidate):
+    """Two-sided p-value of Welch's t-test for equal means."""
+    n_0, n_1 = len(baseline), len(candidate)
+    if n_0 < 2 or n_1 < 2:
+        return None
+    var_0, var_1 = statistics.variance(baseline) / n_0, statistics.variance(candidate) / n_1
+    if var_0 + var_1 == 0:
+        return 0.0 if statistics.mean(baseline) != statistics.mean(candidate) else 1.0
+    t = (statistics.mean(candidate) - statistics.mean(baseline)) / math.sqrt(var_0 + var_1)
+    dof = (var_0 + var_1) ** 2 / (var_0 ** 2 / (n_0 - 1) + var_1 ** 2 / (n_1 - 1))
+    return betainc(dof / 2, 0.5, dof / (dof + t * t))
+
+
+def compare(args):
+    with open(args.baseline) as file:
+        baseline = json.load(file)["benchmarks"]
+    with open(args.candidate) as file:
+        candidate = json.load(file)["benchmarks"]
+
+    regressions = []
+    width = max((len(name) for name in baseline.keys() & candidate.keys()), default=10)
+    print(f"{'benchmark':<{width}}  {'metric':<14}{'baseline':>14}{'candidate':>14}{'change':>9}{'p':>8}")
+    for name in sorted(baseline.keys() & candidate.keys()):
+        for metric in METRICS:
+            before, after = baseline[name][metric], candidate[name][metric]
+            if not before or not after or statistics.mean(before) == 0:
+                continue
+            change = statistics.mean(after) / statistics.mean(before) - 1
+            p_value = welch_t_test(before, after)
+            significant = p_value is not None and p_value < args.alpha
+            flag = ""
+            if significant and change > args.threshold:
+                flag = "  REGRESSION"
+                regressions.append((name, metric))
+            elif significant and change < -args.threshold:
+                flag = "  improvement"
+            p_text = f"{p_value:8.3f}" if p_value is not None else f"{'-':>8}"
+            print(f"{name:<{width}}  {metric:<14}{statistics.mean(before):>14.4g}{statistics.mean(after):>14.4g}"
+                  f"{change:>+9.1%}{p_text}{flag}")
+    for name in sorted(baseline.keys() ^ candidate.keys()):
+        print(f"{name}: only in {'baseline' if name in baseline else 'candidate'}")
+
+    if regressions:
+        print(f"\n{len(regressions)} significant regression(s)")
+        return 1
+    return 0
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    subparsers = parser.add_subparsers(dest="command", required=True)
+
+    run_parser = subparsers.add_parser("run", help="run the corpus and write the results as JSON")
+    run_parser.add_argument("--build-dir", default="build-op-count-time")
+    run_parser.add_argument("--repetitions", type=int, default=5)
+    run_parser.add_argument("--acir-dir", help="directory of ACIR programs, as <program>/target/{acir,witness}.gz")
+    run_parser.add_argument("--crs-dir", help="CRS directory passed to bb")
+    run_parser.add_argument("-o", "--output", default="e2e_bench.json")
+
+    compare_parser = subparsers.add_parser("compare", help="compare two result files")
+    compare_parser.add_argument("baseline")
+    compare_parser.add_argument("candidate")
+    compare_parser.add_argument("--alpha", type=float, default=0.05, help="significance level")
+    compare_parser.add_argument("--threshold", type=float, default=0.05, help="relative change to flag")
+
+    args = parser.parse_args()
+    if args.command == "run":
+        run(args)
+        return 0
+    return compare(args)
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -12,12 +12,14 @@
 #include "log.hpp"
 #include <barretenberg/common/benchmark.hpp>
 #include <barretenberg/common/container.hpp>
+#include <barretenberg/common/op_count.hpp>
 #include <barretenberg/common/timer.hpp>
 #include <barretenberg/dsl/acir_format/acir_to_constraint_buf.hpp>
 #include <barretenberg/dsl/acir_proofs/acir_composer.hpp>
 #include <barretenberg/dsl/acir_proofs/goblin_acir_composer.hpp>
 #include <barretenberg/srs/global_crs.hpp>
 #include <cstdint>
+#include <fstream>
 #include <iostream>
 #include <stdexcept>
 #include <string>
@@ -341,6 +343,47 @@ bool verify(const std::string& proof_path, const std::string& vk_path)
     return verified;
 }
 
+/**
+ * @brief Verifies a batch of proofs for ACIR circuits with a single pairing check
+ *
+ * Communication:
+ * - proc_exit: A boolean value is returned indicating whether all proofs are valid.
+ *   an exit code of 0 will be returned for success and 1 for failure.
+ *
+ * @param proof_paths Comma-separated paths to the files containing the serialized proofs
+ * @param vk_paths Comma-separated paths to the files containing the serialized verification keys, either one per proof
+ * or a single key shared by all proofs
+ * @return true If every proof is valid
+ * @return false If any proof is invalid
+ */
+bool verify_batch(const std::string& proof_paths, const std::string& vk_paths)
+{
+    auto g2_data = get_bn254_g2_data(CRS_PATH);
+    srs::init_crs_factory({}, g2_data);
+
+    std::vector<std::vector<uint8_t>> proofs;
+    for (auto& path : split(proof_paths)) {
+        proofs.emplace_back(read_file(path));
+    }
+    std::vector<acir_proofs::AcirComposer> acir_composers;
+    for (auto& path : split(vk_paths)) {
+        auto& acir_composer = acir_composers.emplace_back(0, verbose);
+        acir_composer.load_verification_key(from_buffer<plonk::verification_key_data>(read_file(path)));
+    }
+    if (acir_composers.size() != 1 && acir_composers.size() != proofs.size()) {
+        throw_or_abort("expected one verification key per proof or a single shared verification key");
+    }
+    std::vector<acir_proofs::AcirComposer*> composers;
+    for (size_t i = 0; i < proofs.size(); ++i) {
+        composers.push_back(&acir_composers[acir_composers.size() == 1 ? 0 : i]);
+    }
+
+    bool verified = acir_proofs::AcirComposer::verify_proofs(composers, proofs);
+
+    vinfo("verified: ", verified);
+    return verified;
+}
+
 /**
  * @brief Writes a verification key for an ACIR circuit to a file
  *
@@ -653,6 +696,51 @@ template <IsUltraFlavor Flavor> bool verify_honk(const std::string& proof_path,
     return verified;
 }
 
+/**
+ * @brief Verifies a batch of proofs with a single pairing check
+ *
+ * Communication:
+ * - proc_exit: A boolean value is returned indicating whether all proofs are valid.
+ *   an exit code of 0 will be returned for success and 1 for failure.
+ *
+ * @param proof_paths Comma-separated paths to the files containing the serialized proofs
+ * @param vk_paths Comma-separated paths to the files containing the serialized verification keys, either one per proof
+ * or a single key shared by all proofs
+ * @return true If every proof is valid
+ * @return false If any proof is invalid
+ */
+template <IsUltraFlavor Flavor> bool verify_honk_batch(const std::string& proof_paths, const std::string& vk_paths)
+{
+    using VerificationKey = Flavor::VerificationKey;
+    using Verifier = UltraVerifier_<Flavor>;
+    using VerifierCommitmentKey = bb::VerifierCommitmentKey<curve::BN254>;
+
+    auto g2_data = get_bn254_g2_data(CRS_PATH);
+    srs::init_crs_factory({}, g2_data);
+
+    std::vector<HonkProof> proofs;
+    for (auto& path : split(proof_paths)) {
+        proofs.emplace_back(from_buffer<std::vector<bb::fr>>(read_file(path)));
+    }
+    std::vector<std::shared_ptr<VerificationKey>> verification_keys;
+    for (auto& path : split(vk_paths)) {
+        auto verification_key = std::make_shared<VerificationKey>(from_buffer<VerificationKey>(read_file(path)));
+        verification_key->pcs_verification_key = std::make_shared<VerifierCommitmentKey>();
+        verification_keys.emplace_back(verification_key);
+    }
+    if (verification_keys.size() == 1) {
+        verification_keys.resize(proofs.size(), verification_keys[0]);
+    }
+    if (verification_keys.size() != proofs.size()) {
+        throw_or_abort("expected one verification key per proof or a single shared verification key");
+    }
+
+    bool verified = Verifier::batch_verify(proofs, verification_keys);
+
+    vinfo("verified: ", verified);
+    return verified;
+}
+
 /**
  * @brief Writes a verification key for an ACIR circuit to a file
  *
@@ -752,6 +840,27 @@ std::string get_option(std::vector<std::string>& args, const std::string& option
     return (itr != args.end() && std::next(itr) != args.end()) ? *(std::next(itr)) : defaultValue;
 }
 
+/**
+ * @brief Writes the op count profile to a JSON file when it goes out of scope, i.e. whichever way the command returns.
+ */
+// NOLINTNEXTLINE(cppcoreguidelines-special-member-functions)
+struct OpProfileWriter {
+    std::string output_path;
+    ~OpProfileWriter()
+    {
+        if (output_path.empty()) {
+            return;
+        }
+#ifdef BB_USE_OP_COUNT
+        std::ofstream file(output_path);
+        bb::detail::GLOBAL_OP_COUNTS.write_json(file);
+        vinfo("op profile written to: ", output_path);
+#else
+        std::cerr << "--op-profile requires a build with BB_USE_OP_COUNT (e.g. the op-count-perf preset)\n";
+#endif
+    }
+};
+
 int main(int argc, char* argv[])
 {
     try {
@@ -764,6 +873,7 @@ int main(int argc, char* argv[])
         }
 
         std::string command = args[0];
+        OpProfileWriter op_profile{ get_option(args, "--op-profile", "") };
 
         std::string bytecode_path = get_option(args, "-b", "./target/acir.gz");
         std::string witness_path = get_option(args, "-w", "./target/witness.gz");
@@ -808,6 +918,8 @@ int main(int argc, char* argv[])
             gateCount(bytecode_path);
         } else if (command == "verify") {
             return verify(proof_path, vk_path) ? 0 : 1;
+        } else if (command == "verify_batch") {
+            return verify_batch(proof_path, vk_path) ? 0 : 1;
         } else if (command == "contract") {
             std::string output_path = get_option(args, "-o", "./target/contract.sol");
             contract(output_path, vk_path);
@@ -836,6 +948,8 @@ int main(int argc, char* argv[])
             prove_honk<UltraFlavor>(bytecode_path, witness_path, output_path);
         } else if (command == "verify_ultra_honk") {
             return verify_honk<UltraFlavor>(proof_path, vk_path) ? 0 : 1;
+        } else if (command == "verify_ultra_honk_batch") {
+            return verify_honk_batch<UltraFlavor>(proof_path, vk_path) ? 0 : 1;
         } else if (command == "write_vk_ultra_honk") {
             std::string output_path = get_option(args, "-o", "./target/vk");
             write_vk_honk<UltraFlavor>(bytecode_path, output_path);
@@ -4,10 +4,13 @@
 #include "barretenberg/client_ivc/client_ivc.hpp"
 #include "barretenberg/common/op_count.hpp"
 #include "barretenberg/common/op_count_google_bench.hpp"
+#include "barretenberg/ecc/scalar_multiplication/runtime_states.hpp"
 #include "barretenberg/goblin/mock_circuits.hpp"
 #include "barretenberg/stdlib_circuit_builders/ultra_circuit_builder.hpp"
 #include "barretenberg/ultra_honk/ultra_verifier.hpp"
 
+#include <sys/resource.h>
+
 using namespace benchmark;
 using namespace bb;
 
@@ -153,6 +156,45 @@ class ClientIVCBench : public benchmark::Fixture {
             kernel_fold_output = { kernel_fold_proof, ivc.vks.kernel_vk };
         }
     }
+
+    /**
+     * @brief Run the full IVC and report the minor page faults incurred and the pippenger runtime states allocated
+     * @details With the pool disabled, every commitment key constructs (and pre-faults) its own runtime state.
+     */
+    static void prove_full(State& state, const bool pool_runtime_states)
+    {
+        using BN254Pool = scalar_multiplication::PippengerRuntimeStatePool<curve::BN254>;
+        using GrumpkinPool = scalar_multiplication::PippengerRuntimeStatePool<curve::Grumpkin>;
+        BN254Pool::set_enabled(pool_runtime_states);
+        GrumpkinPool::set_enabled(pool_runtime_states);
+        const auto get_num_allocations = [] {
+            return BN254Pool::get_stats().num_allocations + GrumpkinPool::get_stats().num_allocations;
+        };
+        const auto get_minor_page_faults = [] {
+            rusage usage{};
+            getrusage(RUSAGE_SELF, &usage);
+            return usage.ru_minflt;
+        };
+
+        ClientIVC ivc;
+        ivc.precompute_folding_verification_keys();
+        const auto initial_page_faults = get_minor_page_faults();
+        const size_t initial_allocations = get_num_allocations();
+        for (auto _ : state) {
+            BB_REPORT_OP_COUNT_IN_BENCH(state);
+            // Perform a specified number of iterations of function/kernel accumulation
+            perform_ivc_accumulation_rounds(state, ivc);
+
+            // Construct IVC scheme proof (fold, decider, merge, eccvm, translator)
+            ivc.prove();
+        }
+        state.counters["minor_page_faults"] = Counter(static_cast<double>(get_minor_page_faults() - initial_page_faults),
+                                                      Counter::kAvgIterations);
+        state.counters["msm_state_allocations"] =
+            Counter(static_cast<double>(get_num_allocations() - initial_allocations), Counter::kAvgIterations);
+        BN254Pool::set_enabled(true);
+        GrumpkinPool::set_enabled(true);
+    }
 };
 
 /**
@@ -161,16 +203,16 @@ class ClientIVCBench : public benchmark::Fixture {
  */
 BENCHMARK_DEFINE_F(ClientIVCBench, Full)(benchmark::State& state)
 {
-    ClientIVC ivc;
-    ivc.precompute_folding_verification_keys();
-    for (auto _ : state) {
-        BB_REPORT_OP_COUNT_IN_BENCH(state);
-        // Perform a specified number of iterations of function/kernel accumulation
-        perform_ivc_accumulation_rounds(state, ivc);
+    prove_full(state, /*pool_runtime_states=*/true);
+}
 
-        // Construct IVC scheme proof (fold, decider, merge, eccvm, translator)
-        ivc.prove();
-    }
+/**
+ * @brief As Full, but with every commitment key allocating its own pippenger runtime state
+ *
+ */
+BENCHMARK_DEFINE_F(ClientIVCBench, FullWithoutStatePool)(benchmark::State& state)
+{
+    prove_full(state, /*pool_runtime_states=*/false);
 }
 
 /**
@@ -252,6 +294,7 @@ BENCHMARK_DEFINE_F(ClientIVCBench, Translator)(benchmark::State& state)
         ->Arg(1 << 6)
 
 BENCHMARK_REGISTER_F(ClientIVCBench, Full)->Unit(benchmark::kMillisecond)->ARGS;
+BENCHMARK_REGISTER_F(ClientIVCBench, FullWithoutStatePool)->Unit(benchmark::kMillisecond)->ARGS;
 BENCHMARK_REGISTER_F(ClientIVCBench, Accumulate)->Unit(benchmark::kMillisecond)->ARGS;
 BENCHMARK_REGISTER_F(ClientIVCBench, Decide)->Unit(benchmark::kMillisecond)->ARGS;
 BENCHMARK_REGISTER_F(ClientIVCBench, ECCVM)->Unit(benchmark::kMillisecond)->ARGS;
@@ -3,6 +3,8 @@
 # This script is used to compare a suite of benchmarks between baseline (default: master) and
 # the branch from which the script is run. Simply check out the branch of interest, ensure
 # it is up to date with local master, and run the script.
+# To compare end-to-end proving across all proving systems, with peak memory and op count breakdowns, see
+# scripts/benchmark_e2e.py.
 
 # Specify the benchmark suite and the "baseline" branch against which to compare
 BENCH_TARGET=${1:?"Please provide the name of a benchmark target."}
@@ -0,0 +1,117 @@
+#include <benchmark/benchmark.h>
+
+#include "barretenberg/benchmark/ultra_bench/mock_circuits.hpp"
+#include "barretenberg/common/op_count_google_bench.hpp"
+#include "barretenberg/goblin/mock_circuits.hpp"
+#include "barretenberg/stdlib_circuit_builders/goblin_ultra_circuit_builder.hpp"
+#include "barretenberg/stdlib_circuit_builders/ultra_circuit_builder.hpp"
+#include "barretenberg/vm/avm_trace/avm_trace.hpp"
+#include "barretenberg/vm/generated/avm_composer.hpp"
+
+#include <sys/resource.h>
+
+using namespace benchmark;
+using namespace bb;
+
+/**
+ * @brief End-to-end proving benchmarks over a fixed corpus of circuits, for every proving system
+ * @details These are meant to be run by scripts/benchmark_e2e.py, which runs each benchmark in its own process (so that
+ * peak RSS is per benchmark), repeats it, and records the samples as JSON for comparison between builds. The op count
+ * breakdown of each proof is reported as user counters when built with op counts (e.g. the op-count-time preset).
+ * Circuit construction is not measured; proving is, including proving key construction.
+ */
+namespace {
+
+// Peak resident set size of this process so far, in bytes
+double get_peak_rss_bytes()
+{
+    rusage usage{};
+    getrusage(RUSAGE_SELF, &usage);
+    return static_cast<double>(usage.ru_maxrss) * 1024; // ru_maxrss is in KiB on Linux
+}
+
+template <typename Prover>
+void prove(State& state, void (*test_circuit_function)(typename Prover::Flavor::CircuitBuilder&, size_t))
+{
+    srs::init_crs_factory("../srs_db/ignition");
+    const auto num_iterations = static_cast<size_t>(state.range(0));
+    for (auto _ : state) {
+        state.PauseTiming();
+        using Builder = typename Prover::Flavor::CircuitBuilder;
+        Builder builder;
+        test_circuit_function(builder, num_iterations);
+        state.ResumeTiming();
+
+        BB_REPORT_OP_COUNT_IN_BENCH(state);
+        // Mirror mock_circuits::get_prover, which we can't use here since it builds the circuit itself
+        if constexpr (IsPlonkFlavor<typename Prover::Flavor>) {
+            plonk::UltraComposer composer;
+            Prover prover = composer.create_prover(builder);
+            DoNotOptimize(prover.construct_proof());
+        } else {
+            Prover prover(builder);
+            DoNotOptimize(prover.construct_proof());
+        }
+    }
+    state.counters["peak_rss_bytes"] = get_peak_rss_bytes();
+}
+
+// The aztec client's mock function circuit; num_iterations selects the medium (0) or large (1) variant
+void generate_mock_function_circuit(GoblinUltraCircuitBuilder& builder, size_t num_iterations)
+{
+    GoblinMockCircuits::construct_mock_function_circuit(builder, /*large=*/num_iterations > 0);
+}
+
+/**
+ * @brief Prove an AVM trace of 2^log_num_ops additions and multiplications of field elements
+ */
+void prove_avm(State& state)
+{
+    srs::init_crs_factory("../srs_db/ignition");
+    const size_t num_ops = 1UL << static_cast<size_t>(state.range(0));
+    for (auto _ : state) {
+        state.PauseTiming();
+        avm_trace::AvmTraceBuilder trace_builder;
+        trace_builder.op_set(0, 1, 0, avm_trace::AvmMemoryTag::FF);
+        trace_builder.op_set(0, 2, 1, avm_trace::AvmMemoryTag::FF);
+        for (size_t i = 0; i < num_ops / 2; ++i) {
+            trace_builder.op_add(0, 0, 1, 2, avm_trace::AvmMemoryTag::FF);
+            trace_builder.op_mul(0, 1, 2, 0, avm_trace::AvmMemoryTag::FF);
+        }
+        trace_builder.return_op(0, 0, 0);
+        AvmCircuitBuilder circuit_builder;
+        circuit_builder.set_trace(trace_builder.finalize());
+        state.ResumeTiming();
+
+        BB_REPORT_OP_COUNT_IN_BENCH(state);
+        AvmComposer composer;
+        auto prover = composer.create_prover(circuit_builder);
+        DoNotOptimize(prover.construct_proof());
+    }
+    state.counters["peak_rss_bytes"] = get_peak_rss_bytes();
+}
+
+} // namespace
+
+// The corpus. Each circuit is proven with each system that supports it; arguments are the circuit function's
+// num_iterations (or log2 of the number of gates for the basic arithmetic circuit).
+#define E2E_BENCHMARK(system, prover, builder, name, function, iterations)                                             \
+    BENCHMARK_CAPTURE(prove<prover>, system##_##name, &function<builder>)->Arg(iterations)->Unit(kMillisecond)
+
+#define E2E_BENCHMARKS(system, prover, builder)                                                                        \
+    E2E_BENCHMARK(system, prover, builder, arithmetic, mock_circuits::generate_basic_arithmetic_circuit, 17);          \
+    E2E_BENCHMARK(system, prover, builder, sha256, stdlib::generate_sha256_test_circuit, 10);                         \
+    E2E_BENCHMARK(system, prover, builder, keccak, stdlib::generate_keccak_test_circuit, 10);                         \
+    E2E_BENCHMARK(system, prover, builder, ecdsa_verification, stdlib::generate_ecdsa_verification_test_circuit, 10); \
+    E2E_BENCHMARK(system, prover, builder, merkle_membership, stdlib::generate_merkle_membership_test_circuit, 10)
+
+E2E_BENCHMARKS(ultra_plonk, plonk::UltraProver, UltraCircuitBuilder);
+E2E_BENCHMARKS(ultra_honk, UltraProver, UltraCircuitBuilder);
+E2E_BENCHMARKS(goblin_ultra_honk, GoblinUltraProver, GoblinUltraCircuitBuilder);
+
+BENCHMARK_CAPTURE(prove<GoblinUltraProver>, goblin_ultra_honk_mock_function_circuit, &generate_mock_function_circuit)
+    ->DenseRange(0, 1)
+    ->Unit(kMillisecond);
+BENCHMARK(prove_avm)->Arg(12)->Arg(16)->Unit(kMillisecond);
+
+BENCHMARK_MAIN();
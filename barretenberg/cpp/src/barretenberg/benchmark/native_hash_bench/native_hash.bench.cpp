@@ -0,0 +1,140 @@
+/**
+ * @file native_hash.bench.cpp
+ * @brief Benchmarks for the native (out-of-circuit) SHA-256, Keccak-256 and BLAKE2s implementations
+ *
+ * @details The single-message benchmarks measure throughput on one long message, which is what Polynomial::hash and
+ * the transcripts see. The batch benchmarks hash many short messages, comparing the batch APIs (which use the
+ * multi-buffer kernels if the CPU supports them) with a loop over the single-message functions.
+ */
+#include "barretenberg/crypto/blake2s/blake2s.hpp"
+#include "barretenberg/crypto/keccak/keccak.hpp"
+#include "barretenberg/crypto/sha256/sha256.hpp"
+#include "barretenberg/crypto/sha256/sha256_kernels.hpp"
+
+#include <benchmark/benchmark.h>
+#include <random>
+
+using namespace benchmark;
+using namespace bb;
+
+namespace {
+
+constexpr size_t NUM_BATCH_MESSAGES = 1024;
+
+std::vector<uint8_t> random_bytes(const size_t size)
+{
+    static std::mt19937 engine(0);
+    std::vector<uint8_t> bytes(size);
+    for (auto& byte : bytes) {
+        byte = static_cast<uint8_t>(engine());
+    }
+    return bytes;
+}
+
+std::vector<std::vector<uint8_t>> random_messages(const size_t message_size)
+{
+    std::vector<std::vector<uint8_t>> messages(NUM_BATCH_MESSAGES);
+    for (auto& message : messages) {
+        message = random_bytes(message_size);
+    }
+    return messages;
+}
+
+} // namespace
+
+void sha256_single(State& state) noexcept
+{
+    const auto message = random_bytes(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        DoNotOptimize(crypto::sha256(message));
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(sha256_single)->Arg(64)->Arg(1 << 10)->Arg(1 << 20);
+
+// The portable compression function, i.e. what sha256_single measures on a CPU without SHA-NI
+void sha256_compress_portable(State& state) noexcept
+{
+    const auto blocks = random_bytes(1 << 20);
+    for (auto _ : state) {
+        crypto::sha256_kernels::State hash_state{};
+        crypto::sha256_kernels::compress_portable(hash_state, blocks.data(), blocks.size() / 64);
+        DoNotOptimize(hash_state);
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(blocks.size()));
+}
+BENCHMARK(sha256_compress_portable);
+
+void sha256_loop(State& state) noexcept
+{
+    const auto messages = random_messages(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        for (const auto& message : messages) {
+            DoNotOptimize(crypto::sha256(message));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(messages.size()));
+}
+BENCHMARK(sha256_loop)->Arg(32)->Arg(64)->Arg(128);
+
+void sha256_batch(State& state) noexcept
+{
+    const auto messages = random_messages(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        DoNotOptimize(crypto::sha256_batch(messages));
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(messages.size()));
+}
+BENCHMARK(sha256_batch)->Arg(32)->Arg(64)->Arg(128);
+
+void keccak256_single(State& state) noexcept
+{
+    const auto message = random_bytes(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        DoNotOptimize(ethash_keccak256(message.data(), message.size()));
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(keccak256_single)->Arg(64)->Arg(1 << 10)->Arg(1 << 20);
+
+void keccak256_loop(State& state) noexcept
+{
+    const auto messages = random_messages(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        for (const auto& message : messages) {
+            DoNotOptimize(ethash_keccak256(message.data(), message.size()));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(messages.size()));
+}
+BENCHMARK(keccak256_loop)->Arg(32)->Arg(64)->Arg(256);
+
+void keccak256_batch(State& state) noexcept
+{
+    const auto messages = random_messages(static_cast<size_t>(state.range(0)));
+    std::vector<const uint8_t*> data;
+    std::vector<size_t> sizes;
+    for (const auto& message : messages) {
+        data.push_back(message.data());
+        sizes.push_back(message.size());
+    }
+    std::vector<keccak256> hashes(messages.size());
+    for (auto _ : state) {
+        ethash_keccak256_batch(data.data(), sizes.data(), messages.size(), hashes.data());
+        DoNotOptimize(hashes.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(messages.size()));
+}
+BENCHMARK(keccak256_batch)->Arg(32)->Arg(64)->Arg(256);
+
+void blake2s_single(State& state) noexcept
+{
+    const auto message = random_bytes(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        DoNotOptimize(crypto::blake2s(message));
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(blake2s_single)->Arg(64)->Arg(1 << 10)->Arg(1 << 20);
+
+BENCHMARK_MAIN();
@@ -1,6 +1,8 @@
 #include "barretenberg/common/assert.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/ecc/curves/bn254/bn254.hpp"
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
+#include "barretenberg/ecc/scalar_multiplication/signed_digit_msm.hpp"
 #include "barretenberg/polynomials/polynomial_arithmetic.hpp"
 #include "barretenberg/srs/factories/file_crs_factory.hpp"
 
@@ -76,7 +78,19 @@ int pippenger()
     std::chrono::steady_clock::time_point time_end = std::chrono::steady_clock::now();
     std::chrono::microseconds diff = std::chrono::duration_cast<std::chrono::microseconds>(time_end - time_start);
     std::cout << "run time: " << diff.count() << "us" << std::endl;
-    std::cout << result.x << std::endl;
+    std::cout << result.normalize().x << std::endl;
+    return 0;
+}
+
+int pippenger_signed_digit()
+{
+    std::chrono::steady_clock::time_point time_start = std::chrono::steady_clock::now();
+    g1::element result = scalar_multiplication::signed_digit_pippenger<curve::BN254>(
+        &scalars[0], reference_string->get_monomial_points(), NUM_POINTS);
+    std::chrono::steady_clock::time_point time_end = std::chrono::steady_clock::now();
+    std::chrono::microseconds diff = std::chrono::duration_cast<std::chrono::microseconds>(time_end - time_start);
+    std::cout << "run time: " << diff.count() << "us" << std::endl;
+    std::cout << result.normalize().x << std::endl;
     return 0;
 }
 
@@ -115,5 +129,13 @@ int main()
     pippenger();
     pippenger();
     pippenger();
+    const auto config = scalar_multiplication::get_signed_digit_msm_config(NUM_POINTS * 2, get_num_cpus());
+    std::cout << "executing signed digit pippenger algorithm (window bits = " << config.window_bits
+              << ", buckets per tile = " << config.buckets_per_tile << ")" << std::endl;
+    pippenger_signed_digit();
+    pippenger_signed_digit();
+    pippenger_signed_digit();
+    pippenger_signed_digit();
+    pippenger_signed_digit();
     return 0;
 }
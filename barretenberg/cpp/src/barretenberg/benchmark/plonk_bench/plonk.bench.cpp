@@ -1,4 +1,5 @@
 #include "barretenberg/plonk/composer/standard_composer.hpp"
+#include "barretenberg/plonk/composer/ultra_composer.hpp"
 #include "barretenberg/stdlib/primitives/field/field.hpp"
 #include "barretenberg/stdlib_circuit_builders/standard_circuit_builder.hpp"
 #include <benchmark/benchmark.h>
@@ -15,7 +16,7 @@ constexpr size_t START = (MAX_GATES) >> (NUM_CIRCUITS - 1);
 using Builder = bb::StandardCircuitBuilder;
 using Composer = bb::plonk::StandardComposer;
 
-void generate_test_plonk_circuit(Builder& builder, size_t num_gates)
+template <typename CircuitBuilder> void generate_test_plonk_circuit(CircuitBuilder& builder, size_t num_gates)
 {
     stdlib::field_t a(stdlib::witness_t(&builder, bb::fr::random_element()));
     stdlib::field_t b(stdlib::witness_t(&builder, bb::fr::random_element()));
@@ -94,4 +95,30 @@ void verify_proofs_bench(State& state) noexcept
 }
 BENCHMARK(verify_proofs_bench)->RangeMultiplier(2)->Range(START, MAX_GATES);
 
+/**
+ * @brief The quotient stage of the UltraPlonk prover: every widget's contribution to the quotient over the large domain
+ */
+void compute_quotient_contributions_bench(State& state) noexcept
+{
+    const auto num_gates = static_cast<size_t>(state.range(0));
+    auto builder = bb::UltraCircuitBuilder();
+    generate_test_plonk_circuit(builder, num_gates);
+    auto composer = plonk::UltraComposer();
+    auto prover = composer.create_prover(builder);
+    prover.execute_preamble_round();
+    prover.execute_first_round();
+    prover.execute_second_round();
+    prover.execute_third_round();
+    prover.flush_queued_work_items();
+    prover.transcript.apply_fiat_shamir("alpha");
+    const bb::fr alpha = bb::fr::serialize_from_buffer(prover.transcript.get_challenge("alpha").begin());
+    for (auto _ : state) {
+        DoNotOptimize(prover.compute_quotient_contributions(alpha));
+    }
+}
+BENCHMARK(compute_quotient_contributions_bench)
+    ->RangeMultiplier(4)
+    ->Range(START, MAX_GATES)
+    ->Unit(benchmark::kMillisecond);
+
 BENCHMARK_MAIN();
@@ -31,6 +31,39 @@ template <typename Flavor, typename Relation> void execute_relation(::benchmark:
         Relation::accumulate(accumulator, new_value, params, 1);
     }
 }
+/**
+ * @brief Evaluate a relation the way the sumcheck prover does, on BATCH_SIZE extended edges at once
+ * @details BATCH_SIZE = 1 is the edge-by-edge evaluation; larger batches use the point-major layout of
+ * SumcheckProverRound::EdgeBatch. Items processed counts edges so that the rates are comparable.
+ */
+template <typename Flavor, typename Relation, size_t BATCH_SIZE>
+void execute_relation_on_edges(::benchmark::State& state)
+{
+    using FF = typename Flavor::FF;
+    using ExtendedEdges =
+        typename Flavor::template ProverUnivariates<Flavor::MAX_PARTIAL_RELATION_LENGTH * BATCH_SIZE>;
+    using Accumulators = typename Relation::template BatchedSumcheckTupleOfUnivariatesOverSubrelations<BATCH_SIZE>;
+
+    auto params = bb::RelationParameters<FF>::get_random();
+
+    ExtendedEdges extended_edges;
+    for (auto& edge : extended_edges.get_all()) {
+        edge = std::remove_reference_t<decltype(edge)>::get_random();
+    }
+    Accumulators accumulators;
+    std::apply([](auto&... accumulator) { ((accumulator = accumulator.zero()), ...); }, accumulators);
+
+    for (auto _ : state) {
+        Relation::accumulate(accumulators, extended_edges, params, 1);
+        ::benchmark::DoNotOptimize(accumulators);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * BATCH_SIZE));
+}
+
+#define RELATION_ON_EDGES_BENCHMARKS(Flavor, Relation)                                                                 \
+    BENCHMARK(execute_relation_on_edges<Flavor, Relation, 1>);                                                         \
+    BENCHMARK(execute_relation_on_edges<Flavor, Relation, Flavor::SUMCHECK_EDGE_BATCH_SIZE>)
+
 BENCHMARK(execute_relation<UltraFlavor, UltraArithmeticRelation<Fr>>);
 BENCHMARK(execute_relation<UltraFlavor, DeltaRangeConstraintRelation<Fr>>);
 BENCHMARK(execute_relation<UltraFlavor, EllipticRelation<Fr>>);
@@ -40,6 +73,16 @@ BENCHMARK(execute_relation<UltraFlavor, UltraPermutationRelation<Fr>>);
 
 BENCHMARK(execute_relation<GoblinUltraFlavor, EccOpQueueRelation<Fr>>);
 
+RELATION_ON_EDGES_BENCHMARKS(UltraFlavor, UltraArithmeticRelation<Fr>);
+RELATION_ON_EDGES_BENCHMARKS(UltraFlavor, UltraPermutationRelation<Fr>);
+RELATION_ON_EDGES_BENCHMARKS(UltraFlavor, LookupRelation<Fr>);
+RELATION_ON_EDGES_BENCHMARKS(UltraFlavor, DeltaRangeConstraintRelation<Fr>);
+RELATION_ON_EDGES_BENCHMARKS(UltraFlavor, EllipticRelation<Fr>);
+RELATION_ON_EDGES_BENCHMARKS(UltraFlavor, AuxiliaryRelation<Fr>);
+RELATION_ON_EDGES_BENCHMARKS(GoblinUltraFlavor, DatabusLookupRelation<Fr>);
+RELATION_ON_EDGES_BENCHMARKS(GoblinUltraFlavor, Poseidon2ExternalRelation<Fr>);
+RELATION_ON_EDGES_BENCHMARKS(GoblinUltraFlavor, Poseidon2InternalRelation<Fr>);
+
 BENCHMARK(execute_relation<GoblinTranslatorFlavor, GoblinTranslatorDecompositionRelation<Fr>>);
 BENCHMARK(execute_relation<GoblinTranslatorFlavor, GoblinTranslatorOpcodeConstraintRelation<Fr>>);
 BENCHMARK(execute_relation<GoblinTranslatorFlavor, GoblinTranslatorAccumulatorTransferRelation<Fr>>);
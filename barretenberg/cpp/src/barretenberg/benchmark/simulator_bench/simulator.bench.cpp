@@ -1,5 +1,8 @@
 #include "barretenberg/goblin/goblin.hpp"
 #include "barretenberg/goblin/mock_circuits.hpp"
+#include "barretenberg/plonk/composer/ultra_composer.hpp"
+#include "barretenberg/stdlib/plonk_recursion/verifier/verifier.hpp"
+#include "barretenberg/stdlib_circuit_builders/circuit_simulator.hpp"
 #include "barretenberg/stdlib_circuit_builders/ultra_circuit_builder.hpp"
 #include <benchmark/benchmark.h>
 
@@ -14,8 +17,9 @@ template <typename RecursiveFlavor> class SimulatorFixture : public benchmark::F
     using ProverInstance = ProverInstance_<Flavor>;
     using Builder = typename Flavor::CircuitBuilder;
     using VerificationKey = typename Flavor::VerificationKey;
-    using CircuitSimulator = typename RecursiveFlavor::CircuitBuilder;
-    using SimulatingVerifier = stdlib::recursion::honk::UltraRecursiveVerifier_<RecursiveFlavor>;
+    // Either a CircuitSimulatorBN254 or a real builder, for comparison
+    using OuterBuilder = typename RecursiveFlavor::CircuitBuilder;
+    using RecursiveVerifier = stdlib::recursion::honk::UltraRecursiveVerifier_<RecursiveFlavor>;
 
     struct VerifierInput {
         HonkProof proof;
@@ -98,8 +102,8 @@ BENCHMARK_TEMPLATE_F(SimulatorFixture, GoblinSimulated, bb::GoblinUltraRecursive
 {
     auto verifier_input = SimulatorFixture::create_proof();
     for (auto _ : state) {
-        CircuitSimulator simulator;
-        SimulatingVerifier ultra_verifier{ &simulator, verifier_input.verification_key };
+        OuterBuilder simulator;
+        RecursiveVerifier ultra_verifier{ &simulator, verifier_input.verification_key };
         ultra_verifier.verify_proof((verifier_input.proof));
     }
 }
@@ -119,16 +123,108 @@ BENCHMARK_TEMPLATE_F(SimulatorFixture, UltraSimulated, bb::UltraRecursiveFlavor_
 {
     auto verifier_input = SimulatorFixture::create_proof();
     for (auto _ : state) {
-        CircuitSimulator simulator;
-        SimulatingVerifier ultra_verifier{ &simulator, verifier_input.verification_key };
+        OuterBuilder simulator;
+        RecursiveVerifier ultra_verifier{ &simulator, verifier_input.verification_key };
         ultra_verifier.verify_proof((verifier_input.proof));
     }
 }
 
+BENCHMARK_TEMPLATE_F(SimulatorFixture, GoblinCircuit, bb::GoblinUltraRecursiveFlavor_<bb::UltraCircuitBuilder>)
+(benchmark::State& state)
+{
+    auto verifier_input = SimulatorFixture::create_proof();
+    for (auto _ : state) {
+        OuterBuilder builder;
+        RecursiveVerifier ultra_verifier{ &builder, verifier_input.verification_key };
+        ultra_verifier.verify_proof((verifier_input.proof));
+    }
+}
+
+BENCHMARK_TEMPLATE_F(SimulatorFixture, UltraCircuit, bb::UltraRecursiveFlavor_<bb::UltraCircuitBuilder>)
+(benchmark::State& state)
+{
+    auto verifier_input = SimulatorFixture::create_proof();
+    for (auto _ : state) {
+        OuterBuilder builder;
+        RecursiveVerifier ultra_verifier{ &builder, verifier_input.verification_key };
+        ultra_verifier.verify_proof((verifier_input.proof));
+    }
+}
+
+/**
+ * @brief Compare the UltraPlonk recursive verifier run natively, on the simulator and on an UltraCircuitBuilder.
+ */
+class PlonkSimulatorFixture : public benchmark::Fixture {
+  public:
+    using InnerBuilder = UltraCircuitBuilder;
+
+    struct VerifierInput {
+        plonk::proof proof;
+        std::shared_ptr<plonk::verification_key> verification_key;
+        plonk::transcript::Manifest manifest;
+    };
+
+    void SetUp([[maybe_unused]] const ::benchmark::State& state) override
+    {
+        bb::srs::init_crs_factory("../srs_db/ignition");
+    }
+
+    static VerifierInput create_proof()
+    {
+        auto builder = SimulatorFixture<bb::UltraRecursiveFlavor_<bb::CircuitSimulatorBN254>>::
+            construct_mock_function_circuit(/*large=*/false);
+        plonk::UltraComposer composer;
+        auto prover = composer.create_prover(builder);
+        auto proof = prover.construct_proof();
+        auto verification_key = composer.compute_verification_key(builder);
+        return { proof, verification_key, plonk::UltraComposer::create_manifest(prover.key->num_public_inputs) };
+    }
+
+    template <typename OuterBuilder> static void verify_recursively(const VerifierInput& verifier_input)
+    {
+        using Curve = stdlib::bn254<OuterBuilder>;
+        OuterBuilder builder;
+        auto verification_key =
+            stdlib::recursion::verification_key<Curve>::from_witness(&builder, verifier_input.verification_key);
+        stdlib::recursion::verify_proof<Curve, stdlib::recursion::recursive_ultra_verifier_settings<Curve>>(
+            &builder, verification_key, verifier_input.manifest, verifier_input.proof);
+    }
+};
+
+BENCHMARK_F(PlonkSimulatorFixture, PlonkNative)(benchmark::State& state)
+{
+    auto verifier_input = create_proof();
+    for (auto _ : state) {
+        plonk::UltraVerifier verifier(verifier_input.verification_key, verifier_input.manifest);
+        verifier.verify_proof(verifier_input.proof);
+    }
+}
+
+BENCHMARK_F(PlonkSimulatorFixture, PlonkSimulated)(benchmark::State& state)
+{
+    auto verifier_input = create_proof();
+    for (auto _ : state) {
+        verify_recursively<CircuitSimulatorBN254>(verifier_input);
+    }
+}
+
+BENCHMARK_F(PlonkSimulatorFixture, PlonkCircuit)(benchmark::State& state)
+{
+    auto verifier_input = create_proof();
+    for (auto _ : state) {
+        verify_recursively<UltraCircuitBuilder>(verifier_input);
+    }
+}
+
 BENCHMARK_REGISTER_F(SimulatorFixture, GoblinSimulated)->Unit(benchmark::kMillisecond);
 BENCHMARK_REGISTER_F(SimulatorFixture, UltraSimulated)->Unit(benchmark::kMillisecond);
 BENCHMARK_REGISTER_F(SimulatorFixture, GoblinNative)->Unit(benchmark::kMillisecond);
 BENCHMARK_REGISTER_F(SimulatorFixture, UltraNative)->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(SimulatorFixture, GoblinCircuit)->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(SimulatorFixture, UltraCircuit)->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(PlonkSimulatorFixture, PlonkSimulated)->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(PlonkSimulatorFixture, PlonkNative)->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(PlonkSimulatorFixture, PlonkCircuit)->Unit(benchmark::kMillisecond);
 
 } // namespace
 BENCHMARK_MAIN();
\ No newline at end of file
@@ -31,21 +31,26 @@ enum {
  **/
 BB_PROFILE static void test_round_inner(State& state, GoblinUltraProver& prover, size_t index) noexcept
 {
+    OinkProver<GoblinUltraFlavor> oink_prover(prover.instance->proving_key, prover.transcript);
     auto time_if_index = [&](size_t target_index, auto&& func) -> void {
         BB_REPORT_OP_COUNT_IN_BENCH(state);
         if (index == target_index) {
             state.ResumeTiming();
         }
 
+        const size_t num_stages = oink_prover.stage_stats.size();
         func();
         if (index == target_index) {
             state.PauseTiming();
+            // Report the average number of tasks of the round in flight, for the rounds run as a TaskGraph
+            if (oink_prover.stage_stats.size() > num_stages) {
+                state.counters["overlap"] = oink_prover.stage_stats.back().overlap();
+            }
         } else {
             // We don't actually want to write to user-defined counters
             BB_REPORT_OP_COUNT_BENCH_CANCEL();
         }
     };
-    OinkProver<GoblinUltraFlavor> oink_prover(prover.instance->proving_key, prover.transcript);
     time_if_index(PREAMBLE, [&] { oink_prover.execute_preamble_round(); });
     time_if_index(WIRE_COMMITMENTS, [&] { oink_prover.execute_wire_commitments_round(); });
     time_if_index(SORTED_LIST_ACCUMULATOR, [&] { oink_prover.execute_sorted_list_accumulator_round(); });
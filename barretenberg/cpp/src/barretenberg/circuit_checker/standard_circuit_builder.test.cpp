@@ -466,3 +466,79 @@ TEST(standard_circuit_constructor, test_check_circuit_broken)
     bool result = CircuitChecker::check(circuit_constructor);
     EXPECT_EQ(result, false);
 }
+
+TEST(standard_circuit_constructor, copy_constraint_classes)
+{
+    StandardCircuitBuilder circuit_constructor = StandardCircuitBuilder();
+    fr a = fr::random_element();
+    const size_t num_variables = 1000;
+    std::vector<uint32_t> indices;
+    for (size_t i = 0; i < num_variables; ++i) {
+        indices.emplace_back(circuit_constructor.add_variable(a));
+    }
+
+    // Merge the variables into two long chains, then join the chains
+    for (size_t i = 2; i < num_variables; ++i) {
+        circuit_constructor.assert_equal(indices[i], indices[i - 2]);
+    }
+    EXPECT_NE(circuit_constructor.get_real_variable_index(indices[0]),
+              circuit_constructor.get_real_variable_index(indices[1]));
+    // The real variable of a merged class is that of the first argument of assert_equal
+    EXPECT_EQ(circuit_constructor.get_real_variable_index(indices[0]), indices[num_variables - 2]);
+    EXPECT_EQ(circuit_constructor.get_real_variable_index(indices[1]), indices[num_variables - 1]);
+
+    circuit_constructor.assert_equal(indices[1], indices[0]);
+    for (const auto& idx : indices) {
+        EXPECT_EQ(circuit_constructor.get_real_variable_index(idx), indices[num_variables - 1]);
+        EXPECT_EQ(circuit_constructor.get_variable(idx), a);
+    }
+
+    circuit_constructor.compress_variable_classes();
+    const auto real_variable_indices = circuit_constructor.get_real_variable_indices();
+    for (const auto& idx : indices) {
+        EXPECT_EQ(circuit_constructor.variable_class_parent[idx],
+                  circuit_constructor.get_variable_class_root(indices[num_variables - 1]));
+        EXPECT_EQ(real_variable_indices[idx], indices[num_variables - 1]);
+    }
+    EXPECT_FALSE(circuit_constructor.failed());
+}
+
+TEST(standard_circuit_constructor, public_input_index)
+{
+    StandardCircuitBuilder circuit_constructor = StandardCircuitBuilder();
+    std::vector<uint32_t> public_indices;
+    for (size_t i = 0; i < 10; ++i) {
+        public_indices.emplace_back(circuit_constructor.add_public_variable(fr(i)));
+    }
+    for (size_t i = 0; i < 10; ++i) {
+        EXPECT_EQ(circuit_constructor.get_public_input_index(public_indices[i]), i);
+    }
+
+    // A witness copy-constrained to a public input (after the index has been built) maps to that public input
+    uint32_t b_idx = circuit_constructor.add_variable(fr(7));
+    circuit_constructor.assert_equal(b_idx, public_indices[7]);
+    EXPECT_EQ(circuit_constructor.get_public_input_index(b_idx), 7);
+
+    // Public inputs added later are indexed too
+    uint32_t c_idx = circuit_constructor.add_variable(fr(10));
+    circuit_constructor.set_public_input(c_idx);
+    EXPECT_EQ(circuit_constructor.get_public_input_index(c_idx), 10);
+    EXPECT_FALSE(circuit_constructor.failed());
+}
+
+TEST(standard_circuit_constructor, variable_names)
+{
+    StandardCircuitBuilder circuit_constructor = StandardCircuitBuilder();
+    uint32_t a_idx = circuit_constructor.add_variable(fr(5));
+    uint32_t b_idx = circuit_constructor.add_variable(fr(5));
+    circuit_constructor.set_variable_name(b_idx, "b");
+
+    circuit_constructor.assert_equal(a_idx, b_idx);
+    circuit_constructor.update_variable_names(b_idx);
+    EXPECT_EQ(circuit_constructor.variable_names.size(), 1);
+    EXPECT_EQ(circuit_constructor.variable_names.at(a_idx), "b");
+    EXPECT_FALSE(circuit_constructor.failed());
+
+    circuit_constructor.set_variable_name(b_idx, "c");
+    EXPECT_TRUE(circuit_constructor.failed());
+}
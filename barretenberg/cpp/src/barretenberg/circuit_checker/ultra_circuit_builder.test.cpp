@@ -102,6 +102,34 @@ TEST(ultra_circuit_constructor, create_gates_from_plookup_accumulators)
     EXPECT_EQ(result, true);
 }
 
+TEST(ultra_circuit_constructor, basic_tables_are_shared_between_circuits)
+{
+    UltraCircuitBuilder first_builder;
+    UltraCircuitBuilder second_builder;
+
+    const fr input = 3;
+    const auto input_index = second_builder.add_variable(input);
+    const auto accumulators = plookup::get_lookup_accumulators(MultiTableId::HONK_DUMMY_MULTI, input, input, true);
+    second_builder.create_gates_from_plookup_accumulators(
+        MultiTableId::HONK_DUMMY_MULTI, accumulators, input_index, input_index);
+
+    auto& first_table = first_builder.get_table(plookup::HONK_DUMMY_BASIC2);
+    auto& second_table = second_builder.get_table(plookup::HONK_DUMMY_BASIC2);
+
+    // The contents are generated once and referenced by both circuits; the rest is specific to each circuit
+    EXPECT_EQ(first_table.column_1.data(), second_table.column_1.data());
+    EXPECT_EQ(first_table.column_2.data(), second_table.column_2.data());
+    EXPECT_EQ(first_table.column_3.data(), second_table.column_3.data());
+    EXPECT_EQ(first_table.table_index, 0);
+    EXPECT_EQ(second_table.table_index, 1);
+    EXPECT_EQ(first_table.num_lookup_gates, 0);
+    EXPECT_NE(second_table.num_lookup_gates, 0);
+    EXPECT_TRUE(second_table.unmatched_lookup_gates.empty());
+    EXPECT_EQ(plookup::generate_basic_table(plookup::HONK_DUMMY_BASIC2, 0).column_3, first_table.column_3);
+
+    EXPECT_TRUE(CircuitChecker::check(second_builder));
+}
+
 TEST(ultra_circuit_constructor, base_case)
 {
     UltraCircuitBuilder circuit_constructor = UltraCircuitBuilder();
@@ -209,7 +237,7 @@ TEST(ultra_circuit_constructor, non_trivial_tag_permutation)
     EXPECT_EQ(result, true);
 
     // Break the tag
-    circuit_constructor.real_variable_tags[circuit_constructor.real_variable_index[a_idx]] = 2;
+    circuit_constructor.real_variable_tags[circuit_constructor.get_real_variable_index(a_idx)] = 2;
     EXPECT_EQ(CircuitChecker::check(circuit_constructor), false);
 }
 
@@ -251,7 +279,7 @@ TEST(ultra_circuit_constructor, non_trivial_tag_permutation_and_cycles)
     EXPECT_EQ(result, true);
 
     // Break the tag
-    circuit_constructor.real_variable_tags[circuit_constructor.real_variable_index[a_idx]] = 2;
+    circuit_constructor.real_variable_tags[circuit_constructor.get_real_variable_index(a_idx)] = 2;
     EXPECT_EQ(CircuitChecker::check(circuit_constructor), false);
 }
 TEST(ultra_circuit_constructor, bad_tag_permutation)
@@ -845,4 +873,101 @@ TEST(ultra_circuit_constructor, check_circuit_showcase)
     EXPECT_EQ(CircuitChecker::check(circuit_constructor), true);
 }
 
+TEST(ultra_circuit_constructor, fork_and_merge)
+{
+    UltraCircuitBuilder builder;
+    const fr shared_value = fr::random_element();
+    const uint32_t shared_idx = builder.add_variable(shared_value);
+    const uint32_t small_idx = builder.add_variable(100);
+    builder.create_new_range_constraint(small_idx, 255);
+    const fr input_lo = uint256_t(shared_value).slice(0, plookup::fixed_base::table::BITS_PER_LO_SCALAR);
+    const uint32_t input_lo_idx = builder.add_variable(input_lo);
+    builder.create_gates_from_plookup_accumulators(
+        MultiTableId::FIXED_BASE_LEFT_LO,
+        plookup::get_lookup_accumulators(MultiTableId::FIXED_BASE_LEFT_LO, input_lo),
+        input_lo_idx);
+
+    // Lookups into a table the parent uses, range constraints, a ROM array and copy constraints with shared variables
+    auto first_fork = builder.fork();
+    // The fork shares the variables of the builder rather than copying them
+    EXPECT_EQ(first_fork.get_num_variables(), builder.get_num_variables());
+    EXPECT_TRUE(first_fork.variables.written_shared_entries().empty());
+    {
+        const uint32_t copy_idx = first_fork.add_variable(shared_value);
+        first_fork.assert_equal(copy_idx, shared_idx);
+        first_fork.create_new_range_constraint(small_idx, (1 << 16) - 1);
+        first_fork.create_range_constraint(first_fork.add_variable(1000), 32, "");
+        const uint32_t lo_idx = first_fork.add_variable(input_lo);
+        first_fork.create_gates_from_plookup_accumulators(
+            MultiTableId::FIXED_BASE_LEFT_LO,
+            plookup::get_lookup_accumulators(MultiTableId::FIXED_BASE_LEFT_LO, input_lo),
+            lo_idx);
+        const size_t rom_id = first_fork.create_ROM_array(2);
+        first_fork.set_ROM_element(rom_id, 0, copy_idx);
+        first_fork.set_ROM_element(rom_id, 1, first_fork.put_constant_variable(7));
+        const uint32_t read_idx = first_fork.read_ROM_array(rom_id, first_fork.add_variable(1));
+        first_fork.assert_equal(read_idx, first_fork.put_constant_variable(7));
+    }
+
+    // Lookups into a new table and a RAM array
+    auto second_fork = builder.fork();
+    {
+        const fr input_hi = uint256_t(shared_value).slice(plookup::fixed_base::table::BITS_PER_LO_SCALAR, 254);
+        const uint32_t hi_idx = second_fork.add_variable(input_hi);
+        second_fork.create_gates_from_plookup_accumulators(
+            MultiTableId::FIXED_BASE_LEFT_HI,
+            plookup::get_lookup_accumulators(MultiTableId::FIXED_BASE_LEFT_HI, input_hi),
+            hi_idx);
+        const size_t ram_id = second_fork.create_RAM_array(2);
+        second_fork.init_RAM_element(ram_id, 0, shared_idx);
+        second_fork.init_RAM_element(ram_id, 1, small_idx);
+        second_fork.write_RAM_array(ram_id, second_fork.add_variable(0), small_idx);
+        const uint32_t read_idx = second_fork.read_RAM_array(ram_id, second_fork.add_variable(0));
+        second_fork.assert_equal(read_idx, small_idx);
+    }
+
+    const size_t num_tables = builder.lookup_tables.size();
+    builder.merge(std::move(first_fork));
+    EXPECT_EQ(builder.lookup_tables.size(), num_tables);
+    builder.merge(std::move(second_fork));
+    EXPECT_GT(builder.lookup_tables.size(), num_tables);
+    EXPECT_EQ(builder.rom_arrays.size(), 1);
+    EXPECT_EQ(builder.ram_arrays.size(), 1);
+    EXPECT_TRUE(CircuitChecker::check(builder));
+
+    // A range constraint applied by a fork to a shared variable is enforced by the merged circuit
+    auto bad_fork = builder.fork();
+    bad_fork.create_new_range_constraint(small_idx, 15);
+    builder.merge(std::move(bad_fork));
+    EXPECT_FALSE(CircuitChecker::check(builder));
+}
+
+/**
+ * @brief A dummy gate of a fork's range list is kept by merge() when the preceding gate reads its w_4, and must then
+ * keep its witness
+ */
+TEST(ultra_circuit_constructor, merge_range_list_gate_read_by_big_add_gate)
+{
+    UltraCircuitBuilder builder;
+    // A range-constrained variable is only accounted for by the tag check if a gate reads it
+    const uint32_t parent_idx = builder.add_variable(100);
+    builder.create_new_range_constraint(parent_idx, 255);
+    builder.create_dummy_constraints({ parent_idx });
+
+    auto fork = builder.fork();
+    {
+        // The first dummy gate of the range list for 15 holds the steps 0, 3, 6 and 9, so its w_4 is 9
+        const uint32_t a_idx = fork.add_variable(1);
+        const uint32_t b_idx = fork.add_variable(2);
+        const uint32_t c_idx = fork.add_variable(3);
+        const uint32_t d_idx = fork.add_variable(4);
+        fork.create_big_add_gate({ a_idx, b_idx, c_idx, d_idx, 1, 1, 1, 1, -19 }, /*include_next_gate_w_4=*/true);
+        const uint32_t ranged_idx = fork.add_variable(7);
+        fork.create_new_range_constraint(ranged_idx, 15);
+        fork.create_dummy_constraints({ ranged_idx });
+    }
+    builder.merge(std::move(fork));
+    EXPECT_TRUE(CircuitChecker::check(builder));
+}
+
 } // namespace bb
\ No newline at end of file
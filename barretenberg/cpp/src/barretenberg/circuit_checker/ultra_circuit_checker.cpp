@@ -199,7 +199,7 @@ void UltraCircuitChecker::populate_values(
 {
     // Function to quickly update tag products and encountered variable set by index and value
     auto update_tag_check_data = [&](const size_t variable_index, const FF& value) {
-        size_t real_index = builder.real_variable_index[variable_index];
+        size_t real_index = builder.get_real_variable_index(static_cast<uint32_t>(variable_index));
         // Check to ensure that we are not including a variable twice
         if (tag_data.encountered_variables.contains(real_index)) {
             return;
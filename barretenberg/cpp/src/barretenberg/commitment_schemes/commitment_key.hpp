@@ -8,7 +8,9 @@
  */
 
 #include "barretenberg/common/op_count.hpp"
+#include "barretenberg/ecc/scalar_multiplication/fixed_base_msm.hpp"
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
+#include "barretenberg/ecc/scalar_multiplication/signed_digit_msm.hpp"
 #include "barretenberg/numeric/bitop/pow.hpp"
 #include "barretenberg/polynomials/polynomial.hpp"
 #include "barretenberg/polynomials/polynomial_arithmetic.hpp"
@@ -36,9 +38,14 @@ template <class Curve> class CommitmentKey {
     using Commitment = typename Curve::AffineElement;
 
   public:
-    scalar_multiplication::pippenger_runtime_state<Curve> pippenger_runtime_state;
+    // Acquired from, and on destruction returned to, the process-wide pool of runtime states
+    std::shared_ptr<scalar_multiplication::pippenger_runtime_state<Curve>> pippenger_runtime_state;
     std::shared_ptr<srs::factories::CrsFactory<Curve>> crs_factory;
     std::shared_ptr<srs::factories::ProverCrs<Curve>> srs;
+    // The MSM algorithm used to compute commitments
+    scalar_multiplication::MsmEngine msm_engine = scalar_multiplication::MsmEngine::WNAF_PIPPENGER;
+    // If set, commitments to the SRS prefix it covers use fixed-base MSMs, see enable_fixed_base_msm
+    std::shared_ptr<scalar_multiplication::FixedBaseMsmTable<Curve>> fixed_base_table;
 
     CommitmentKey() = delete;
 
@@ -50,17 +57,33 @@ template <class Curve> class CommitmentKey {
      *
      */
     CommitmentKey(const size_t num_points)
-        : pippenger_runtime_state(num_points)
+        : pippenger_runtime_state(scalar_multiplication::PippengerRuntimeStatePool<Curve>::acquire(num_points))
         , crs_factory(srs::get_crs_factory<Curve>())
         , srs(crs_factory->get_prover_crs(num_points))
     {}
 
     // Note: This constructor is to be used only by Plonk; For Honk the srs lives in the CommitmentKey
     CommitmentKey(const size_t num_points, std::shared_ptr<srs::factories::ProverCrs<Curve>> prover_crs)
-        : pippenger_runtime_state(num_points)
+        : pippenger_runtime_state(scalar_multiplication::PippengerRuntimeStatePool<Curve>::acquire(num_points))
         , srs(prover_crs)
     {}
 
+    /**
+     * @brief A key sharing this key's SRS and fixed-base table, but with a runtime state of its own
+     * @details The runtime state is scratch space for the MSM, so a key must not compute two commitments at once. Tasks
+     * which commit concurrently should each do so with a key of their own. As each state takes memory proportional to
+     * its number of points, the fork's state is only sized for the polynomials it will commit to.
+     *
+     * @param num_points the maximum size of the polynomials committed to with the fork
+     */
+    std::shared_ptr<CommitmentKey> fork(const size_t num_points) const
+    {
+        ASSERT(num_points <= srs->get_monomial_size());
+        auto key = std::make_shared<CommitmentKey>(*this);
+        key->pippenger_runtime_state = scalar_multiplication::PippengerRuntimeStatePool<Curve>::acquire(num_points);
+        return key;
+    }
+
     /**
      * @brief Uses the ProverSRS to create a commitment to p(X)
      *
@@ -72,9 +95,95 @@ template <class Curve> class CommitmentKey {
         BB_OP_COUNT_TIME();
         const size_t degree = polynomial.size();
         ASSERT(degree <= srs->get_monomial_size());
-        return scalar_multiplication::pippenger_unsafe<Curve>(
-            const_cast<Fr*>(polynomial.data()), srs->get_monomial_points(), degree, pippenger_runtime_state);
+        return msm(const_cast<Fr*>(polynomial.data()), 0, degree);
+    };
+
+    /**
+     * @brief Commit to a polynomial which is known to vanish outside of the given ranges of coefficients
+     * @details Computes one MSM over each (maximal run of adjacent) [start, end) range, so that the cost is governed by
+     * the number of coefficients in the ranges rather than by the size of the polynomial. This is the case for e.g. the
+     * wires of a structured execution trace, in which much of the space reserved for each block may be unused.
+     *
+     * @param polynomial a univariate polynomial p(X) = ∑ᵢ aᵢ⋅Xⁱ with aᵢ = 0 outside of active_ranges
+     * @param active_ranges ascending, non-overlapping ranges of coefficient indices
+     * @return Commitment computed as C = [p(x)] = ∑ᵢ aᵢ⋅Gᵢ
+     */
+    Commitment commit_structured(std::span<const Fr> polynomial,
+                                 const std::vector<std::pair<size_t, size_t>>& active_ranges)
+    {
+        BB_OP_COUNT_TIME();
+        ASSERT(polynomial.size() <= srs->get_monomial_size());
+        auto* scalars = const_cast<Fr*>(polynomial.data());
+        typename Curve::Element result;
+        result.self_set_infinity();
+        size_t idx = 0;
+        while (idx < active_ranges.size()) {
+            auto [start, end] = active_ranges[idx++];
+            while (idx < active_ranges.size() && active_ranges[idx].first == end) {
+                end = active_ranges[idx++].second;
+            }
+            ASSERT(end <= polynomial.size());
+            if (end > start) {
+                result += msm(scalars + start, start, end - start);
+            }
+        }
+        return result;
     };
+
+    /**
+     * @brief Precompute multiples of the largest prefix of the SRS whose fixed-base table fits in the memory budget
+     * @details Commitments then use a fixed-base MSM over the part of the polynomial within the prefix, which requires
+     * no doublings. This trades memory for latency when committing to many polynomials with the same key.
+     *
+     * @param memory_budget the maximum size of the table in bytes
+     * @param cache_path if non-empty, a file in which to cache the table across processes
+     */
+    void enable_fixed_base_msm(const size_t memory_budget, const std::string& cache_path = "")
+    {
+        using Table = scalar_multiplication::FixedBaseMsmTable<Curve>;
+        const size_t num_points = srs->get_monomial_size();
+        // The optimal window width depends on the number of points in the table, which depends on the width through
+        // the size of each point's multiples: size the prefix for the width that suits the whole SRS, then pick the
+        // width for that prefix, shrinking the prefix if its multiples are larger
+        size_t window_bits = Table::get_optimal_window_bits(num_points);
+        size_t num_prefix_points = std::min(num_points, memory_budget / Table::get_size_in_bytes(1, window_bits));
+        if (num_prefix_points != 0) {
+            window_bits = Table::get_optimal_window_bits(num_prefix_points);
+            num_prefix_points = std::min(num_prefix_points, memory_budget / Table::get_size_in_bytes(1, window_bits));
+        }
+        if (num_prefix_points == 0) {
+            fixed_base_table = nullptr;
+            return;
+        }
+        fixed_base_table =
+            std::make_shared<Table>(srs->get_monomial_points(), num_prefix_points, window_bits, cache_path);
+    }
+
+  private:
+    // Computes ∑ᵢ sᵢ⋅G_{start_index + i}
+    typename Curve::Element msm(Fr* scalars, const size_t start_index, const size_t num_points)
+    {
+        typename Curve::Element result;
+        result.self_set_infinity();
+        size_t num_fixed_base_points = 0;
+        if (fixed_base_table && start_index < fixed_base_table->get_num_initial_points()) {
+            num_fixed_base_points = std::min(num_points, fixed_base_table->get_num_initial_points() - start_index);
+            result = scalar_multiplication::fixed_base_pippenger<Curve>(
+                scalars, *fixed_base_table, start_index, num_fixed_base_points);
+        }
+        if (num_fixed_base_points == num_points) {
+            return result;
+        }
+        // The point table holds each point alongside its endomorphism, hence the factor of 2
+        auto* points = srs->get_monomial_points() + 2 * (start_index + num_fixed_base_points);
+        scalars += num_fixed_base_points;
+        const size_t num_remaining_points = num_points - num_fixed_base_points;
+        if (msm_engine == scalar_multiplication::MsmEngine::SIGNED_DIGIT) {
+            return result + scalar_multiplication::signed_digit_pippenger<Curve>(scalars, points, num_remaining_points);
+        }
+        return result + scalar_multiplication::pippenger_unsafe<Curve>(
+                            scalars, points, num_remaining_points, *pippenger_runtime_state);
+    }
 };
 
 } // namespace bb
@@ -49,6 +49,68 @@ TYPED_TEST(KZGTest, single)
     EXPECT_EQ(this->vk()->pairing_check(pairing_points[0], pairing_points[1]), true);
 }
 
+/**
+ * @brief Check that committing to a polynomial over only its active ranges agrees with a full commitment
+ */
+TYPED_TEST(KZGTest, CommitStructured)
+{
+    const size_t n = 1024;
+    using Fr = typename TypeParam::ScalarField;
+
+    // Adjacent ranges are merged, empty ranges are skipped and the last range is short of the end of the polynomial
+    std::vector<std::pair<size_t, size_t>> active_ranges = { { 1, 40 }, { 40, 300 }, { 512, 512 }, { 600, 1000 } };
+    auto polynomial = this->random_polynomial(n);
+    size_t idx = 0;
+    for (auto [start, end] : active_ranges) {
+        for (; idx < start; ++idx) {
+            polynomial[idx] = Fr::zero();
+        }
+        idx = end;
+    }
+    for (; idx < n; ++idx) {
+        polynomial[idx] = Fr::zero();
+    }
+
+    EXPECT_EQ(this->ck()->commit_structured(polynomial, active_ranges), this->commit(polynomial));
+}
+
+TYPED_TEST(KZGTest, CommitSignedDigit)
+{
+    const size_t n = 1000;
+
+    auto polynomial = this->random_polynomial(n);
+    auto expected = this->commit(polynomial);
+
+    this->ck()->msm_engine = scalar_multiplication::MsmEngine::SIGNED_DIGIT;
+    auto result = this->commit(polynomial);
+    this->ck()->msm_engine = scalar_multiplication::MsmEngine::WNAF_PIPPENGER;
+
+    EXPECT_EQ(result, expected);
+}
+
+TYPED_TEST(KZGTest, CommitFixedBase)
+{
+    using Curve = TypeParam;
+    using Table = scalar_multiplication::FixedBaseMsmTable<Curve>;
+    const size_t n = 1024;
+
+    // A separate key, so that the other tests keep using variable-base MSMs
+    auto ck = std::make_shared<CommitmentKey<Curve>>(n);
+    auto polynomial = this->random_polynomial(n);
+    auto expected = this->commit(polynomial);
+    std::vector<std::pair<size_t, size_t>> active_ranges = { { 100, 400 }, { 500, 900 } };
+    auto expected_structured = ck->commit_structured(polynomial, active_ranges);
+
+    // Budget for a table over half of the SRS, so that commitments span both the fixed and the variable base part
+    const size_t window_bits = Table::get_optimal_window_bits(n);
+    ck->enable_fixed_base_msm(Table::get_size_in_bytes(n / 2, window_bits));
+    ASSERT_NE(ck->fixed_base_table, nullptr);
+    EXPECT_EQ(ck->fixed_base_table->get_num_initial_points(), n / 2);
+
+    EXPECT_EQ(ck->commit(polynomial), expected);
+    EXPECT_EQ(ck->commit_structured(polynomial, active_ranges), expected_structured);
+}
+
 /**
  * @brief Test full PCS protocol: Gemini, Shplonk, KZG and pairing check
  * @details Demonstrates the full PCS protocol as it is used in the construction and verification
@@ -6,6 +6,7 @@
  */
 
 #include "barretenberg/commitment_schemes/commitment_key.hpp"
+#include "barretenberg/ecc/curves/bn254/batch_pairing_check.hpp"
 #include "barretenberg/ecc/curves/bn254/bn254.hpp"
 #include "barretenberg/ecc/curves/bn254/pairing.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
@@ -17,6 +18,7 @@
 
 #include <cstddef>
 #include <memory>
+#include <span>
 #include <string_view>
 
 namespace bb {
@@ -58,6 +60,18 @@ template <> class VerifierCommitmentKey<curve::BN254> {
 
         return (result == Curve::TargetField::one());
     }
+
+    /**
+     * @brief verifies the pairing equations of many KZG verifiers at once with a single pairing
+     * @details See bb::pairing::batch_pairing_check
+     *
+     * @param pairing_points = {(P₀ᵢ, P₁ᵢ)}ᵢ
+     * @return ∀i: e(P₀ᵢ,[1]₁)e(P₁ᵢ,[x]₂) ≡ [1]ₜ, with overwhelming probability
+     */
+    bool batch_pairing_check(std::span<const std::array<GroupElement, 2>> pairing_points)
+    {
+        return bb::pairing::batch_pairing_check(pairing_points, srs->get_precomputed_g2_lines());
+    }
 };
 
 /**
@@ -81,18 +95,19 @@ template <> class VerifierCommitmentKey<curve::Grumpkin> {
      * @param path is the location to the SRS file
      */
     VerifierCommitmentKey(size_t num_points, const std::shared_ptr<bb::srs::factories::CrsFactory<Curve>>& crs_factory)
-        : pippenger_runtime_state(num_points)
+        : pippenger_runtime_state(bb::scalar_multiplication::PippengerRuntimeStatePool<Curve>::acquire(num_points))
         , srs(crs_factory->get_verifier_crs(num_points))
     {}
 
     VerifierCommitmentKey(size_t num_points)
-        : pippenger_runtime_state(num_points)
+        : pippenger_runtime_state(bb::scalar_multiplication::PippengerRuntimeStatePool<Curve>::acquire(num_points))
     {
         srs::init_grumpkin_crs_factory("../srs_db/grumpkin");
         srs = srs::get_crs_factory<Curve>()->get_verifier_crs(num_points);
     }
 
-    bb::scalar_multiplication::pippenger_runtime_state<Curve> pippenger_runtime_state;
+    // Acquired from, and on destruction returned to, the process-wide pool of runtime states
+    std::shared_ptr<bb::scalar_multiplication::pippenger_runtime_state<Curve>> pippenger_runtime_state;
     std::shared_ptr<bb::srs::factories::VerifierCrs<Curve>> srs;
 };
 
@@ -41,6 +41,18 @@ inline std::string join(std::vector<std::string> const& to_join, std::string con
     return result;
 }
 
+inline std::vector<std::string> split(std::string const& to_split, char with = ',')
+{
+    std::vector<std::string> result;
+    size_t start = 0;
+    for (size_t end = to_split.find(with); end != std::string::npos; end = to_split.find(with, start)) {
+        result.emplace_back(to_split.substr(start, end - start));
+        start = end + 1;
+    }
+    result.emplace_back(to_split.substr(start));
+    return result;
+}
+
 template <template <typename, typename...> typename Cont, typename InnerCont, typename... Args>
 InnerCont flatten(Cont<InnerCont, Args...> const& in)
 {
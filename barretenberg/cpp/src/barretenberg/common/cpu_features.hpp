@@ -0,0 +1,49 @@
+#pragma once
+
+#if defined(__x86_64__) && !defined(__wasm__)
+#include <cpuid.h>
+#endif
+
+namespace bb {
+
+/**
+ * @brief Instruction set extensions that are only used if the CPU we are running on supports them
+ *
+ * @details Code that has faster paths for these is compiled with function-level target attributes, so that a single
+ * binary can run on any x86-64 CPU. On other architectures (and in WASM) no extension is reported.
+ */
+struct CpuFeatures {
+    // SSSE3 and SSE4.1: byte shuffles (pshufb) and blends (pblendw), used by the vectorised BLAKE2s compression
+    bool ssse3 = false;
+    bool sse4_1 = false;
+    // SHA-NI: the SHA-256 round and message schedule instructions
+    bool sha = false;
+    bool avx2 = false;
+    bool avx512f = false;
+};
+
+inline const CpuFeatures& get_cpu_features()
+{
+    static const CpuFeatures features = []() {
+        CpuFeatures result;
+#if defined(__x86_64__) && !defined(__wasm__)
+        __builtin_cpu_init();
+        result.ssse3 = __builtin_cpu_supports("ssse3") != 0;
+        result.sse4_1 = __builtin_cpu_supports("sse4.1") != 0;
+        // __builtin_cpu_supports also checks that the OS saves the wider registers
+        result.avx2 = __builtin_cpu_supports("avx2") != 0;
+        result.avx512f = __builtin_cpu_supports("avx512f") != 0;
+        unsigned int eax = 0;
+        unsigned int ebx = 0;
+        unsigned int ecx = 0;
+        unsigned int edx = 0;
+        if (__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx) != 0) {
+            result.sha = (ebx & (1U << 29)) != 0;
+        }
+#endif
+        return result;
+    }();
+    return features;
+}
+
+} // namespace bb
@@ -5,9 +5,34 @@
 #include <iostream>
 #include <sstream>
 #include <thread>
+#if defined(BB_USE_OP_COUNT_PERF) && defined(__linux__)
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <linux/perf_event.h>
+#include <mutex>
+#include <optional>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <vector>
+#endif
 
 namespace bb::detail {
 
+OpStats& OpStats::operator+=(const OpStats& other)
+{
+    count += other.count;
+    time += other.time;
+    cycles += other.cycles;
+    instructions += other.instructions;
+    cache_misses += other.cache_misses;
+    branch_misses += other.branch_misses;
+    memory_read_bytes += other.memory_read_bytes;
+    memory_write_bytes += other.memory_write_bytes;
+    return *this;
+}
+
 GlobalOpCountContainer::~GlobalOpCountContainer()
 {
     // This is useful for printing counts at the end of non-benchmarks.
@@ -55,10 +80,52 @@ std::map<std::string, std::size_t> GlobalOpCountContainer::get_aggregate_counts(
         if (entry.count->cycles > 0) {
             aggregate_counts[entry.key + "(c)"] += entry.count->cycles;
         }
+        if (entry.count->instructions > 0) {
+            aggregate_counts[entry.key + "(instructions)"] += entry.count->instructions;
+        }
+        if (entry.count->cache_misses > 0) {
+            aggregate_counts[entry.key + "(cache_misses)"] += entry.count->cache_misses;
+        }
+        if (entry.count->branch_misses > 0) {
+            aggregate_counts[entry.key + "(branch_misses)"] += entry.count->branch_misses;
+        }
+        if (entry.count->memory_read_bytes > 0) {
+            aggregate_counts[entry.key + "(memory_read_bytes)"] += entry.count->memory_read_bytes;
+        }
+        if (entry.count->memory_write_bytes > 0) {
+            aggregate_counts[entry.key + "(memory_write_bytes)"] += entry.count->memory_write_bytes;
+        }
     }
     return aggregate_counts;
 }
 
+std::map<std::string, OpStats> GlobalOpCountContainer::get_aggregate_stats() const
+{
+    std::map<std::string, OpStats> aggregate_stats;
+    for (const Entry& entry : counts) {
+        aggregate_stats[entry.key] += *entry.count;
+    }
+    return aggregate_stats;
+}
+
+void GlobalOpCountContainer::write_json(std::ostream& os) const
+{
+    os << "{";
+    bool first = true;
+    for (const auto& [key, stats] : get_aggregate_stats()) {
+        if (stats.count == 0 && stats.time == 0 && stats.cycles == 0) {
+            continue;
+        }
+        os << (first ? "\n" : ",\n") << "  \"" << key << "\": { \"count\": " << stats.count
+           << ", \"time_ns\": " << stats.time << ", \"cycles\": " << stats.cycles
+           << ", \"instructions\": " << stats.instructions << ", \"cache_misses\": " << stats.cache_misses
+           << ", \"branch_misses\": " << stats.branch_misses << ", \"memory_read_bytes\": " << stats.memory_read_bytes
+           << ", \"memory_write_bytes\": " << stats.memory_write_bytes << " }";
+        first = false;
+    }
+    os << "\n}\n";
+}
+
 void GlobalOpCountContainer::clear()
 {
     std::unique_lock<std::mutex> lock(mutex);
@@ -86,9 +153,248 @@ OpCountCycleReporter::~OpCountCycleReporter()
     stats->cycles += __builtin_ia32_rdtsc() - cycles;
 #endif
 }
+#ifdef BB_USE_OP_COUNT_PERF
+namespace {
+#ifdef __linux__
+int open_perf_event(perf_event_attr& attr, pid_t pid, int cpu, int group_fd)
+{
+    return static_cast<int>(syscall(SYS_perf_event_open, &attr, pid, cpu, group_fd, 0));
+}
+
+struct ThreadPerfCounters;
+
+/**
+ * @brief The core counters of every thread which has opened them.
+ * @details perf_event_open with pid 0 only counts the calling thread, so each thread opens counters of its own and
+ * snapshots sum them. The final counts of threads which have exited are kept in retired, so that snapshots never go
+ * backwards.
+ */
+struct PerfCounterRegistry {
+    std::mutex mutex;
+    std::vector<const ThreadPerfCounters*> threads;
+    PerfCounterSnapshot retired;
+
+    static PerfCounterRegistry& get()
+    {
+        // Never destroyed, as threads may exit after static destruction
+        static auto* registry = new PerfCounterRegistry();
+        return *registry;
+    }
+};
+
+/**
+ * @brief Core counters of one thread, opened as a group on first use so they are read atomically.
+ */
+// NOLINTNEXTLINE(cppcoreguidelines-special-member-functions)
+struct ThreadPerfCounters {
+    static constexpr std::array<uint64_t, 3> EVENTS = { PERF_COUNT_HW_INSTRUCTIONS,
+                                                        PERF_COUNT_HW_CACHE_MISSES,
+                                                        PERF_COUNT_HW_BRANCH_MISSES };
+    std::array<int, EVENTS.size()> fds{ -1, -1, -1 };
+
+    ThreadPerfCounters()
+    {
+        for (std::size_t i = 0; i < EVENTS.size(); ++i) {
+            perf_event_attr attr{};
+            attr.size = sizeof(attr);
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.config = EVENTS[i];
+            attr.read_format = PERF_FORMAT_GROUP;
+            // User space only, which an unprivileged process may count on itself
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            fds[i] = open_perf_event(attr, 0, -1, i == 0 ? -1 : fds[0]);
+            if (fds[i] < 0) {
+                // No PMU access (e.g. a VM or perf_event_paranoid); leave the counters at zero
+                close_all();
+                return;
+            }
+        }
+        auto& registry = PerfCounterRegistry::get();
+        std::unique_lock<std::mutex> lock(registry.mutex);
+        registry.threads.push_back(this);
+    }
+    ~ThreadPerfCounters()
+    {
+        if (fds[0] >= 0) {
+            auto& registry = PerfCounterRegistry::get();
+            std::unique_lock<std::mutex> lock(registry.mutex);
+            read(registry.retired);
+            std::erase(registry.threads, this);
+        }
+        close_all();
+    }
+
+    void close_all()
+    {
+        for (int& fd : fds) {
+            if (fd >= 0) {
+                close(fd);
+            }
+            fd = -1;
+        }
+    }
+
+    void read(PerfCounterSnapshot& snapshot) const
+    {
+        if (fds[0] < 0) {
+            return;
+        }
+        struct {
+            uint64_t nr;
+            std::array<uint64_t, EVENTS.size()> values;
+        } data{};
+        if (::read(fds[0], &data, sizeof(data)) != static_cast<ssize_t>(sizeof(data))) {
+            return;
+        }
+        snapshot.instructions += data.values[0];
+        snapshot.cache_misses += data.values[1];
+        snapshot.branch_misses += data.values[2];
+    }
+
+    static const ThreadPerfCounters& of_this_thread()
+    {
+        thread_local ThreadPerfCounters counters;
+        return counters;
+    }
+};
+
+/**
+ * @brief System-wide CAS counters of the memory controllers (Intel uncore_imc PMUs), when we are allowed to open them.
+ * @details These count all DRAM traffic, not just ours, so the bandwidth attributed to a label includes anything that
+ * ran concurrently with it, including other labels on other threads.
+ */
+// NOLINTNEXTLINE(cppcoreguidelines-special-member-functions)
+struct UncoreMemoryCounters {
+    static constexpr std::size_t BYTES_PER_CAS = 64;
+    std::vector<int> read_fds;
+    std::vector<int> write_fds;
+
+    UncoreMemoryCounters()
+    {
+        namespace fs = std::filesystem;
+        std::error_code ec;
+        for (const auto& device : fs::directory_iterator("/sys/bus/event_source/devices", ec)) {
+            if (device.path().filename().string().rfind("uncore_imc", 0) != 0) {
+                continue;
+            }
+            uint32_t type = 0;
+            int cpu = 0;
+            std::ifstream(device.path() / "type") >> type;
+            std::ifstream(device.path() / "cpumask") >> cpu;
+            open_cas_event(device.path() / "events" / "cas_count_read", type, cpu, read_fds);
+            open_cas_event(device.path() / "events" / "cas_count_write", type, cpu, write_fds);
+        }
+    }
+    ~UncoreMemoryCounters()
+    {
+        for (int fd : read_fds) {
+            close(fd);
+        }
+        for (int fd : write_fds) {
+            close(fd);
+        }
+    }
+
+    // Parse an event description of the form "event=0x04,umask=0x03"
+    static std::optional<uint64_t> parse_event_config(const std::filesystem::path& path)
+    {
+        std::ifstream file(path);
+        std::string description;
+        if (!(file >> description)) {
+            return std::nullopt;
+        }
+        uint64_t config = 0;
+        std::stringstream terms(description);
+        std::string term;
+        while (std::getline(terms, term, ',')) {
+            auto separator = term.find('=');
+            if (separator == std::string::npos) {
+                return std::nullopt;
+            }
+            const std::string name = term.substr(0, separator);
+            const uint64_t value = std::stoull(term.substr(separator + 1), nullptr, 0);
+            if (name == "event") {
+                config |= value;
+            } else if (name == "umask") {
+                config |= value << 8;
+            } else {
+                return std::nullopt;
+            }
+        }
+        return config;
+    }
+
+    static void open_cas_event(const std::filesystem::path& path, uint32_t type, int cpu, std::vector<int>& fds)
+    {
+        auto config = parse_event_config(path);
+        if (!config) {
+            return;
+        }
+        perf_event_attr attr{};
+        attr.size = sizeof(attr);
+        attr.type = type;
+        attr.config = *config;
+        int fd = open_perf_event(attr, -1, cpu, -1);
+        if (fd >= 0) {
+            fds.push_back(fd);
+        }
+    }
+
+    static std::size_t sum(const std::vector<int>& fds)
+    {
+        std::size_t total = 0;
+        for (int fd : fds) {
+            uint64_t value = 0;
+            if (::read(fd, &value, sizeof(value)) == static_cast<ssize_t>(sizeof(value))) {
+                total += value;
+            }
+        }
+        return total * BYTES_PER_CAS;
+    }
+
+    void read(PerfCounterSnapshot& snapshot) const
+    {
+        snapshot.memory_read_bytes = sum(read_fds);
+        snapshot.memory_write_bytes = sum(write_fds);
+    }
+};
+#endif
+} // namespace
+
+PerfCounterSnapshot read_perf_counters()
+{
+    PerfCounterSnapshot snapshot;
+#ifdef __linux__
+    open_thread_perf_counters();
+    {
+        auto& registry = PerfCounterRegistry::get();
+        std::unique_lock<std::mutex> lock(registry.mutex);
+        snapshot = registry.retired;
+        for (const auto* counters : registry.threads) {
+            counters->read(snapshot);
+        }
+    }
+    static UncoreMemoryCounters uncore_counters;
+    uncore_counters.read(snapshot);
+#endif
+    return snapshot;
+}
+
+void open_thread_perf_counters()
+{
+#ifdef __linux__
+    [[maybe_unused]] const auto& counters = ThreadPerfCounters::of_this_thread();
+#endif
+}
+#endif
+
 OpCountTimeReporter::OpCountTimeReporter(OpStats* stats)
     : stats(stats)
 {
+#ifdef BB_USE_OP_COUNT_PERF
+    perf = read_perf_counters();
+#endif
     auto now = std::chrono::high_resolution_clock::now();
     auto now_ns = std::chrono::time_point_cast<std::chrono::nanoseconds>(now);
     time = static_cast<std::size_t>(now_ns.time_since_epoch().count());
@@ -99,6 +405,14 @@ OpCountTimeReporter::~OpCountTimeReporter()
     auto now_ns = std::chrono::time_point_cast<std::chrono::nanoseconds>(now);
     stats->count += 1;
     stats->time += static_cast<std::size_t>(now_ns.time_since_epoch().count()) - time;
+#ifdef BB_USE_OP_COUNT_PERF
+    PerfCounterSnapshot end = read_perf_counters();
+    stats->instructions += end.instructions - perf.instructions;
+    stats->cache_misses += end.cache_misses - perf.cache_misses;
+    stats->branch_misses += end.branch_misses - perf.branch_misses;
+    stats->memory_read_bytes += end.memory_read_bytes - perf.memory_read_bytes;
+    stats->memory_write_bytes += end.memory_write_bytes - perf.memory_write_bytes;
+#endif
 }
 } // namespace bb::detail
 #endif
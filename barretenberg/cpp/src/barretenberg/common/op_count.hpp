@@ -20,12 +20,18 @@
 /**
  * Provides an abstraction that counts operations based on function names.
  * For efficiency, we spread out counts across threads.
+ *
+ * Building with BB_USE_OP_COUNT_PERF additionally samples hardware counters (Linux perf_event_open) around each
+ * BB_OP_COUNT_TIME scope: instructions, cache misses and branch misses, and memory controller traffic where the kernel
+ * exposes uncore IMC counters to us. Counters that cannot be opened read as zero. The core counters are summed over the
+ * calling thread and the parallel_for workers, so a scope counts whatever ran on them meanwhile, including other scopes.
  */
 
 #include "barretenberg/common/compiler_hints.hpp"
 #include <algorithm>
 #include <atomic>
 #include <cstdlib>
+#include <iosfwd>
 #include <map>
 #include <mutex>
 #include <string>
@@ -50,8 +56,30 @@ struct OpStats {
     std::size_t count = 0;
     std::size_t time = 0;
     std::size_t cycles = 0;
+    // Hardware counters, only collected with BB_USE_OP_COUNT_PERF
+    std::size_t instructions = 0;
+    std::size_t cache_misses = 0;
+    std::size_t branch_misses = 0;
+    std::size_t memory_read_bytes = 0;
+    std::size_t memory_write_bytes = 0;
+
+    OpStats& operator+=(const OpStats& other);
 };
 
+#ifdef BB_USE_OP_COUNT_PERF
+struct PerfCounterSnapshot {
+    std::size_t instructions = 0;
+    std::size_t cache_misses = 0;
+    std::size_t branch_misses = 0;
+    std::size_t memory_read_bytes = 0;
+    std::size_t memory_write_bytes = 0;
+};
+// Read the hardware counters of every thread which has opened them (and the system-wide memory controller counters)
+PerfCounterSnapshot read_perf_counters();
+// Open the hardware counters of the calling thread, if it has not yet done so; parallel_for calls this in its workers
+void open_thread_perf_counters();
+#endif
+
 // Contains all statically known op counts
 struct GlobalOpCountContainer {
   public:
@@ -68,6 +96,10 @@ struct GlobalOpCountContainer {
     void clear();
     void add_entry(const char* key, const std::shared_ptr<OpStats>& count);
     std::map<std::string, std::size_t> get_aggregate_counts() const;
+    // Stats per label, summed over threads
+    std::map<std::string, OpStats> get_aggregate_stats() const;
+    // Write the aggregate stats as a JSON object keyed by label
+    void write_json(std::ostream& os) const;
 };
 
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
@@ -138,6 +170,9 @@ struct OpCountCycleReporter {
 struct OpCountTimeReporter {
     OpStats* stats;
     std::size_t time;
+#ifdef BB_USE_OP_COUNT_PERF
+    PerfCounterSnapshot perf;
+#endif
     OpCountTimeReporter(OpStats* stats);
     ~OpCountTimeReporter();
 };
@@ -35,7 +35,8 @@ struct GoogleBenchOpCountReporter {
         if (cancelled) {
             return;
         }
-        // Intent: Collect results when we exit the state loop
+        // Intent: Collect results when we exit the state loop. These are user counters, so they end up in the JSON
+        // written by --benchmark_out alongside the timings, including the hardware counters with BB_USE_OP_COUNT_PERF.
         for (auto& entry : bb::detail::GLOBAL_OP_COUNTS.get_aggregate_counts()) {
             state.counters[entry.first] = static_cast<double>(entry.second);
         }
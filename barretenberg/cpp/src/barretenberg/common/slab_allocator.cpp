@@ -112,8 +112,8 @@ void SlabAllocator::init(size_t circuit_size_hint)
     // /* 0.5 MiB */ prealloc_num[base_size * 1] = 2;        // Batch invert skipped temporary.
     // /*   2 MiB */ prealloc_num[base_size * 4] = 4 +       // Composer base wire vectors.
     //                                             1;        // Miscellaneous.
-    // /*   6 MiB */ prealloc_num[base_size * 12] = 2 +      // next_var_index, prev_var_index
-    //                                              2;       // real_variable_index, real_variable_tags
+    // /*   6 MiB */ prealloc_num[base_size * 12] = 2 +      // variable_class_parent, variable_class_real_index
+    //                                              2;       // variable_class_rank, real_variable_tags
     /*  16 MiB */ prealloc_num[base_size * 32] = 11;      // Composer base selector vectors.
     /*  32 MiB */ prealloc_num[base_size * 32 * 2] = 1;   // Miscellaneous.
     /*  50 MiB */ prealloc_num[base_size * 32 * 3] = 1;   // Variables.
@@ -0,0 +1,134 @@
+#include "task_graph.hpp"
+#include "assert.hpp"
+#include "thread.hpp"
+
+#include <chrono>
+#if !defined(NO_MULTITHREADING) && !defined(NO_OMP_MULTITHREADING)
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <set>
+#include <thread>
+#define BB_TASK_GRAPH_CONCURRENT
+#endif
+
+namespace bb {
+
+namespace {
+uint64_t elapsed_ns(const std::chrono::steady_clock::time_point& start)
+{
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+}
+} // namespace
+
+size_t TaskGraph::add(std::function<void()> func, std::vector<size_t> dependencies)
+{
+    for (const size_t dependency : dependencies) {
+        ASSERT(dependency < tasks.size());
+    }
+    tasks.push_back({ std::move(func), std::move(dependencies) });
+    return tasks.size() - 1;
+}
+
+bool TaskGraph::runs_concurrently() const
+{
+#ifdef BB_TASK_GRAPH_CONCURRENT
+    return concurrent && max_concurrency > 1 && get_num_cpus() > 1;
+#else
+    return false;
+#endif
+}
+
+TaskGraph::Stats TaskGraph::run()
+{
+    Stats stats{ .name = name, .num_tasks = tasks.size() };
+    const auto start = std::chrono::steady_clock::now();
+
+    if (!runs_concurrently()) {
+        for (auto& task : tasks) {
+            const auto task_start = std::chrono::steady_clock::now();
+            task.func();
+            stats.busy_ns += elapsed_ns(task_start);
+        }
+        stats.wall_ns = elapsed_ns(start);
+        return stats;
+    }
+
+#ifdef BB_TASK_GRAPH_CONCURRENT
+    std::vector<size_t> num_pending_dependencies(tasks.size());
+    std::vector<std::vector<size_t>> dependents(tasks.size());
+    // Ready tasks start in the order in which they were added
+    std::set<size_t> ready;
+    for (size_t idx = 0; idx < tasks.size(); ++idx) {
+        num_pending_dependencies[idx] = tasks[idx].dependencies.size();
+        for (const size_t dependency : tasks[idx].dependencies) {
+            dependents[dependency].push_back(idx);
+        }
+        if (num_pending_dependencies[idx] == 0) {
+            ready.insert(idx);
+        }
+    }
+
+    std::mutex mutex;
+    std::condition_variable task_completed;
+    size_t num_running = 0;
+    size_t num_completed = 0;
+    // The exception thrown by the first task to fail, after which no further tasks are started
+    std::exception_ptr failure;
+    std::vector<std::thread> threads;
+    threads.reserve(tasks.size());
+
+    std::unique_lock<std::mutex> lock(mutex);
+    while (num_completed < tasks.size() && !(failure && num_running == 0)) {
+        while (!failure && !ready.empty() && num_running < max_concurrency) {
+            const size_t idx = *ready.begin();
+            ready.erase(ready.begin());
+            ++num_running;
+            threads.emplace_back([&, idx] {
+                const auto task_start = std::chrono::steady_clock::now();
+                std::exception_ptr task_failure;
+                try {
+                    tasks[idx].func();
+                } catch (...) {
+                    task_failure = std::current_exception();
+                }
+                const uint64_t task_ns = elapsed_ns(task_start);
+
+                std::unique_lock<std::mutex> task_lock(mutex);
+                stats.busy_ns += task_ns;
+                --num_running;
+                ++num_completed;
+                if (task_failure) {
+                    if (!failure) {
+                        failure = task_failure;
+                    }
+                } else {
+                    for (const size_t dependent : dependents[idx]) {
+                        if (--num_pending_dependencies[dependent] == 0) {
+                            ready.insert(dependent);
+                        }
+                    }
+                }
+                task_completed.notify_one();
+            });
+        }
+        task_completed.wait(lock, [&] {
+            return num_completed == tasks.size() || (failure && num_running == 0) ||
+                   (!failure && !ready.empty() && num_running < max_concurrency);
+        });
+    }
+    lock.unlock();
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    if (failure) {
+        std::rethrow_exception(failure);
+    }
+    stats.wall_ns = elapsed_ns(start);
+#endif
+    return stats;
+}
+
+} // namespace bb
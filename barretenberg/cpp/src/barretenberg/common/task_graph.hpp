@@ -0,0 +1,80 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace bb {
+
+/**
+ * @brief A stage of a prover expressed as a dependency graph of tasks, run with independent tasks overlapping
+ * @details Tasks are added in a topological order, i.e. each task may only depend on tasks added before it. Running the
+ * graph executes every task once all of its dependencies have completed, with up to max_concurrency tasks in flight on
+ * threads of their own; tasks may themselves call parallel_for. The graph imposes no order between independent tasks,
+ * so anything whose order matters (e.g. sending to a transcript) should happen after run() returns.
+ *
+ * Tasks run one at a time, in the order in which they were added, if the graph is not concurrent, if multithreading is
+ * disabled, or if parallel_for uses the (non-reentrant) mutex pool backend.
+ *
+ * Each concurrent task runs on a thread of its own, and a parallel_for within it opens an OpenMP team of its own, so up
+ * to max_concurrency times as many threads as there are cores may be runnable at once. The overlap pays off when tasks
+ * leave cores idle (serial sections, memory-bound phases), and should be turned off where it does not.
+ *
+ * If a task throws, no further tasks are started, and run() rethrows the first exception once the tasks in flight have
+ * completed.
+ */
+class TaskGraph {
+  public:
+    static constexpr size_t DEFAULT_MAX_CONCURRENCY = 4;
+
+    struct Stats {
+        std::string name;
+        size_t num_tasks = 0;
+        // Duration of the stage
+        uint64_t wall_ns = 0;
+        // Sum of the durations of its tasks
+        uint64_t busy_ns = 0;
+
+        // The average number of tasks in flight, i.e. 1 if the tasks ran one at a time
+        double overlap() const
+        {
+            return wall_ns == 0 ? 1.0 : static_cast<double>(busy_ns) / static_cast<double>(wall_ns);
+        }
+    };
+
+    explicit TaskGraph(std::string name, bool concurrent = true, size_t max_concurrency = DEFAULT_MAX_CONCURRENCY)
+        : name(std::move(name))
+        , concurrent(concurrent)
+        , max_concurrency(max_concurrency)
+    {}
+
+    /**
+     * @brief Add a task to the graph
+     *
+     * @param func the work of the task
+     * @param dependencies indices (as returned by add) of the tasks which must complete before this one starts
+     * @return size_t the index of the task
+     */
+    size_t add(std::function<void()> func, std::vector<size_t> dependencies = {});
+
+    // Whether tasks may run at the same time, e.g. so that they must not share mutable scratch space
+    bool runs_concurrently() const;
+
+    // Run all tasks, rethrowing the first exception thrown by any of them
+    Stats run();
+
+  private:
+    struct Task {
+        std::function<void()> func;
+        std::vector<size_t> dependencies;
+    };
+
+    std::string name;
+    bool concurrent;
+    size_t max_concurrency;
+    std::vector<Task> tasks;
+};
+
+} // namespace bb
@@ -1,5 +1,6 @@
 #include "thread.hpp"
 #include "log.hpp"
+#include "op_count.hpp"
 
 /**
  * There's a lot to talk about here. To bring threading to WASM, parallel_for was written to replace the OpenMP loops
@@ -71,18 +72,28 @@ void parallel_for_mutex_pool(size_t num_iterations, const std::function<void(siz
 
 void parallel_for(size_t num_iterations, const std::function<void(size_t)>& func)
 {
+#if defined(BB_USE_OP_COUNT) && defined(BB_USE_OP_COUNT_PERF)
+    // Each worker counts its own instructions, so it opens its counters before running any iteration. An op count
+    // scope around this loop then counts the work of the workers as well as that of the calling thread.
+    const std::function<void(size_t)> counted_func = [&func](size_t i) {
+        detail::open_thread_perf_counters();
+        func(i);
+    };
+#else
+    const auto& counted_func = func;
+#endif
 #ifdef NO_MULTITHREADING
     for (size_t i = 0; i < num_iterations; ++i) {
-        func(i);
+        counted_func(i);
     }
 #else
 #ifndef NO_OMP_MULTITHREADING
-    parallel_for_omp(num_iterations, func);
+    parallel_for_omp(num_iterations, counted_func);
 #else
     // parallel_for_spawning(num_iterations, func);
     // parallel_for_moody(num_iterations, func);
     // parallel_for_atomic_pool(num_iterations, func);
-    parallel_for_mutex_pool(num_iterations, func);
+    parallel_for_mutex_pool(num_iterations, counted_func);
     // parallel_for_queued(num_iterations, func);
 #endif
 #endif
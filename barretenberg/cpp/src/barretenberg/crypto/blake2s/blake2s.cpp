@@ -17,15 +17,20 @@
 #include <cstdio>
 #include <cstring>
 
+#include "barretenberg/common/cpu_features.hpp"
 #include "blake2-impl.hpp"
 #include "blake2s.hpp"
 
+#if defined(__x86_64__) && !defined(__wasm__)
+#define BB_BLAKE2S_X86_KERNELS
+#endif
+
 namespace bb::crypto {
 
 static const uint32_t blake2s_IV[8] = { 0x6A09E667UL, 0xBB67AE85UL, 0x3C6EF372UL, 0xA54FF53AUL,
                                         0x510E527FUL, 0x9B05688CUL, 0x1F83D9ABUL, 0x5BE0CD19UL };
 
-static const uint8_t blake2s_sigma[10][16] = {
+static constexpr uint8_t blake2s_sigma[10][16] = {
     { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 }, { 14, 10, 4, 8, 9, 15, 13, 6, 1, 12, 0, 2, 11, 7, 5, 3 },
     { 11, 8, 12, 0, 5, 2, 15, 13, 10, 14, 3, 6, 7, 1, 9, 4 }, { 7, 9, 3, 1, 13, 12, 11, 14, 2, 6, 5, 10, 4, 0, 15, 8 },
     { 9, 0, 5, 7, 2, 4, 10, 15, 14, 1, 11, 12, 6, 8, 3, 13 }, { 2, 12, 6, 10, 0, 11, 8, 3, 4, 13, 7, 5, 15, 14, 1, 9 },
@@ -131,7 +136,7 @@ int blake2s_init(blake2s_state* S, size_t outlen)
         G(r, 7, v[3], v[4], v[9], v[14]);                                                                              \
     } while (0)
 
-static void blake2s_compress(blake2s_state* S, const uint8_t in[BLAKE2S_BLOCKBYTES])
+static void blake2s_compress_portable(blake2s_state* S, const uint8_t in[BLAKE2S_BLOCKBYTES])
 {
     uint32_t m[16];
     uint32_t v[16];
@@ -170,6 +175,126 @@ static void blake2s_compress(blake2s_state* S, const uint8_t in[BLAKE2S_BLOCKBYT
     }
 }
 
+#ifdef BB_BLAKE2S_X86_KERNELS
+/*
+   Vectorised compression: the 4x4 state matrix is held as four row vectors, so that each G step updates all four
+   columns (or, after rotating rows 2 to 4, all four diagonals) at once. This relies on byte and dword shuffles
+   (pshufb, pblendw) being cheap, so it is only used if the CPU has SSSE3 and SSE4.1; it is slower than the scalar
+   code with plain SSE2. The helpers below are always inlined into it, and so compiled for its target.
+*/
+typedef uint32_t blake2s_row __attribute__((vector_size(16)));
+typedef uint32_t blake2s_block __attribute__((vector_size(64)));
+
+typedef uint8_t blake2s_row_bytes __attribute__((vector_size(16)));
+
+static inline __attribute__((always_inline)) blake2s_row blake2s_rotr(const blake2s_row x, const int c)
+{
+    return (x >> c) | (x << (32 - c));
+}
+
+/* Rotations by whole bytes are byte shuffles, which are cheaper than two shifts and an or */
+static inline __attribute__((always_inline)) blake2s_row blake2s_rotr16(const blake2s_row x)
+{
+    const auto bytes = (blake2s_row_bytes)x;
+    return (blake2s_row)__builtin_shufflevector(bytes, bytes, 2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13);
+}
+
+static inline __attribute__((always_inline)) blake2s_row blake2s_rotr8(const blake2s_row x)
+{
+    const auto bytes = (blake2s_row_bytes)x;
+    return (blake2s_row)__builtin_shufflevector(bytes, bytes, 1, 2, 3, 0, 5, 6, 7, 4, 9, 10, 11, 8, 13, 14, 15, 12);
+}
+
+#define G_ROWS(row1, row2, row3, row4, mx, my)                                                                         \
+    do {                                                                                                               \
+        row1 = row1 + row2 + mx;                                                                                       \
+        row4 = blake2s_rotr16(row4 ^ row1);                                                                            \
+        row3 = row3 + row4;                                                                                            \
+        row2 = blake2s_rotr(row2 ^ row3, 12);                                                                          \
+        row1 = row1 + row2 + my;                                                                                       \
+        row4 = blake2s_rotr8(row4 ^ row1);                                                                             \
+        row3 = row3 + row4;                                                                                            \
+        row2 = blake2s_rotr(row2 ^ row3, 7);                                                                           \
+    } while (0)
+
+/* One round; the message words for each G step are picked out of the block with (constant) vector shuffles */
+template <size_t r>
+static inline __attribute__((always_inline)) void blake2s_round_rows(
+    blake2s_row& row1, blake2s_row& row2, blake2s_row& row3, blake2s_row& row4, const blake2s_block& m)
+{
+    constexpr const uint8_t* s = blake2s_sigma[r];
+    /* Columns */
+    G_ROWS(row1,
+           row2,
+           row3,
+           row4,
+           __builtin_shufflevector(m, m, s[0], s[2], s[4], s[6]),
+           __builtin_shufflevector(m, m, s[1], s[3], s[5], s[7]));
+    /* Diagonals: rotate rows 2, 3, 4 left by 1, 2, 3 lanes */
+    row2 = __builtin_shufflevector(row2, row2, 1, 2, 3, 0);
+    row3 = __builtin_shufflevector(row3, row3, 2, 3, 0, 1);
+    row4 = __builtin_shufflevector(row4, row4, 3, 0, 1, 2);
+    G_ROWS(row1,
+           row2,
+           row3,
+           row4,
+           __builtin_shufflevector(m, m, s[8], s[10], s[12], s[14]),
+           __builtin_shufflevector(m, m, s[9], s[11], s[13], s[15]));
+    row2 = __builtin_shufflevector(row2, row2, 3, 0, 1, 2);
+    row3 = __builtin_shufflevector(row3, row3, 2, 3, 0, 1);
+    row4 = __builtin_shufflevector(row4, row4, 1, 2, 3, 0);
+}
+
+__attribute__((target("ssse3,sse4.1"))) static void blake2s_compress_rows(blake2s_state* S,
+                                                                        const uint8_t in[BLAKE2S_BLOCKBYTES])
+{
+    /* The block is read as 16 little-endian words, which is the native order on x86 */
+    blake2s_block m;
+    memcpy(&m, in, sizeof(m));
+
+    blake2s_row row1 = { S->h[0], S->h[1], S->h[2], S->h[3] };
+    blake2s_row row2 = { S->h[4], S->h[5], S->h[6], S->h[7] };
+    blake2s_row row3 = { blake2s_IV[0], blake2s_IV[1], blake2s_IV[2], blake2s_IV[3] };
+    blake2s_row row4 = {
+        S->t[0] ^ blake2s_IV[4], S->t[1] ^ blake2s_IV[5], S->f[0] ^ blake2s_IV[6], S->f[1] ^ blake2s_IV[7]
+    };
+    const blake2s_row h_lo = row1;
+    const blake2s_row h_hi = row2;
+
+    blake2s_round_rows<0>(row1, row2, row3, row4, m);
+    blake2s_round_rows<1>(row1, row2, row3, row4, m);
+    blake2s_round_rows<2>(row1, row2, row3, row4, m);
+    blake2s_round_rows<3>(row1, row2, row3, row4, m);
+    blake2s_round_rows<4>(row1, row2, row3, row4, m);
+    blake2s_round_rows<5>(row1, row2, row3, row4, m);
+    blake2s_round_rows<6>(row1, row2, row3, row4, m);
+    blake2s_round_rows<7>(row1, row2, row3, row4, m);
+    blake2s_round_rows<8>(row1, row2, row3, row4, m);
+    blake2s_round_rows<9>(row1, row2, row3, row4, m);
+
+    const blake2s_row out_lo = h_lo ^ row1 ^ row3;
+    const blake2s_row out_hi = h_hi ^ row2 ^ row4;
+    for (size_t i = 0; i < 4; ++i) {
+        S->h[i] = out_lo[i];
+        S->h[i + 4] = out_hi[i];
+    }
+}
+
+#undef G_ROWS
+#endif
+
+static void blake2s_compress(blake2s_state* S, const uint8_t in[BLAKE2S_BLOCKBYTES])
+{
+#ifdef BB_BLAKE2S_X86_KERNELS
+    static const auto compress_fn = (bb::get_cpu_features().ssse3 && bb::get_cpu_features().sse4_1)
+                                        ? &blake2s_compress_rows
+                                        : &blake2s_compress_portable;
+    compress_fn(S, in);
+#else
+    blake2s_compress_portable(S, in);
+#endif
+}
+
 #undef G
 #undef ROUND
 
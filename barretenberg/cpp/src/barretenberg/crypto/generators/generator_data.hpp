@@ -5,6 +5,7 @@
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
 #include <array>
 #include <map>
+#include <mutex>
 #include <optional>
 
 namespace bb::crypto {
@@ -30,10 +31,8 @@ namespace bb::crypto {
  *          context") should default to using `default_data`.
  *
  *          Q: Why make the generator context an input parameter when it defaults to `default_data`?
- *          A: This is not thread-safe. Each process that uses a `generator_data` object may extend `generator_data` if
- *             more generators are required.
- *             i.e. either each process must use an independent `generator_data` object or the author must KNOW that
- *             `generator_data` will not be extended by any process
+ *          A: So that a process can use generators independent of any other. `get` may be called concurrently (e.g. by
+ *             circuits built in parallel), and the views it returns remain valid when the map is later extended.
  *
  * @tparam Curve
  */
@@ -71,6 +70,7 @@ template <typename Curve> class generator_data {
             return GeneratorView{ precomputed_generators.data() + generator_offset, num_generators };
         }
 
+        std::lock_guard<std::mutex> lock(mutex);
         if (!generator_map.has_value()) {
             generator_map = std::map<std::string, GeneratorList>();
         }
@@ -94,13 +94,21 @@ template <typename Curve> class generator_data {
 
         GeneratorList& generators = map.at(std::string(domain_separator));
 
-        // If the current GeneratorList does not contain enough generators, extend it
+        // If the current GeneratorList does not contain enough generators, extend it. Views of the current list may be
+        // held by other callers, so rather than growing it in place we replace it with an extended copy and retire it.
         if (num_generators + generator_offset > generators.size()) {
             const size_t num_extra_generators = num_generators + generator_offset - generators.size();
             GeneratorList extended_generators =
                 Group::derive_generators(domain_separator, num_extra_generators, generators.size());
-            generators.reserve(num_generators + generator_offset);
-            std::copy(extended_generators.begin(), extended_generators.end(), std::back_inserter(generators));
+            GeneratorList new_generators;
+            new_generators.reserve(num_generators + generator_offset);
+            std::copy(generators.begin(), generators.end(), std::back_inserter(new_generators));
+            std::copy(extended_generators.begin(), extended_generators.end(), std::back_inserter(new_generators));
+            if (!retired_generator_lists.has_value()) {
+                retired_generator_lists = std::vector<GeneratorList>();
+            }
+            retired_generator_lists->emplace_back(std::move(generators));
+            generators = std::move(new_generators);
         }
 
         return GeneratorView{ generators.data() + generator_offset, num_generators };
@@ -128,6 +136,12 @@ template <typename Curve> class generator_data {
     // We wrap the std::map in a `std::optional` so that we can construct `generator_data` at compile time.
     // This allows us to mark `default_data` as `constinit`, which prevents static initialization ordering fiasco
     mutable std::optional<std::map<std::string, GeneratorList>> generator_map = {};
+
+    // Lists replaced by longer ones, kept alive since views of them may still be in use
+    mutable std::optional<std::vector<GeneratorList>> retired_generator_lists = {};
+
+    // Guards generator_map, initialized_precomputed_generators and retired_generator_lists
+    mutable std::mutex mutex;
 };
 
 template <typename Curve> struct GeneratorContext {
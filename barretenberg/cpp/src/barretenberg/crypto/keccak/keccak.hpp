@@ -29,8 +29,24 @@ extern "C" {
  */
 void ethash_keccakf1600(uint64_t state[25]) NOEXCEPT;
 
+/**
+ * The Keccak-f[1600] function applied to 4 (resp. 8) independent states at once, in the lanes of AVX2 (resp.
+ * AVX-512) registers. Only call these if the CPU supports the corresponding extension (see bb::get_cpu_features).
+ */
+void ethash_keccakf1600_x4(uint64_t states[4][25]) NOEXCEPT;
+void ethash_keccakf1600_x8(uint64_t states[8][25]) NOEXCEPT;
+
 struct keccak256 ethash_keccak256(const uint8_t* data, size_t size) NOEXCEPT;
 
+/**
+ * Computes the Keccak-256 hashes of num_inputs independent messages, the i-th of which is sizes[i] bytes at data[i].
+ * Several messages are hashed at once with the multi-lane permutations, if the CPU supports them.
+ */
+void ethash_keccak256_batch(const uint8_t* const* data,
+                            const size_t* sizes,
+                            size_t num_inputs,
+                            struct keccak256* out) NOEXCEPT;
+
 struct keccak256 hash_field_elements(const uint64_t* limbs, size_t num_elements);
 
 struct keccak256 hash_field_element(const uint64_t* limb);
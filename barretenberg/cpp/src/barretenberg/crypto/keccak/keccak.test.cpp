@@ -0,0 +1,94 @@
+#include "keccak.hpp"
+#include "barretenberg/common/cpu_features.hpp"
+
+#include <array>
+#include <cstring>
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+namespace {
+std::mt19937_64 engine(0);
+
+std::array<uint8_t, 32> to_bytes(const keccak256& hash)
+{
+    std::array<uint8_t, 32> result;
+    std::memcpy(result.data(), hash.word64s, 32);
+    return result;
+}
+
+std::vector<uint8_t> random_message(const size_t size)
+{
+    std::vector<uint8_t> message(size);
+    for (auto& byte : message) {
+        byte = static_cast<uint8_t>(engine());
+    }
+    return message;
+}
+} // namespace
+
+TEST(keccak, known_answers)
+{
+    const std::array<uint8_t, 32> empty_hash{ 0xc5, 0xd2, 0x46, 0x01, 0x86, 0xf7, 0x23, 0x3c, 0x92, 0x7e, 0x7d,
+                                              0xb2, 0xdc, 0xc7, 0x03, 0xc0, 0xe5, 0x00, 0xb6, 0x53, 0xca, 0x82,
+                                              0x27, 0x3b, 0x7b, 0xfa, 0xd8, 0x04, 0x5d, 0x85, 0xa4, 0x70 };
+    EXPECT_EQ(to_bytes(ethash_keccak256(nullptr, 0)), empty_hash);
+
+    const std::string abc = "abc";
+    const std::array<uint8_t, 32> abc_hash{ 0x4e, 0x03, 0x65, 0x7a, 0xea, 0x45, 0xa9, 0x4f, 0xc7, 0xd4, 0x7b,
+                                            0xa8, 0x26, 0xc8, 0xd6, 0x67, 0xc0, 0xd1, 0xe6, 0xe3, 0x3a, 0x64,
+                                            0xa0, 0x36, 0xec, 0x44, 0xf5, 0x8f, 0xa1, 0x2d, 0x6c, 0x45 };
+    EXPECT_EQ(to_bytes(ethash_keccak256(reinterpret_cast<const uint8_t*>(abc.data()), abc.size())), abc_hash);
+}
+
+TEST(keccak, multi_lane_permutation)
+{
+    const auto& features = bb::get_cpu_features();
+    uint64_t inputs[8][25];
+    uint64_t expected[8][25];
+    for (size_t lane = 0; lane < 8; ++lane) {
+        for (size_t i = 0; i < 25; ++i) {
+            inputs[lane][i] = engine();
+        }
+        std::memcpy(expected[lane], inputs[lane], sizeof(inputs[lane]));
+        ethash_keccakf1600(expected[lane]);
+    }
+    if (features.avx2) {
+        uint64_t states[8][25];
+        std::memcpy(states, inputs, sizeof(inputs));
+        ethash_keccakf1600_x4(states);
+        ethash_keccakf1600_x4(states + 4);
+        EXPECT_EQ(std::memcmp(states, expected, sizeof(states)), 0);
+    }
+    if (features.avx512f) {
+        uint64_t states[8][25];
+        std::memcpy(states, inputs, sizeof(inputs));
+        ethash_keccakf1600_x8(states);
+        EXPECT_EQ(std::memcmp(states, expected, sizeof(states)), 0);
+    }
+}
+
+TEST(keccak, batch_matches_single)
+{
+    // Sizes around the 136-byte block boundaries, several messages of each, in no particular order
+    std::vector<size_t> sizes;
+    for (size_t repeat = 0; repeat < 5; ++repeat) {
+        for (const size_t size : std::vector<size_t>{ 0, 1, 32, 64, 135, 136, 137, 271, 272, 273, 1000 }) {
+            sizes.push_back(size);
+        }
+    }
+    std::vector<std::vector<uint8_t>> messages;
+    std::vector<const uint8_t*> data;
+    for (size_t size : sizes) {
+        messages.push_back(random_message(size));
+    }
+    for (const auto& message : messages) {
+        data.push_back(message.data());
+    }
+
+    std::vector<keccak256> hashes(messages.size());
+    ethash_keccak256_batch(data.data(), sizes.data(), messages.size(), hashes.data());
+    for (size_t i = 0; i < messages.size(); ++i) {
+        EXPECT_EQ(to_bytes(hashes[i]), to_bytes(ethash_keccak256(data[i], sizes[i])));
+    }
+}
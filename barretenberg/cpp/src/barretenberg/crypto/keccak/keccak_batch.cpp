@@ -0,0 +1,100 @@
+#include "keccak.hpp"
+
+#include "barretenberg/common/cpu_features.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+#include <vector>
+
+namespace {
+
+// The rate of Keccak-256, i.e. the number of message bytes absorbed per permutation
+constexpr size_t BLOCK_SIZE = 136;
+constexpr size_t BLOCK_WORDS = BLOCK_SIZE / sizeof(uint64_t);
+constexpr size_t MAX_LANES = 8;
+
+// The padding always adds at least one byte, so an empty final block is absorbed when the size is a multiple of 136
+size_t get_num_blocks(const size_t size)
+{
+    return size / BLOCK_SIZE + 1;
+}
+
+// The final block of a message: its remaining bytes followed by the Keccak padding 0x01 0x00 ... 0x80
+void pad_last_block(uint8_t* out, const uint8_t* data, const size_t size)
+{
+    const size_t remaining = size % BLOCK_SIZE;
+    std::memset(out, 0, BLOCK_SIZE);
+    if (remaining > 0) {
+        std::memcpy(out, data + size - remaining, remaining);
+    }
+    out[remaining] ^= 0x01;
+    out[BLOCK_SIZE - 1] ^= 0x80;
+}
+
+} // namespace
+
+/**
+ * @details Messages are sorted by their number of blocks and hashed in groups of 8 (AVX-512) or 4 (AVX2) messages with
+ * the same number of blocks, one message per lane of the permutation. Lanes left over in the last group of a size
+ * repeat one of its messages. The SIMD kernels are only selected on x86-64, so words are loaded in native
+ * (little-endian) order there.
+ */
+void ethash_keccak256_batch(const uint8_t* const* data,
+                            const size_t* sizes,
+                            const size_t num_inputs,
+                            struct keccak256* out) NOEXCEPT
+{
+    const auto& features = bb::get_cpu_features();
+    const size_t num_lanes = features.avx512f ? 8 : (features.avx2 ? 4 : 1);
+    if (num_lanes == 1) {
+        for (size_t i = 0; i < num_inputs; ++i) {
+            out[i] = ethash_keccak256(data[i], sizes[i]);
+        }
+        return;
+    }
+
+    std::vector<size_t> order(num_inputs);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+        return get_num_blocks(sizes[a]) < get_num_blocks(sizes[b]);
+    });
+
+    for (size_t start = 0; start < num_inputs;) {
+        const size_t num_blocks = get_num_blocks(sizes[order[start]]);
+        size_t end = start + 1;
+        while (end < num_inputs && end - start < num_lanes && get_num_blocks(sizes[order[end]]) == num_blocks) {
+            ++end;
+        }
+
+        uint64_t states[MAX_LANES][25] = {};
+        uint8_t last_blocks[MAX_LANES][BLOCK_SIZE];
+        size_t inputs[MAX_LANES];
+        for (size_t lane = 0; lane < num_lanes; ++lane) {
+            inputs[lane] = order[std::min(start + lane, end - 1)];
+            pad_last_block(last_blocks[lane], data[inputs[lane]], sizes[inputs[lane]]);
+        }
+
+        for (size_t block = 0; block < num_blocks; ++block) {
+            for (size_t lane = 0; lane < num_lanes; ++lane) {
+                const uint8_t* block_data =
+                    (block + 1 < num_blocks) ? data[inputs[lane]] + block * BLOCK_SIZE : last_blocks[lane];
+                for (size_t i = 0; i < BLOCK_WORDS; ++i) {
+                    uint64_t word = 0;
+                    std::memcpy(&word, block_data + i * sizeof(uint64_t), sizeof(uint64_t));
+                    states[lane][i] ^= word;
+                }
+            }
+            if (num_lanes == 8) {
+                ethash_keccakf1600_x8(states);
+            } else {
+                ethash_keccakf1600_x4(states);
+            }
+        }
+
+        for (size_t lane = 0; lane < end - start; ++lane) {
+            std::memcpy(out[inputs[lane]].word64s, states[lane], sizeof(keccak256));
+        }
+        start = end;
+    }
+}
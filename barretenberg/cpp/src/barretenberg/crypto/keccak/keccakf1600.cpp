@@ -6,10 +6,13 @@
 #include "keccak.hpp"
 #include <stdint.h>
 
-static uint64_t rol(uint64_t x, unsigned s)
-{
-    return (x << s) | (x >> (64 - s));
-}
+#if defined(__x86_64__) && !defined(__wasm__)
+#define BB_KECCAK_X86_KERNELS
+#endif
+
+/* A macro rather than a function template, since returning a vector wider than the baseline target of this file from a
+   function would depend on an ABI that is only defined when the wider registers are enabled (-Wpsabi). */
+#define rol(x, s) (((x) << (s)) | ((x) >> (64 - (s))))
 
 static const uint64_t round_constants[24] = {
     0x0000000000000001, 0x0000000000008082, 0x800000000000808a, 0x8000000080008000, 0x000000000000808b,
@@ -19,27 +22,29 @@ static const uint64_t round_constants[24] = {
     0x8000000080008081, 0x8000000000008080, 0x0000000080000001, 0x8000000080008008,
 };
 
-void ethash_keccakf1600(uint64_t state[25]) NOEXCEPT
+/* The permutation is written for a word type T that is either uint64_t or a vector of them. With a vector type every
+   lane permutes an independent state, and the code is compiled into vector instructions of the caller's target. */
+template <typename T> static inline __attribute__((always_inline)) void keccakf1600(T state[25])
 {
     /* The implementation based on the "simple" implementation by Ronny Van Keer. */
 
     int round;
 
-    uint64_t Aba, Abe, Abi, Abo, Abu;
-    uint64_t Aga, Age, Agi, Ago, Agu;
-    uint64_t Aka, Ake, Aki, Ako, Aku;
-    uint64_t Ama, Ame, Ami, Amo, Amu;
-    uint64_t Asa, Ase, Asi, Aso, Asu;
+    T Aba, Abe, Abi, Abo, Abu;
+    T Aga, Age, Agi, Ago, Agu;
+    T Aka, Ake, Aki, Ako, Aku;
+    T Ama, Ame, Ami, Amo, Amu;
+    T Asa, Ase, Asi, Aso, Asu;
 
-    uint64_t Eba, Ebe, Ebi, Ebo, Ebu;
-    uint64_t Ega, Ege, Egi, Ego, Egu;
-    uint64_t Eka, Eke, Eki, Eko, Eku;
-    uint64_t Ema, Eme, Emi, Emo, Emu;
-    uint64_t Esa, Ese, Esi, Eso, Esu;
+    T Eba, Ebe, Ebi, Ebo, Ebu;
+    T Ega, Ege, Egi, Ego, Egu;
+    T Eka, Eke, Eki, Eko, Eku;
+    T Ema, Eme, Emi, Emo, Emu;
+    T Esa, Ese, Esi, Eso, Esu;
 
-    uint64_t Ba, Be, Bi, Bo, Bu;
+    T Ba, Be, Bi, Bo, Bu;
 
-    uint64_t Da, De, Di, Do, Du;
+    T Da, De, Di, Do, Du;
 
     Aba = state[0];
     Abe = state[1];
@@ -233,3 +238,58 @@ void ethash_keccakf1600(uint64_t state[25]) NOEXCEPT
     state[23] = Aso;
     state[24] = Asu;
 }
+
+#undef rol
+
+void ethash_keccakf1600(uint64_t state[25]) NOEXCEPT
+{
+    keccakf1600(state);
+}
+
+#ifdef BB_KECCAK_X86_KERNELS
+
+/* Transposes the states so that vector i holds word i of every lane, permutes them and transposes them back. */
+template <typename Vector, size_t NUM_LANES>
+static inline __attribute__((always_inline)) void keccakf1600_lanes(uint64_t states[][25])
+{
+    Vector lanes[25];
+    for (size_t i = 0; i < 25; ++i) {
+        for (size_t lane = 0; lane < NUM_LANES; ++lane) {
+            lanes[i][lane] = states[lane][i];
+        }
+    }
+    keccakf1600(lanes);
+    for (size_t i = 0; i < 25; ++i) {
+        for (size_t lane = 0; lane < NUM_LANES; ++lane) {
+            states[lane][i] = lanes[i][lane];
+        }
+    }
+}
+
+__attribute__((target("avx2"))) void ethash_keccakf1600_x4(uint64_t states[4][25]) NOEXCEPT
+{
+    typedef uint64_t Vector __attribute__((vector_size(32)));
+    keccakf1600_lanes<Vector, 4>(states);
+}
+
+__attribute__((target("avx512f"))) void ethash_keccakf1600_x8(uint64_t states[8][25]) NOEXCEPT
+{
+    typedef uint64_t Vector __attribute__((vector_size(64)));
+    keccakf1600_lanes<Vector, 8>(states);
+}
+
+#else
+
+void ethash_keccakf1600_x4(uint64_t states[4][25]) NOEXCEPT
+{
+    for (size_t lane = 0; lane < 4; ++lane)
+        keccakf1600(states[lane]);
+}
+
+void ethash_keccakf1600_x8(uint64_t states[8][25]) NOEXCEPT
+{
+    for (size_t lane = 0; lane < 8; ++lane)
+        keccakf1600(states[lane]);
+}
+
+#endif
@@ -134,13 +134,17 @@ fr AppendOnlyTree<Store, HashingPolicy>::add_values(const std::vector<fr>& value
         write_node(level, index + i, hashes[i]);
     }
 
-    // Hash the values as a sub tree and insert them
+    // Hash the values as a sub tree and insert them. Each level is hashed in bulk into a second buffer, the two buffers
+    // are then swapped so that the new level becomes the input to the next
+    std::vector<fr> parents(number_to_insert / 2);
     while (number_to_insert > 1) {
         number_to_insert >>= 1;
         index >>= 1;
         --level;
+        HashingPolicy::hash_level(std::span<const fr>(hashes.data(), number_to_insert * 2),
+                                  std::span<fr>(parents.data(), number_to_insert));
+        std::swap(hashes, parents);
         for (size_t i = 0; i < number_to_insert; ++i) {
-            hashes[i] = HashingPolicy::hash_pair(hashes[i * 2], hashes[i * 2 + 1]);
             write_node(level, index + i, hashes[i]);
         }
     }
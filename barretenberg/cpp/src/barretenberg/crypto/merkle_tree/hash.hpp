@@ -1,5 +1,6 @@
 #pragma once
 #include "barretenberg/common/net.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/crypto/blake2s/blake2s.hpp"
 #include "barretenberg/crypto/pedersen_commitment/pedersen.hpp"
 #include "barretenberg/crypto/pedersen_hash/pedersen.hpp"
@@ -7,32 +8,74 @@
 #include "barretenberg/stdlib/hash/blake2s/blake2s.hpp"
 #include "barretenberg/stdlib/hash/pedersen/pedersen.hpp"
 #include "barretenberg/stdlib/primitives/field/field.hpp"
+#include <array>
+#include <span>
 #include <vector>
 
 namespace bb::crypto::merkle_tree {
 
+/**
+ * @brief Hashes every adjacent pair of `children` into `parents`, i.e. parents[i] = hash_pair(children[2i],
+ * children[2i+1]). Large levels are split across threads. `parents` must not alias `children`.
+ */
+template <typename HashingPolicy>
+inline void hash_level_parallel(std::span<const fr> children,
+                                std::span<fr> parents,
+                                size_t finite_field_multiplications_per_hash,
+                                size_t scalar_multiplications_per_hash)
+{
+    ASSERT(children.size() == parents.size() * 2);
+    run_loop_in_parallel_if_effective(
+        parents.size(),
+        [&](size_t start, size_t end) {
+            for (size_t i = start; i < end; ++i) {
+                parents[i] = HashingPolicy::hash_pair(children[i * 2], children[i * 2 + 1]);
+            }
+        },
+        /*finite_field_additions_per_iteration=*/0,
+        finite_field_multiplications_per_hash,
+        /*finite_field_inversions_per_iteration=*/0,
+        /*group_element_additions_per_iteration=*/0,
+        /*group_element_doublings_per_iteration=*/0,
+        scalar_multiplications_per_hash);
+}
+
 struct PedersenHashPolicy {
     static fr hash(const std::vector<fr>& inputs) { return crypto::pedersen_hash::hash(inputs); }
 
-    static fr hash_pair(const fr& lhs, const fr& rhs) { return hash(std::vector<fr>({ lhs, rhs })); }
+    template <size_t N> static fr hash(const std::array<fr, N>& inputs) { return crypto::pedersen_hash::hash(inputs); }
+
+    static fr hash_pair(const fr& lhs, const fr& rhs) { return hash(std::array<fr, 2>{ lhs, rhs }); }
+
+    static void hash_level(std::span<const fr> children, std::span<fr> parents)
+    {
+        hash_level_parallel<PedersenHashPolicy>(children, parents, 0, 2);
+    }
 
     static fr zero_hash() { return fr::zero(); }
 };
 
 struct Poseidon2HashPolicy {
-    static fr hash(const std::vector<fr>& inputs)
+    using Poseidon2 = bb::crypto::Poseidon2<bb::crypto::Poseidon2Bn254ScalarFieldParams>;
+
+    static fr hash(const std::vector<fr>& inputs) { return Poseidon2::hash(inputs); }
+
+    template <size_t N> static fr hash(const std::array<fr, N>& inputs) { return Poseidon2::hash(inputs); }
+
+    static fr hash_pair(const fr& lhs, const fr& rhs) { return Poseidon2::hash_pair(lhs, rhs); }
+
+    static void hash_level(std::span<const fr> children, std::span<fr> parents)
     {
-        return bb::crypto::Poseidon2<bb::crypto::Poseidon2Bn254ScalarFieldParams>::hash(inputs);
+        // Roughly 500 field multiplications per width-4 permutation
+        hash_level_parallel<Poseidon2HashPolicy>(children, parents, 500, 0);
     }
 
-    static fr hash_pair(const fr& lhs, const fr& rhs) { return hash(std::vector<fr>({ lhs, rhs })); }
-
     static fr zero_hash() { return fr::zero(); }
 };
 
 inline bb::fr hash_pair_native(bb::fr const& lhs, bb::fr const& rhs)
 {
-    return crypto::pedersen_hash::hash({ lhs, rhs }); // uses lookup tables
+    return PedersenHashPolicy::hash_pair(lhs, rhs);
 }
 
 inline bb::fr hash_native(std::vector<bb::fr> const& inputs)
@@ -51,16 +94,18 @@ inline bb::fr compute_tree_root_native(std::vector<bb::fr> const& input)
     // Check if the input vector size is a power of 2.
     ASSERT(input.size() > 0);
     ASSERT(numeric::is_power_of_two(input.size()));
-    auto layer = input;
-    while (layer.size() > 1) {
-        std::vector<bb::fr> next_layer(layer.size() / 2);
-        for (size_t i = 0; i < next_layer.size(); ++i) {
-            next_layer[i] = crypto::pedersen_hash::hash({ layer[i * 2], layer[i * 2 + 1] });
-        }
-        layer = std::move(next_layer);
+    // Layers are hashed into a single scratch buffer, alternating between its two halves so that a layer never aliases
+    // the layer it is computed from
+    std::vector<bb::fr> layer(input.size());
+    std::span<const bb::fr> children(input);
+    while (children.size() > 1) {
+        std::span<bb::fr> parents(layer.data() + (children.data() == layer.data() ? layer.size() / 2 : 0),
+                                  children.size() / 2);
+        PedersenHashPolicy::hash_level(children, parents);
+        children = parents;
     }
 
-    return layer[0];
+    return children[0];
 }
 
 // TODO write test
@@ -69,15 +114,15 @@ inline std::vector<bb::fr> compute_tree_native(std::vector<bb::fr> const& input)
     // Check if the input vector size is a power of 2.
     ASSERT(input.size() > 0);
     ASSERT(numeric::is_power_of_two(input.size()));
-    auto layer = input;
-    std::vector<bb::fr> tree(input);
-    while (layer.size() > 1) {
-        std::vector<bb::fr> next_layer(layer.size() / 2);
-        for (size_t i = 0; i < next_layer.size(); ++i) {
-            next_layer[i] = crypto::pedersen_hash::hash({ layer[i * 2], layer[i * 2 + 1] });
-            tree.push_back(next_layer[i]);
-        }
-        layer = std::move(next_layer);
+    // The layers are stored contiguously, so each layer is hashed straight into the slot that follows its children
+    std::vector<bb::fr> tree(input.size() * 2 - 1);
+    std::copy(input.begin(), input.end(), tree.begin());
+    size_t offset = 0;
+    for (size_t layer_size = input.size(); layer_size > 1; layer_size /= 2) {
+        std::span<const bb::fr> children(tree.data() + offset, layer_size);
+        std::span<bb::fr> parents(tree.data() + offset + layer_size, layer_size / 2);
+        PedersenHashPolicy::hash_level(children, parents);
+        offset += layer_size;
     }
 
     return tree;
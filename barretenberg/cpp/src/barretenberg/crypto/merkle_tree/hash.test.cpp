@@ -62,3 +62,24 @@ TEST(crypto_merkle_tree_hash, compute_tree_native)
     }
     EXPECT_EQ(tree_vector.back(), mem_tree.root());
 }
+
+TEST(crypto_merkle_tree_hash, hash_level_matches_hash_pair)
+{
+    constexpr size_t num_parents = 64;
+    std::vector<fr> children(num_parents * 2);
+    for (auto& child : children) {
+        child = fr::random_element();
+    }
+
+    std::vector<fr> poseidon2_parents(num_parents);
+    std::vector<fr> pedersen_parents(num_parents);
+    merkle_tree::Poseidon2HashPolicy::hash_level(children, poseidon2_parents);
+    merkle_tree::PedersenHashPolicy::hash_level(children, pedersen_parents);
+
+    for (size_t i = 0; i < num_parents; ++i) {
+        EXPECT_EQ(poseidon2_parents[i],
+                  merkle_tree::Poseidon2HashPolicy::hash(std::vector<fr>{ children[i * 2], children[i * 2 + 1] }));
+        EXPECT_EQ(pedersen_parents[i],
+                  merkle_tree::PedersenHashPolicy::hash(std::vector<fr>{ children[i * 2], children[i * 2 + 1] }));
+    }
+}
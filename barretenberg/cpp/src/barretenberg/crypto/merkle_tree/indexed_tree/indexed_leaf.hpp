@@ -19,7 +19,7 @@ struct indexed_leaf {
         return os;
     }
 
-    std::vector<fr> get_hash_inputs() const { return std::vector<fr>({ value, nextIndex, nextValue }); }
+    std::array<fr, 3> get_hash_inputs() const { return std::array<fr, 3>{ value, nextIndex, nextValue }; }
 };
 
 } // namespace bb::crypto::merkle_tree
\ No newline at end of file
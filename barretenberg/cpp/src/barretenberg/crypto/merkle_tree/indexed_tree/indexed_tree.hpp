@@ -206,13 +206,24 @@ std::vector<fr_hash_path> IndexedTree<Store, LeavesStore, HashingPolicy>::add_or
     std::sort(values_sorted.begin(), values_sorted.end(), comp);
 
     // Now that we have the sorted values we need to identify the leaves that need updating.
-    // This is performed sequentially and is stored in this 'leaf_insertion' struct
+    // The low leaves of the whole batch are resolved against the existing leaves in a single pass over the index. Since
+    // we insert in descending order, a new value can never be the low leaf of a value inserted after it, so the only
+    // intra-batch relationship we need to detect is a value being repeated within the batch.
+    std::vector<fr> ascending_values(values_sorted.size());
+    for (size_t i = 0; i < values_sorted.size(); ++i) {
+        ascending_values[values_sorted.size() - 1 - i] = values_sorted[i].first;
+    }
+    std::vector<std::pair<bool, index_t>> low_values = leaves_.find_low_values(ascending_values);
+
+    // The updates to the low leaves are then applied sequentially and stored in this 'leaf_insertion' struct
     struct leaf_insertion {
         index_t low_leaf_index;
         indexed_leaf low_leaf;
     };
 
     std::vector<leaf_insertion> insertions(values.size());
+    std::vector<std::pair<uint256_t, index_t>> new_index_entries;
+    new_index_entries.reserve(values.size());
     index_t old_size = leaves_.get_size();
 
     for (size_t i = 0; i < values_sorted.size(); ++i) {
@@ -220,9 +231,15 @@ std::vector<fr_hash_path> IndexedTree<Store, LeavesStore, HashingPolicy>::add_or
         index_t index_of_new_leaf = index_t(values_sorted[i].second) + old_size;
 
         // This gives us the leaf that need updating
-        index_t current;
-        bool is_already_present;
-        std::tie(is_already_present, current) = leaves_.find_low_value(values_sorted[i].first);
+        auto [is_already_present, current] = low_values[values_sorted.size() - 1 - i];
+        if (i > 0 && values_sorted[i - 1].first == value) {
+            // The value was added earlier in this batch (or was already present, in which case so is this one)
+            is_already_present = true;
+            current = low_values[values_sorted.size() - i].first
+                          ? low_values[values_sorted.size() - i].second
+                          : index_t(values_sorted[i - 1].second) + old_size;
+            low_values[values_sorted.size() - 1 - i] = std::make_pair(true, current);
+        }
         indexed_leaf current_leaf = leaves_.get_leaf(current);
 
         indexed_leaf new_leaf =
@@ -235,7 +252,8 @@ std::vector<fr_hash_path> IndexedTree<Store, LeavesStore, HashingPolicy>::add_or
             current_leaf.nextValue = value;
 
             leaves_.set_at_index(current, current_leaf, false);
-            leaves_.set_at_index(index_of_new_leaf, new_leaf, true);
+            leaves_.set_at_index(index_of_new_leaf, new_leaf, false);
+            new_index_entries.emplace_back(uint256_t(value), index_of_new_leaf);
         }
 
         // Capture the index and value of the updated 'low' leaf
@@ -245,6 +263,8 @@ std::vector<fr_hash_path> IndexedTree<Store, LeavesStore, HashingPolicy>::add_or
                                            .nextIndex = current_leaf.nextIndex,
                                            .nextValue = current_leaf.nextValue };
     }
+    // Add all of the new values to the index with a single merge
+    leaves_.add_to_index(std::move(new_index_entries));
 
     // We now kick off multiple workers to perform the low leaf updates
     // We create set of signals to coordinate the workers as the move up the tree
@@ -131,6 +131,64 @@ TEST(stdlib_indexed_tree, test_batch_insert)
     }
 }
 
+TEST(stdlib_indexed_tree, test_batch_insert_with_repeated_values)
+{
+    ArrayStore store(10);
+    auto tree = IndexedTree<ArrayStore, LeavesCache, HashPolicy>(store, 10);
+    tree.add_or_update_values({ 30, 10, 30, 20, 10 });
+    tree.add_or_update_values({ 20, 40, 5 });
+
+    // Walk the linked list of leaves from the zero leaf, each value should appear exactly once and in order
+    std::vector<fr> expected{ 5, 10, 20, 30, 40 };
+    indexed_leaf leaf = tree.get_leaf(0);
+    for (const auto& value : expected) {
+        EXPECT_EQ(leaf.nextValue, value);
+        leaf = tree.get_leaf(leaf.nextIndex);
+        EXPECT_EQ(leaf.value, value);
+    }
+    EXPECT_EQ(leaf.nextIndex, 0);
+    EXPECT_EQ(leaf.nextValue, 0);
+}
+
+TEST(stdlib_indexed_tree, test_leaves_cache_batch_lookup)
+{
+    LeavesCache leaves;
+    std::map<uint256_t, index_t> reference;
+    leaves.append_leaf(indexed_leaf{ .value = 0, .nextIndex = 0, .nextValue = 0 });
+    reference[0] = 0;
+
+    // Populate the cache with a mix of single insertions and batched insertions into the index
+    std::vector<std::pair<uint256_t, index_t>> batch;
+    for (size_t i = 1; i < NUM_VALUES; ++i) {
+        indexed_leaf leaf{ .value = VALUES[i], .nextIndex = 0, .nextValue = 0 };
+        bool add_individually = (i % 3) == 0;
+        leaves.set_at_index(i, leaf, add_individually);
+        if (!add_individually) {
+            batch.emplace_back(uint256_t(VALUES[i]), i);
+        }
+        reference[uint256_t(VALUES[i])] = i;
+    }
+    leaves.add_to_index(batch);
+
+    // Look up a sorted batch of values containing both present and absent values
+    std::vector<fr> queries;
+    for (size_t i = 0; i < NUM_VALUES; i += 2) {
+        queries.emplace_back(VALUES[i]);
+        queries.emplace_back(fr(random_engine.get_random_uint256()));
+    }
+    std::sort(queries.begin(), queries.end(), [](const fr& a, const fr& b) { return uint256_t(a) < uint256_t(b); });
+    auto results = leaves.find_low_values(queries);
+
+    ASSERT_EQ(results.size(), queries.size());
+    for (size_t i = 0; i < queries.size(); ++i) {
+        auto it = reference.upper_bound(uint256_t(queries[i]));
+        --it;
+        EXPECT_EQ(results[i].first, it->first == uint256_t(queries[i]));
+        EXPECT_EQ(results[i].second, it->second);
+        EXPECT_EQ(results[i], leaves.find_low_value(queries[i]));
+    }
+}
+
 fr hash_leaf(const indexed_leaf& leaf)
 {
     return HashPolicy::hash(leaf.get_hash_inputs());
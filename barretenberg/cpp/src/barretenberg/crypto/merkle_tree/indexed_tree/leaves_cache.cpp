@@ -1,4 +1,5 @@
 #include "leaves_cache.hpp"
+#include <numeric>
 
 namespace bb::crypto::merkle_tree {
 
@@ -7,29 +8,85 @@ index_t LeavesCache::get_size() const
     return index_t(leaves_.size());
 }
 
-std::pair<bool, index_t> LeavesCache::find_low_value(const fr& new_value) const
+/**
+ * @brief Returns the position of the first key >= the given key
+ */
+size_t LeavesCache::lower_bound(const uint256_t& key) const
+{
+    // Find the block that may contain the key using the fences, then search within that block
+    auto fence = std::upper_bound(fences_.begin(), fences_.end(), key);
+    if (fence == fences_.begin()) {
+        return 0;
+    }
+    const size_t block_start = static_cast<size_t>(fence - fences_.begin() - 1) * FENCE_STRIDE;
+    const size_t block_end = std::min(block_start + FENCE_STRIDE, keys_.size());
+    return static_cast<size_t>(
+        std::lower_bound(keys_.begin() + static_cast<std::ptrdiff_t>(block_start),
+                         keys_.begin() + static_cast<std::ptrdiff_t>(block_end),
+                         key) -
+        keys_.begin());
+}
+
+/**
+ * @brief Returns the position of the first key >= the given key, given that it is known to be at or after start
+ *
+ * @details Gallops forward from start, so a sequence of ascending lookups costs O(log(distance)) each rather than a
+ * full search of the index.
+ */
+size_t LeavesCache::lower_bound_from(const uint256_t& key, size_t start) const
 {
-    std::map<uint256_t, index_t>::const_iterator it = indices_.lower_bound(new_value);
-    if (it == indices_.end()) {
-        // there is no element >= the requested value.
-        // decrement the iterator to get the value preceeding the requested value
-        --it;
-        return std::make_pair(false, it->second);
+    size_t step = 1;
+    size_t low = start;
+    size_t high = start;
+    while (high < keys_.size() && keys_[high] < key) {
+        low = high + 1;
+        high = start + step;
+        step <<= 1;
     }
-    if (it->first == uint256_t(new_value)) {
-        // the value is already present and the iterator points to it
-        return std::make_pair(true, it->second);
+    high = std::min(high, keys_.size());
+    return static_cast<size_t>(std::lower_bound(keys_.begin() + static_cast<std::ptrdiff_t>(low),
+                                                keys_.begin() + static_cast<std::ptrdiff_t>(high),
+                                                key) -
+                               keys_.begin());
+}
+
+std::pair<bool, index_t> LeavesCache::low_value_at(const uint256_t& key, size_t position) const
+{
+    if (position < keys_.size() && keys_[position] == key) {
+        // the value is already present
+        return std::make_pair(true, key_indices_[position]);
+    }
+    // position is that of the element immediately larger than the requested value (or the end), the one before it is
+    // the value less than that requested
+    ASSERT(position > 0);
+    return std::make_pair(false, key_indices_[position - 1]);
+}
+
+std::pair<bool, index_t> LeavesCache::find_low_value(const fr& new_value) const
+{
+    const uint256_t key(new_value);
+    return low_value_at(key, lower_bound(key));
+}
+
+std::vector<std::pair<bool, index_t>> LeavesCache::find_low_values(const std::vector<fr>& sorted_values) const
+{
+    std::vector<std::pair<bool, index_t>> result;
+    result.reserve(sorted_values.size());
+    size_t position = 0;
+    for (const auto& value : sorted_values) {
+        const uint256_t key(value);
+        position = lower_bound_from(key, position);
+        result.emplace_back(low_value_at(key, position));
     }
-    // the iterator points to the element immediately larger than the requested value
-    --it;
-    //  it now points to the value less than that requested
-    return std::make_pair(false, it->second);
+    return result;
 }
+
 indexed_leaf LeavesCache::get_leaf(const index_t& index) const
 {
     ASSERT(index >= 0 && index < leaves_.size());
     return leaves_[size_t(index)];
 }
+
 void LeavesCache::set_at_index(const index_t& index, const indexed_leaf& leaf, bool add_to_index)
 {
     if (index >= leaves_.size()) {
@@ -37,13 +94,84 @@ void LeavesCache::set_at_index(const index_t& index, const indexed_leaf& leaf, b
     }
     leaves_[size_t(index)] = leaf;
     if (add_to_index) {
-        indices_[uint256_t(leaf.value)] = index;
+        const uint256_t key(leaf.value);
+        const size_t position = lower_bound(key);
+        if (position < keys_.size() && keys_[position] == key) {
+            key_indices_[position] = index;
+            return;
+        }
+        keys_.insert(keys_.begin() + static_cast<std::ptrdiff_t>(position), key);
+        key_indices_.insert(key_indices_.begin() + static_cast<std::ptrdiff_t>(position), index);
+        rebuild_fences(position);
     }
 }
+
 void LeavesCache::append_leaf(const indexed_leaf& leaf)
 {
     index_t next_index = leaves_.size();
     set_at_index(next_index, leaf, true);
 }
 
-} // namespace bb::crypto::merkle_tree
\ No newline at end of file
+void LeavesCache::add_to_index(std::vector<std::pair<uint256_t, index_t>> entries)
+{
+    if (entries.empty()) {
+        return;
+    }
+    // Sort the batch, keeping only the last entry given for any repeated value. We sort positions (breaking ties by
+    // position) rather than stable sorting the entries themselves, as the temporary buffer of std::stable_sort does not
+    // respect the alignment of uint256_t.
+    std::vector<size_t> order(entries.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&entries](size_t a, size_t b) {
+        return entries[a].first < entries[b].first || (entries[a].first == entries[b].first && a < b);
+    });
+    std::vector<std::pair<uint256_t, index_t>> batch;
+    batch.reserve(entries.size());
+    for (size_t position : order) {
+        if (!batch.empty() && batch.back().first == entries[position].first) {
+            batch.back() = entries[position];
+        } else {
+            batch.emplace_back(entries[position]);
+        }
+    }
+
+    // Merge the batch into the index
+    std::vector<uint256_t> keys;
+    std::vector<index_t> key_indices;
+    keys.reserve(keys_.size() + batch.size());
+    key_indices.reserve(keys_.size() + batch.size());
+    size_t i = 0;
+    size_t j = 0;
+    while (i < keys_.size() || j < batch.size()) {
+        if (j == batch.size() || (i < keys_.size() && keys_[i] < batch[j].first)) {
+            keys.emplace_back(keys_[i]);
+            key_indices.emplace_back(key_indices_[i]);
+            ++i;
+        } else {
+            if (i < keys_.size() && keys_[i] == batch[j].first) {
+                ++i;
+            }
+            keys.emplace_back(batch[j].first);
+            key_indices.emplace_back(batch[j].second);
+            ++j;
+        }
+    }
+    keys_ = std::move(keys);
+    key_indices_ = std::move(key_indices);
+    rebuild_fences(0);
+}
+
+/**
+ * @brief Recomputes the fences of every block containing a position >= from_position
+ */
+void LeavesCache::rebuild_fences(size_t from_position)
+{
+    const size_t first_block = from_position / FENCE_STRIDE;
+    const size_t num_blocks = (keys_.size() + FENCE_STRIDE - 1) / FENCE_STRIDE;
+    fences_.resize(num_blocks);
+    for (size_t block = first_block; block < num_blocks; ++block) {
+        fences_[block] = keys_[block * FENCE_STRIDE];
+    }
+}
+
+} // namespace bb::crypto::merkle_tree
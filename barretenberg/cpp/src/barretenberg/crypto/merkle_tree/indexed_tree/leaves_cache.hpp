@@ -10,18 +10,42 @@ typedef uint256_t index_t;
  * @brief Used to facilitate testing of the IndexedTree. Stores leaves in memory with an index for O(logN) retrieval of
  * 'low leaves'
  *
+ * @details The index over leaf values is a sorted array of keys (with a parallel array of leaf indices) plus a sparse
+ * 'fence' array holding every FENCE_STRIDE-th key. A lookup is a binary search over the small, cache resident, fence
+ * array followed by a search within a single block of keys. Batches of sorted values can be looked up in a single
+ * forward pass over the keys and merged into the index in O(N + B), rather than with B independent tree traversals.
  */
 class LeavesCache {
   public:
+    static constexpr size_t FENCE_STRIDE = 64;
+
     index_t get_size() const;
     std::pair<bool, index_t> find_low_value(const bb::fr& new_value) const;
+    /**
+     * @brief Finds the low leaf of each of a batch of values in a single merge-style pass over the index
+     * @param sorted_values The values to look up, sorted in ascending order
+     * @returns For each value, whether it is already present and the index of its low leaf (or of itself if present)
+     */
+    std::vector<std::pair<bool, index_t>> find_low_values(const std::vector<bb::fr>& sorted_values) const;
     indexed_leaf get_leaf(const index_t& index) const;
     void set_at_index(const index_t& index, const indexed_leaf& leaf, bool add_to_index);
     void append_leaf(const indexed_leaf& leaf);
+    /**
+     * @brief Adds a batch of (value, leaf index) pairs to the index in a single merge
+     * @param entries The entries to add, in any order. Entries for values already in the index overwrite them.
+     */
+    void add_to_index(std::vector<std::pair<uint256_t, index_t>> entries);
 
   private:
-    std::map<uint256_t, index_t> indices_;
+    size_t lower_bound(const uint256_t& key) const;
+    size_t lower_bound_from(const uint256_t& key, size_t start) const;
+    std::pair<bool, index_t> low_value_at(const uint256_t& key, size_t position) const;
+    void rebuild_fences(size_t from_position);
+
+    std::vector<uint256_t> keys_;
+    std::vector<index_t> key_indices_;
+    std::vector<uint256_t> fences_;
     std::vector<indexed_leaf> leaves_;
 };
 
-} // namespace bb::crypto::merkle_tree
\ No newline at end of file
+} // namespace bb::crypto::merkle_tree
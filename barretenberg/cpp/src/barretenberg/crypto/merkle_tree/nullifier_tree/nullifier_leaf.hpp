@@ -22,7 +22,7 @@ struct nullifier_leaf {
         return os;
     }
 
-    std::vector<fr> get_hash_inputs() const { return std::vector<fr>{ value, nextIndex, nextValue }; }
+    std::array<fr, 3> get_hash_inputs() const { return std::array<fr, 3>{ value, nextIndex, nextValue }; }
 
     static nullifier_leaf zero() { return nullifier_leaf{ .value = 0, .nextIndex = 0, .nextValue = 0 }; }
 };
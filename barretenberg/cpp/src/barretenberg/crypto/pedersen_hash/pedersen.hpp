@@ -2,6 +2,7 @@
 
 #include "../generators/generator_data.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include <array>
 namespace bb::crypto {
 /**
  * @brief Performs pedersen hashes!
@@ -30,6 +31,25 @@ template <typename Curve> class pedersen_hash_base {
     using GeneratorContext = typename crypto::GeneratorContext<Curve>;
     inline static constexpr AffineElement length_generator = Group::derive_generators("pedersen_hash_length", 1)[0];
     static Fq hash(const std::vector<Fq>& inputs, GeneratorContext context = {});
+    /**
+     * @brief Hashes a fixed number of field elements using the default generators, without allocating
+     * @details Produces the same output as hash() applied to a vector holding the same N elements with a default
+     * context. Small inputs read the compile-time precomputed default generators directly, which avoids constructing a
+     * `GeneratorContext` (and its domain separator string) and the intermediate input vector.
+     */
+    template <size_t N> static Fq hash(const std::array<Fq, N>& inputs)
+    {
+        using GeneratorData = crypto::generator_data<Curve>;
+        if constexpr (N < GeneratorData::DEFAULT_NUM_GENERATORS) {
+            Element result = length_generator * Fr(N);
+            for (size_t i = 0; i < N; ++i) {
+                result += Element(GeneratorData::precomputed_generators[i]) * static_cast<uint256_t>(inputs[i]);
+            }
+            return result.normalize().x;
+        } else {
+            return hash(std::vector<Fq>(inputs.begin(), inputs.end()));
+        }
+    }
     static Fq hash_buffer(const std::vector<uint8_t>& input, GeneratorContext context = {});
 
   private:
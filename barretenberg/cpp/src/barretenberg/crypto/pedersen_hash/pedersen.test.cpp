@@ -21,4 +21,17 @@ TEST(Pedersen, HashWithIndex)
     EXPECT_EQ(r, fr(uint256_t("1c446df60816b897cda124524e6b03f36df0cec333fad87617aab70d7861daa6")));
 }
 
+TEST(Pedersen, FixedArityHashMatchesVectorHash)
+{
+    std::array<fr, 3> inputs{ fr::random_element(), fr::random_element(), fr::random_element() };
+    EXPECT_EQ(pedersen_hash::hash(inputs), pedersen_hash::hash(std::vector<fr>(inputs.begin(), inputs.end())));
+
+    std::array<fr, 9> long_inputs;
+    for (auto& input : long_inputs) {
+        input = fr::random_element();
+    }
+    EXPECT_EQ(pedersen_hash::hash(long_inputs),
+              pedersen_hash::hash(std::vector<fr>(long_inputs.begin(), long_inputs.end())));
+}
+
 } // namespace bb::crypto
\ No newline at end of file
@@ -4,6 +4,8 @@
 #include "poseidon2_permutation.hpp"
 #include "sponge/sponge.hpp"
 
+#include <array>
+
 namespace bb::crypto {
 
 template <typename Params> class Poseidon2 {
@@ -11,12 +13,40 @@ template <typename Params> class Poseidon2 {
     using FF = typename Params::FF;
 
     // We choose our rate to be t-1 and capacity to be 1.
-    using Sponge = FieldSponge<FF, Params::t - 1, 1, Params::t, Poseidon2Permutation<Params>>;
+    using Permutation = Poseidon2Permutation<Params>;
+    using Sponge = FieldSponge<FF, Params::t - 1, 1, Params::t, Permutation>;
 
     /**
      * @brief Hashes a vector of field elements
      */
     static FF hash(const std::vector<FF>& input);
+    /**
+     * @brief Hashes a fixed number of field elements without allocating
+     * @details Produces the same output as hash() applied to a vector holding the same N elements. The input is
+     * absorbed `rate` elements at a time directly into a stack-allocated permutation state whose capacity element holds
+     * the fixed-length domain separation IV (N << 64); the trailing partial block is implicitly zero-padded. The first
+     * element of the final state is the hash output.
+     */
+    template <size_t N> static FF hash(const std::array<FF, N>& input)
+    {
+        constexpr size_t rate = Params::t - 1;
+        typename Permutation::State state{};
+        state[rate] = FF(static_cast<uint256_t>(N) << 64);
+        if constexpr (N == 0) {
+            state = Permutation::permutation(state);
+        }
+        for (size_t i = 0; i < N; i += rate) {
+            for (size_t j = 0; j < rate && i + j < N; ++j) {
+                state[j] += input[i + j];
+            }
+            state = Permutation::permutation(state);
+        }
+        return state[0];
+    }
+    /**
+     * @brief Two-to-one compression used to hash merkle tree nodes. Equivalent to hash({ lhs, rhs })
+     */
+    static FF hash_pair(const FF& lhs, const FF& rhs) { return hash(std::array<FF, 2>{ lhs, rhs }); }
     /**
      * @brief Hashes vector of bytes by chunking it into 31 byte field elements and calling hash()
      * @details Slice function cuts out the required number of bytes from the byte vector
@@ -64,3 +64,25 @@ TEST(Poseidon2, HashBufferConsistencyCheck)
     EXPECT_NE(result1, expected);
     EXPECT_EQ(result2, expected);
 }
+
+TEST(Poseidon2, FixedArityHashMatchesSponge)
+{
+    using Poseidon2 = crypto::Poseidon2<crypto::Poseidon2Bn254ScalarFieldParams>;
+
+    std::array<fr, 2> pair{ fr::random_element(&engine), fr::random_element(&engine) };
+    EXPECT_EQ(Poseidon2::hash(pair), Poseidon2::hash(std::vector<fr>(pair.begin(), pair.end())));
+    EXPECT_EQ(Poseidon2::hash_pair(pair[0], pair[1]), Poseidon2::hash(std::vector<fr>(pair.begin(), pair.end())));
+
+    // Exercise inputs that fill the rate exactly and that span more than one permutation
+    std::array<fr, 3> full_block;
+    std::array<fr, 7> multi_block;
+    for (auto& element : full_block) {
+        element = fr::random_element(&engine);
+    }
+    for (auto& element : multi_block) {
+        element = fr::random_element(&engine);
+    }
+    EXPECT_EQ(Poseidon2::hash(full_block), Poseidon2::hash(std::vector<fr>(full_block.begin(), full_block.end())));
+    EXPECT_EQ(Poseidon2::hash(multi_block), Poseidon2::hash(std::vector<fr>(multi_block.begin(), multi_block.end())));
+    EXPECT_EQ(Poseidon2::hash(std::array<fr, 0>{}), Poseidon2::hash(std::vector<fr>{}));
+}
@@ -15,6 +15,14 @@ Sha256Hash sha256_block(const std::vector<uint8_t>& input);
 
 template <typename T> Sha256Hash sha256(const T& input);
 
+/**
+ * @brief Compute the SHA-256 hashes of many independent messages
+ *
+ * @details Uses a multi-buffer kernel, which hashes several messages at once in the lanes of a vector register, if the
+ * CPU supports one that is faster than hashing the messages one at a time.
+ */
+std::vector<Sha256Hash> sha256_batch(const std::vector<std::vector<uint8_t>>& inputs);
+
 inline bb::fr sha256_to_field(std::vector<uint8_t> const& input)
 {
     auto result = sha256(input);
@@ -1,7 +1,10 @@
 #include "sha256.hpp"
+#include "barretenberg/common/cpu_features.hpp"
+#include "sha256_kernels.hpp"
 #include <gtest/gtest.h>
 #include <iostream>
 #include <memory>
+#include <random>
 
 using namespace bb;
 using namespace bb::crypto;
@@ -101,3 +104,69 @@ TEST(misc_sha256, test_NIST_vector_five)
         EXPECT_EQ(result[i], expected[i]);
     }
 }
+
+TEST(misc_sha256, compression_kernels_agree)
+{
+    const auto& features = get_cpu_features();
+    std::mt19937 engine(0);
+    std::vector<uint8_t> blocks(64 * 16);
+    for (auto& byte : blocks) {
+        byte = static_cast<uint8_t>(engine());
+    }
+
+    // Single-buffer kernels, over 3 consecutive blocks
+    sha256_kernels::State expected{ 1, 2, 3, 4, 5, 6, 7, 8 };
+    sha256_kernels::compress_portable(expected, blocks.data(), 3);
+    if (features.sha) {
+        sha256_kernels::State state{ 1, 2, 3, 4, 5, 6, 7, 8 };
+        sha256_kernels::compress_sha_ni(state, blocks.data(), 3);
+        EXPECT_EQ(state, expected);
+    }
+
+    // Multi-buffer kernels: each lane compresses two blocks, from different (overlapping) offsets of the buffer
+    std::array<sha256_kernels::State, 16> expected_lanes;
+    std::array<const uint8_t*, 16> lane_blocks;
+    for (size_t lane = 0; lane < 16; ++lane) {
+        expected_lanes[lane] = { static_cast<uint32_t>(lane), 2, 3, 4, 5, 6, 7, 8 };
+        lane_blocks[lane] = blocks.data() + (lane % 14) * 64;
+        sha256_kernels::compress_portable(expected_lanes[lane], lane_blocks[lane], 2);
+    }
+    const auto check_lanes = [&](size_t num_lanes, auto kernel) {
+        std::array<sha256_kernels::State, 16> states;
+        for (size_t lane = 0; lane < num_lanes; ++lane) {
+            states[lane] = { static_cast<uint32_t>(lane), 2, 3, 4, 5, 6, 7, 8 };
+        }
+        kernel(states.data(), lane_blocks.data(), 2);
+        for (size_t lane = 0; lane < num_lanes; ++lane) {
+            EXPECT_EQ(states[lane], expected_lanes[lane]);
+        }
+    };
+    if (features.avx2) {
+        check_lanes(8, sha256_kernels::compress_x8);
+    }
+    if (features.avx512f) {
+        check_lanes(16, sha256_kernels::compress_x16);
+    }
+}
+
+TEST(misc_sha256, batch_matches_single)
+{
+    // Sizes around the padding boundaries (55/56 bytes) and the block boundaries, several messages of each
+    std::mt19937 engine(1);
+    std::vector<std::vector<uint8_t>> inputs;
+    for (size_t repeat = 0; repeat < 20; ++repeat) {
+        for (const size_t size : std::vector<size_t>{ 0, 1, 32, 55, 56, 63, 64, 65, 119, 120, 128, 1000 }) {
+            std::vector<uint8_t> input(size);
+            for (auto& byte : input) {
+                byte = static_cast<uint8_t>(engine());
+            }
+            inputs.push_back(input);
+        }
+    }
+
+    const auto hashes = sha256_batch(inputs);
+    ASSERT_EQ(hashes.size(), inputs.size());
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        EXPECT_EQ(hashes[i], sha256(inputs[i]));
+    }
+}
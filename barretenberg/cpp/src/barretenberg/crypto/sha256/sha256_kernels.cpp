@@ -0,0 +1,261 @@
+#include "./sha256_kernels.hpp"
+#include "barretenberg/common/cpu_features.hpp"
+
+#include <cstring>
+
+#if defined(__x86_64__) && !defined(__wasm__)
+#include <immintrin.h>
+#define BB_SHA256_X86_KERNELS
+#endif
+
+namespace bb::crypto::sha256_kernels {
+
+namespace {
+
+constexpr uint32_t round_constants[64]{
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+inline uint32_t load_be32(const uint8_t* data)
+{
+    uint32_t word = 0;
+    std::memcpy(&word, data, sizeof(word));
+    return __builtin_bswap32(word);
+}
+
+// A macro rather than a function template, since returning a vector wider than the baseline target of this file from a
+// function would depend on an ABI that is only defined when the wider registers are enabled (-Wpsabi)
+#define BB_SHA256_ROR(val, shift) (((val) >> (shift)) | ((val) << (32 - (shift))))
+
+/**
+ * @brief The SHA-256 compression function, over a word type T that is either uint32_t or a vector of them
+ *
+ * @details With a vector type every lane hashes an independent message: the arithmetic below is then compiled into
+ * vector instructions by the caller, whose target attribute determines the width.
+ */
+template <typename T> inline __attribute__((always_inline)) void compress_words(std::array<T, 8>& state, T* w)
+{
+    T a = state[0];
+    T b = state[1];
+    T c = state[2];
+    T d = state[3];
+    T e = state[4];
+    T f = state[5];
+    T g = state[6];
+    T h = state[7];
+
+    // The message schedule is kept in a ring of 16 words, extended as the rounds progress
+    for (size_t i = 0; i < 64; ++i) {
+        if (i >= 16) {
+            const T& w15 = w[(i - 15) & 15];
+            const T& w2 = w[(i - 2) & 15];
+            const T s0 = BB_SHA256_ROR(w15, 7) ^ BB_SHA256_ROR(w15, 18) ^ (w15 >> 3);
+            const T s1 = BB_SHA256_ROR(w2, 17) ^ BB_SHA256_ROR(w2, 19) ^ (w2 >> 10);
+            w[i & 15] = w[i & 15] + w[(i - 7) & 15] + s0 + s1;
+        }
+        const T S1 = BB_SHA256_ROR(e, 6) ^ BB_SHA256_ROR(e, 11) ^ BB_SHA256_ROR(e, 25);
+        const T ch = (e & f) ^ (~e & g);
+        const T temp1 = h + S1 + ch + round_constants[i] + w[i & 15];
+        const T S0 = BB_SHA256_ROR(a, 2) ^ BB_SHA256_ROR(a, 13) ^ BB_SHA256_ROR(a, 22);
+        const T maj = (a & b) ^ (a & c) ^ (b & c);
+        const T temp2 = S0 + maj;
+
+        h = g;
+        g = f;
+        f = e;
+        e = d + temp1;
+        d = c;
+        c = b;
+        b = a;
+        a = temp1 + temp2;
+    }
+
+    state[0] += a;
+    state[1] += b;
+    state[2] += c;
+    state[3] += d;
+    state[4] += e;
+    state[5] += f;
+    state[6] += g;
+    state[7] += h;
+}
+
+#undef BB_SHA256_ROR
+
+#ifdef BB_SHA256_X86_KERNELS
+template <typename Vector, size_t NUM_LANES>
+inline __attribute__((always_inline)) void compress_lanes_impl(State* states,
+                                                               const uint8_t* const* blocks,
+                                                               size_t num_blocks)
+{
+    // Transpose the states so that vector i holds word i of every lane
+    std::array<Vector, 8> state;
+    for (size_t i = 0; i < 8; ++i) {
+        for (size_t lane = 0; lane < NUM_LANES; ++lane) {
+            state[i][lane] = states[lane][i];
+        }
+    }
+    for (size_t block = 0; block < num_blocks; ++block) {
+        Vector w[16];
+        for (size_t i = 0; i < 16; ++i) {
+            for (size_t lane = 0; lane < NUM_LANES; ++lane) {
+                w[i][lane] = load_be32(blocks[lane] + block * 64 + i * 4);
+            }
+        }
+        compress_words(state, w);
+    }
+    for (size_t i = 0; i < 8; ++i) {
+        for (size_t lane = 0; lane < NUM_LANES; ++lane) {
+            states[lane][i] = state[i][lane];
+        }
+    }
+}
+#endif
+
+} // namespace
+
+void compress_portable(State& state, const uint8_t* blocks, const size_t num_blocks)
+{
+    for (size_t block = 0; block < num_blocks; ++block) {
+        uint32_t w[16];
+        for (size_t i = 0; i < 16; ++i) {
+            w[i] = load_be32(blocks + block * 64 + i * 4);
+        }
+        compress_words(state, w);
+    }
+}
+
+#ifdef BB_SHA256_X86_KERNELS
+
+/**
+ * @details The SHA-NI instructions process the state as the two vectors ABEF and CDGH, and perform two rounds at a
+ * time. Each iteration of the inner loop performs four rounds and extends the message schedule by four words.
+ */
+__attribute__((target("sha,sse4.1"))) void compress_sha_ni(State& state, const uint8_t* blocks, size_t num_blocks)
+{
+    // Byte-swaps each 32-bit word of a message block
+    const __m128i byte_swap_mask = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+
+    __m128i tmp = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&state[0]));
+    __m128i state1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&state[4]));
+    tmp = _mm_shuffle_epi32(tmp, 0xB1);               // CDAB
+    state1 = _mm_shuffle_epi32(state1, 0x1B);         // EFGH
+    __m128i state0 = _mm_alignr_epi8(tmp, state1, 8); // ABEF
+    state1 = _mm_blend_epi16(state1, tmp, 0xF0);      // CDGH
+
+    for (; num_blocks > 0; --num_blocks, blocks += 64) {
+        const __m128i abef_save = state0;
+        const __m128i cdgh_save = state1;
+
+        // msgs[i % 4] holds schedule words 4i, ..., 4i + 3
+        __m128i msgs[4];
+        for (size_t i = 0; i < 16; ++i) {
+            if (i < 4) {
+                msgs[i] = _mm_shuffle_epi8(
+                    _mm_loadu_si128(reinterpret_cast<const __m128i*>(blocks + i * 16)), byte_swap_mask);
+            } else {
+                // W[t] = σ1(W[t-2]) + W[t-7] + σ0(W[t-15]) + W[t-16], four words at a time
+                const __m128i w7 = _mm_alignr_epi8(msgs[(i + 3) & 3], msgs[(i + 2) & 3], 4);
+                const __m128i partial = _mm_add_epi32(_mm_sha256msg1_epu32(msgs[i & 3], msgs[(i + 1) & 3]), w7);
+                msgs[i & 3] = _mm_sha256msg2_epu32(partial, msgs[(i + 3) & 3]);
+            }
+            __m128i msg = _mm_add_epi32(msgs[i & 3],
+                                        _mm_loadu_si128(reinterpret_cast<const __m128i*>(&round_constants[i * 4])));
+            state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+            msg = _mm_shuffle_epi32(msg, 0x0E);
+            state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+        }
+
+        state0 = _mm_add_epi32(state0, abef_save);
+        state1 = _mm_add_epi32(state1, cdgh_save);
+    }
+
+    tmp = _mm_shuffle_epi32(state0, 0x1B);       // FEBA
+    state1 = _mm_shuffle_epi32(state1, 0xB1);    // DCHG
+    state0 = _mm_blend_epi16(tmp, state1, 0xF0); // DCBA
+    state1 = _mm_alignr_epi8(state1, tmp, 8);    // HGFE
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(&state[0]), state0);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(&state[4]), state1);
+}
+
+__attribute__((target("avx2"))) void compress_x8(State* states, const uint8_t* const* blocks, size_t num_blocks)
+{
+    using Vector = uint32_t __attribute__((vector_size(32)));
+    compress_lanes_impl<Vector, 8>(states, blocks, num_blocks);
+}
+
+__attribute__((target("avx512f"))) void compress_x16(State* states, const uint8_t* const* blocks, size_t num_blocks)
+{
+    using Vector = uint32_t __attribute__((vector_size(64)));
+    compress_lanes_impl<Vector, 16>(states, blocks, num_blocks);
+}
+
+#else
+
+void compress_sha_ni(State& state, const uint8_t* blocks, size_t num_blocks)
+{
+    compress_portable(state, blocks, num_blocks);
+}
+
+void compress_x8(State* states, const uint8_t* const* blocks, size_t num_blocks)
+{
+    for (size_t lane = 0; lane < 8; ++lane) {
+        compress_portable(states[lane], blocks[lane], num_blocks);
+    }
+}
+
+void compress_x16(State* states, const uint8_t* const* blocks, size_t num_blocks)
+{
+    for (size_t lane = 0; lane < 16; ++lane) {
+        compress_portable(states[lane], blocks[lane], num_blocks);
+    }
+}
+
+#endif
+
+void compress(State& state, const uint8_t* blocks, const size_t num_blocks)
+{
+    static const auto compress_fn = get_cpu_features().sha ? &compress_sha_ni : &compress_portable;
+    compress_fn(state, blocks, num_blocks);
+}
+
+/**
+ * @details SHA-NI hashes a single message about as fast as 8 AVX2 lanes hash 8, so the AVX2 kernel is only used on
+ * CPUs without SHA-NI.
+ */
+size_t get_num_lanes()
+{
+    const auto& features = get_cpu_features();
+    if (features.avx512f) {
+        return 16;
+    }
+    if (features.avx2 && !features.sha) {
+        return 8;
+    }
+    return 1;
+}
+
+void compress_lanes(State* states, const uint8_t* const* blocks, const size_t num_lanes, const size_t num_blocks)
+{
+    switch (num_lanes) {
+    case 16:
+        compress_x16(states, blocks, num_blocks);
+        break;
+    case 8:
+        compress_x8(states, blocks, num_blocks);
+        break;
+    default:
+        for (size_t lane = 0; lane < num_lanes; ++lane) {
+            compress(states[lane], blocks[lane], num_blocks);
+        }
+    }
+}
+
+} // namespace bb::crypto::sha256_kernels
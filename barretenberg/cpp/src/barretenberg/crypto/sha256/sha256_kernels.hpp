@@ -0,0 +1,40 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * SHA-256 compression functions. `sha256` and `sha256_batch` pick one of these at runtime, based on the extensions
+ * the CPU supports (see `get_cpu_features`); they are exposed so that every implementation can be tested directly.
+ *
+ * All of them take message blocks as raw (big-endian) bytes, and states as the eight native words h0, ..., h7.
+ */
+namespace bb::crypto::sha256_kernels {
+
+using State = std::array<uint32_t, 8>;
+
+// Compress `num_blocks` consecutive 64-byte blocks into `state`, with the best kernel available
+void compress(State& state, const uint8_t* blocks, size_t num_blocks);
+
+void compress_portable(State& state, const uint8_t* blocks, size_t num_blocks);
+
+// Requires `get_cpu_features().sha`
+void compress_sha_ni(State& state, const uint8_t* blocks, size_t num_blocks);
+
+/**
+ * @brief Multi-buffer compression: compress `num_blocks` blocks of NUM_LANES independent messages at once
+ *
+ * @details Lane i compresses the blocks at `blocks[i]` into `states[i]`. The x8 kernel requires AVX2 and the x16
+ * kernel AVX-512F.
+ */
+void compress_x8(State* states, const uint8_t* const* blocks, size_t num_blocks);
+void compress_x16(State* states, const uint8_t* const* blocks, size_t num_blocks);
+
+// The number of lanes of the best multi-buffer kernel available, or 1 if single-buffer compression is faster
+size_t get_num_lanes();
+
+// Compress with the kernel chosen by `get_num_lanes`, `num_lanes` being its result
+void compress_lanes(State* states, const uint8_t* const* blocks, size_t num_lanes, size_t num_blocks);
+
+} // namespace bb::crypto::sha256_kernels
@@ -1,104 +1,178 @@
 #include "acir_format.hpp"
 #include "barretenberg/common/log.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/stdlib_circuit_builders/goblin_ultra_circuit_builder.hpp"
 #include "barretenberg/stdlib_circuit_builders/ultra_circuit_builder.hpp"
 #include <cstddef>
+#include <functional>
+#include <optional>
 
 namespace acir_format {
 
 template class DSLBigInts<UltraCircuitBuilder>;
 template class DSLBigInts<GoblinUltraCircuitBuilder>;
 
-template <typename Builder>
-void build_constraints(Builder& builder, AcirFormat const& constraint_system, bool has_valid_witness_assignments)
-{
-    // Add arithmetic gates
-    for (const auto& constraint : constraint_system.poly_triple_constraints) {
-        builder.create_poly_gate(constraint);
-    }
-    for (const auto& constraint : constraint_system.quad_constraints) {
-        builder.create_big_mul_gate(constraint);
-    }
+namespace {
 
-    // Add logic constraint
-    for (const auto& constraint : constraint_system.logic_constraints) {
-        create_logic_gate(
-            builder, constraint.a, constraint.b, constraint.result, constraint.num_bits, constraint.is_xor_gate);
-    }
+// The number of sub-builders the black box constraints are split into when the circuit is built in parallel. It is
+// fixed, rather than derived from the number of threads, so that the circuit does not depend on the machine.
+constexpr size_t NUM_PARALLEL_CONSTRUCTION_GROUPS = 32;
 
-    // Add range constraint
-    for (const auto& constraint : constraint_system.range_constraints) {
-        builder.create_range_constraint(constraint.witness, constraint.num_bits, "");
-    }
+/**
+ * @brief Get a function adding each black box constraint of the constraint system to a builder, in the order in which
+ * they are added to the circuit
+ */
+template <typename Builder>
+std::vector<std::function<void(Builder&)>> get_black_box_constraints(AcirFormat const& constraint_system,
+                                                                     bool has_valid_witness_assignments)
+{
+    std::vector<std::function<void(Builder&)>> result;
+    const auto add = [&result](const auto& constraints, auto create) {
+        for (const auto& constraint : constraints) {
+            result.emplace_back([&constraint, create](Builder& builder) { create(builder, constraint); });
+        }
+    };
 
     // Add sha256 constraints
-    for (const auto& constraint : constraint_system.sha256_constraints) {
-        create_sha256_constraints(builder, constraint);
-    }
-    for (const auto& constraint : constraint_system.sha256_compression) {
-        create_sha256_compression_constraints(builder, constraint);
-    }
+    add(constraint_system.sha256_constraints,
+        [](Builder& builder, const auto& constraint) { create_sha256_constraints(builder, constraint); });
+    add(constraint_system.sha256_compression,
+        [](Builder& builder, const auto& constraint) { create_sha256_compression_constraints(builder, constraint); });
 
     // Add schnorr constraints
-    for (const auto& constraint : constraint_system.schnorr_constraints) {
-        create_schnorr_verify_constraints(builder, constraint);
-    }
+    add(constraint_system.schnorr_constraints,
+        [](Builder& builder, const auto& constraint) { create_schnorr_verify_constraints(builder, constraint); });
 
     // Add ECDSA k1 constraints
-    for (const auto& constraint : constraint_system.ecdsa_k1_constraints) {
-        create_ecdsa_k1_verify_constraints(builder, constraint, has_valid_witness_assignments);
-    }
+    add(constraint_system.ecdsa_k1_constraints,
+        [has_valid_witness_assignments](Builder& builder, const auto& constraint) {
+            create_ecdsa_k1_verify_constraints(builder, constraint, has_valid_witness_assignments);
+        });
 
     // Add ECDSA r1 constraints
-    for (const auto& constraint : constraint_system.ecdsa_r1_constraints) {
-        create_ecdsa_r1_verify_constraints(builder, constraint, has_valid_witness_assignments);
-    }
+    add(constraint_system.ecdsa_r1_constraints,
+        [has_valid_witness_assignments](Builder& builder, const auto& constraint) {
+            create_ecdsa_r1_verify_constraints(builder, constraint, has_valid_witness_assignments);
+        });
 
     // Add blake2s constraints
-    for (const auto& constraint : constraint_system.blake2s_constraints) {
-        create_blake2s_constraints(builder, constraint);
-    }
+    add(constraint_system.blake2s_constraints,
+        [](Builder& builder, const auto& constraint) { create_blake2s_constraints(builder, constraint); });
 
     // Add blake3 constraints
-    for (const auto& constraint : constraint_system.blake3_constraints) {
-        create_blake3_constraints(builder, constraint);
-    }
+    add(constraint_system.blake3_constraints,
+        [](Builder& builder, const auto& constraint) { create_blake3_constraints(builder, constraint); });
 
     // Add keccak constraints
-    for (const auto& constraint : constraint_system.keccak_constraints) {
-        create_keccak_constraints(builder, constraint);
-    }
-    for (const auto& constraint : constraint_system.keccak_permutations) {
-        create_keccak_permutations(builder, constraint);
-    }
+    add(constraint_system.keccak_constraints,
+        [](Builder& builder, const auto& constraint) { create_keccak_constraints(builder, constraint); });
+    add(constraint_system.keccak_permutations,
+        [](Builder& builder, const auto& constraint) { create_keccak_permutations(builder, constraint); });
 
     // Add pedersen constraints
-    for (const auto& constraint : constraint_system.pedersen_constraints) {
-        create_pedersen_constraint(builder, constraint);
+    add(constraint_system.pedersen_constraints,
+        [](Builder& builder, const auto& constraint) { create_pedersen_constraint(builder, constraint); });
+    add(constraint_system.pedersen_hash_constraints,
+        [](Builder& builder, const auto& constraint) { create_pedersen_hash_constraint(builder, constraint); });
+
+    add(constraint_system.poseidon2_constraints,
+        [](Builder& builder, const auto& constraint) { create_poseidon2_permutations(builder, constraint); });
+
+    // Add fixed base scalar mul constraints
+    add(constraint_system.fixed_base_scalar_mul_constraints,
+        [](Builder& builder, const auto& constraint) { create_fixed_base_constraint(builder, constraint); });
+
+    // Add variable base scalar mul constraints
+    add(constraint_system.variable_base_scalar_mul_constraints,
+        [](Builder& builder, const auto& constraint) { create_variable_base_constraint(builder, constraint); });
+
+    // Add ec add constraints
+    add(constraint_system.ec_add_constraints,
+        [has_valid_witness_assignments](Builder& builder, const auto& constraint) {
+            create_ec_add_constraint(builder, constraint, has_valid_witness_assignments);
+        });
+
+    return result;
+}
+
+/**
+ * @brief Add the black box constraints to the builder, either in order or, if parallel_construction is set, by
+ * splitting them into contiguous groups, each of which is built concurrently into its own fork of the builder, and
+ * merging the forks back in order
+ */
+template <typename Builder>
+void build_black_box_constraints(Builder& builder,
+                                 const std::vector<std::function<void(Builder&)>>& black_box_constraints,
+                                 bool parallel_construction)
+{
+    if constexpr (!IsGoblinBuilder<Builder>) {
+        if (parallel_construction) {
+            const size_t num_constraints = black_box_constraints.size();
+            const size_t num_groups = std::min(num_constraints, NUM_PARALLEL_CONSTRUCTION_GROUPS);
+            std::vector<std::optional<Builder>> sub_builders(num_groups);
+            parallel_for(num_groups, [&](size_t group) {
+                sub_builders[group] = builder.fork();
+                const size_t start = group * num_constraints / num_groups;
+                const size_t end = (group + 1) * num_constraints / num_groups;
+                for (size_t i = start; i < end; ++i) {
+                    black_box_constraints[i](*sub_builders[group]);
+                }
+            });
+            for (auto& sub_builder : sub_builders) {
+                builder.merge(std::move(*sub_builder));
+            }
+            return;
+        }
     }
+    for (const auto& create_constraint : black_box_constraints) {
+        create_constraint(builder);
+    }
+}
 
-    for (const auto& constraint : constraint_system.pedersen_hash_constraints) {
-        create_pedersen_hash_constraint(builder, constraint);
+} // namespace
+
+/**
+ * @brief Add the constraints of an ACIR constraint system to a builder
+ *
+ * @param parallel_construction Build the (independent) black box constraints concurrently into forks of the builder,
+ * see UltraCircuitBuilder::fork. The resulting circuit is equivalent to, but not identical with, the one built
+ * sequentially. Not supported for Goblin builders.
+ */
+template <typename Builder>
+void build_constraints(Builder& builder,
+                       AcirFormat const& constraint_system,
+                       bool has_valid_witness_assignments,
+                       bool parallel_construction)
+{
+    // Solve the keccak black boxes (in one batch), before any constraint is added
+    if (has_valid_witness_assignments) {
+        solve_keccak_constraints(builder, constraint_system.keccak_constraints);
     }
 
-    for (const auto& constraint : constraint_system.poseidon2_constraints) {
-        create_poseidon2_permutations(builder, constraint);
+    // Add arithmetic gates
+    for (const auto& constraint : constraint_system.poly_triple_constraints) {
+        builder.create_poly_gate(constraint);
     }
-    // Add fixed base scalar mul constraints
-    for (const auto& constraint : constraint_system.fixed_base_scalar_mul_constraints) {
-        create_fixed_base_constraint(builder, constraint);
+    for (const auto& constraint : constraint_system.quad_constraints) {
+        builder.create_big_mul_gate(constraint);
     }
 
-    // Add variable base scalar mul constraints
-    for (const auto& constraint : constraint_system.variable_base_scalar_mul_constraints) {
-        create_variable_base_constraint(builder, constraint);
+    // Add logic constraint
+    for (const auto& constraint : constraint_system.logic_constraints) {
+        create_logic_gate(
+            builder, constraint.a, constraint.b, constraint.result, constraint.num_bits, constraint.is_xor_gate);
     }
 
-    // Add ec add constraints
-    for (const auto& constraint : constraint_system.ec_add_constraints) {
-        create_ec_add_constraint(builder, constraint, has_valid_witness_assignments);
+    // Add range constraint
+    for (const auto& constraint : constraint_system.range_constraints) {
+        builder.create_range_constraint(constraint.witness, constraint.num_bits, "");
     }
 
+    // Add black box constraints
+    build_black_box_constraints(builder,
+                                get_black_box_constraints<Builder>(constraint_system, has_valid_witness_assignments),
+                                parallel_construction);
+
     // Add block constraints
     for (const auto& constraint : constraint_system.block_constraints) {
         create_block_constraints(builder, constraint, has_valid_witness_assignments);
@@ -217,14 +291,17 @@ void build_constraints(Builder& builder, AcirFormat const& constraint_system, bo
  * @return Builder
  */
 template <>
-UltraCircuitBuilder create_circuit(const AcirFormat& constraint_system, size_t size_hint, WitnessVector const& witness)
+UltraCircuitBuilder create_circuit(const AcirFormat& constraint_system,
+                                   size_t size_hint,
+                                   WitnessVector const& witness,
+                                   bool parallel_construction)
 {
     Builder builder{
         size_hint, witness, constraint_system.public_inputs, constraint_system.varnum, constraint_system.recursive
     };
 
     bool has_valid_witness_assignments = !witness.empty();
-    build_constraints(builder, constraint_system, has_valid_witness_assignments);
+    build_constraints(builder, constraint_system, has_valid_witness_assignments, parallel_construction);
 
     return builder;
 };
@@ -241,7 +318,8 @@ UltraCircuitBuilder create_circuit(const AcirFormat& constraint_system, size_t s
 template <>
 GoblinUltraCircuitBuilder create_circuit(const AcirFormat& constraint_system,
                                          [[maybe_unused]] size_t size_hint,
-                                         WitnessVector const& witness)
+                                         WitnessVector const& witness,
+                                         [[maybe_unused]] bool parallel_construction)
 {
     // Construct a builder using the witness and public input data from acir and with the goblin-owned op_queue
     auto op_queue = std::make_shared<ECCOpQueue>(); // instantiate empty op_queue
@@ -255,6 +333,9 @@ GoblinUltraCircuitBuilder create_circuit(const AcirFormat& constraint_system,
     return builder;
 };
 
-template void build_constraints<GoblinUltraCircuitBuilder>(GoblinUltraCircuitBuilder&, AcirFormat const&, bool);
+template void build_constraints<GoblinUltraCircuitBuilder>(GoblinUltraCircuitBuilder&,
+                                                          AcirFormat const&,
+                                                          bool,
+                                                          bool);
 
 } // namespace acir_format
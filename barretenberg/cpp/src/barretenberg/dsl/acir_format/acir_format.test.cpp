@@ -2,7 +2,10 @@
 #include <vector>
 
 #include "acir_format.hpp"
+#include "barretenberg/circuit_checker/circuit_checker.hpp"
 #include "barretenberg/common/streams.hpp"
+#include "barretenberg/crypto/pedersen_commitment/pedersen.hpp"
+#include "barretenberg/crypto/pedersen_hash/pedersen.hpp"
 #include "barretenberg/plonk/proof_system/types/proof.hpp"
 #include "barretenberg/serialize/test_helper.hpp"
 #include "ecdsa_secp256k1.hpp"
@@ -517,3 +520,113 @@ TEST_F(AcirFormatTests, TestKeccakPermutation)
 
     EXPECT_EQ(verifier.verify_proof(proof), true);
 }
+
+/**
+ * @brief Build pedersen, schnorr and fixed base scalar multiplication constraints in parallel, which all use the shared
+ * generator tables (the pedersen constraints extend them), and check the result against the sequentially built circuit
+ */
+TEST_F(AcirFormatTests, ParallelConstructionWithSharedGenerators)
+{
+    constexpr size_t NUM_CONSTRAINTS_PER_TYPE = 8;
+    WitnessVector witness;
+    const auto add_witness = [&](const fr& value) {
+        witness.emplace_back(value);
+        return static_cast<uint32_t>(witness.size() - 1);
+    };
+
+    std::vector<PedersenConstraint> pedersen_constraints;
+    std::vector<PedersenHashConstraint> pedersen_hash_constraints;
+    std::vector<SchnorrConstraint> schnorr_constraints;
+    std::vector<FixedBaseScalarMul> fixed_base_scalar_mul_constraints;
+    for (size_t i = 0; i < NUM_CONSTRAINTS_PER_TYPE; ++i) {
+        // Generator offsets beyond the precomputed ones, so that the generators are derived on demand
+        const uint32_t hash_index = static_cast<uint32_t>(40 + i);
+        const std::vector<fr> inputs{ fr::random_element(), fr::random_element() };
+        const std::vector<uint32_t> scalars{ add_witness(inputs[0]), add_witness(inputs[1]) };
+        const auto commitment = crypto::pedersen_commitment::commit_native(inputs, hash_index);
+        pedersen_constraints.push_back(PedersenConstraint{ .scalars = scalars,
+                                                           .hash_index = hash_index,
+                                                           .result_x = add_witness(commitment.x),
+                                                           .result_y = add_witness(commitment.y) });
+        pedersen_hash_constraints.push_back(PedersenHashConstraint{
+            .scalars = scalars,
+            .hash_index = hash_index,
+            .result = add_witness(crypto::pedersen_hash::hash(inputs, hash_index)),
+        });
+
+        const std::string message_string = "tenletters";
+        schnorr_key_pair<grumpkin::fr, grumpkin::g1> account;
+        account.private_key = grumpkin::fr::random_element();
+        account.public_key = grumpkin::g1::one * account.private_key;
+        const schnorr_signature signature_raw =
+            schnorr_construct_signature<Blake2sHasher, grumpkin::fq, grumpkin::fr, grumpkin::g1>(message_string,
+                                                                                               account);
+        std::vector<uint32_t> message;
+        for (const char c : message_string) {
+            message.push_back(add_witness(static_cast<uint64_t>(c)));
+        }
+        SchnorrConstraint schnorr_constraint{ .message = message,
+                                              .public_key_x = add_witness(account.public_key.x),
+                                              .public_key_y = add_witness(account.public_key.y),
+                                              .result = add_witness(1),
+                                              .signature = {} };
+        for (size_t j = 0; j < 32; ++j) {
+            schnorr_constraint.signature[j] = add_witness(signature_raw.s[j]);
+            schnorr_constraint.signature[32 + j] = add_witness(signature_raw.e[j]);
+        }
+        schnorr_constraints.push_back(schnorr_constraint);
+
+        const grumpkin::fr scalar = grumpkin::fr::random_element();
+        const uint256_t scalar_value(scalar);
+        const grumpkin::g1::affine_element public_key(grumpkin::g1::one * scalar);
+        fixed_base_scalar_mul_constraints.push_back(FixedBaseScalarMul{
+            .low = add_witness(scalar_value.slice(0, 128)),
+            .high = add_witness(scalar_value.slice(128, 256)),
+            .pub_key_x = add_witness(public_key.x),
+            .pub_key_y = add_witness(public_key.y),
+        });
+    }
+
+    AcirFormat constraint_system{ .varnum = static_cast<uint32_t>(witness.size()),
+                                  .recursive = false,
+                                  .public_inputs = {},
+                                  .logic_constraints = {},
+                                  .range_constraints = {},
+                                  .sha256_constraints = {},
+                                  .sha256_compression = {},
+                                  .schnorr_constraints = schnorr_constraints,
+                                  .ecdsa_k1_constraints = {},
+                                  .ecdsa_r1_constraints = {},
+                                  .blake2s_constraints = {},
+                                  .blake3_constraints = {},
+                                  .keccak_constraints = {},
+                                  .keccak_permutations = {},
+                                  .pedersen_constraints = pedersen_constraints,
+                                  .pedersen_hash_constraints = pedersen_hash_constraints,
+                                  .poseidon2_constraints = {},
+                                  .fixed_base_scalar_mul_constraints = fixed_base_scalar_mul_constraints,
+                                  .variable_base_scalar_mul_constraints = {},
+                                  .ec_add_constraints = {},
+                                  .recursion_constraints = {},
+                                  .bigint_from_le_bytes_constraints = {},
+                                  .bigint_to_le_bytes_constraints = {},
+                                  .bigint_operations = {},
+                                  .poly_triple_constraints = {},
+                                  .quad_constraints = {},
+                                  .block_constraints = {} };
+
+    // Repeat the construction, since races do not necessarily show up on every run
+    for (size_t run = 0; run < 4; ++run) {
+        auto builder = create_circuit(constraint_system, /*size_hint=*/0, witness, /*parallel_construction=*/true);
+        EXPECT_FALSE(builder.failed());
+        EXPECT_TRUE(CircuitChecker::check(builder));
+        for (const auto& schnorr_constraint : schnorr_constraints) {
+            EXPECT_EQ(builder.get_variable(schnorr_constraint.result), 1);
+        }
+        if (run == 0) {
+            auto sequential_builder = create_circuit(constraint_system, /*size_hint=*/0, witness);
+            // Merging drops the gates the forks duplicate, i.e. those of range lists and constants
+            EXPECT_EQ(builder.get_num_gates(), sequential_builder.get_num_gates());
+        }
+    }
+}
@@ -1,5 +1,6 @@
 #include "ecdsa_secp256k1.hpp"
 #include "acir_format.hpp"
+#include "barretenberg/circuit_checker/circuit_checker.hpp"
 #include "barretenberg/crypto/ecdsa/ecdsa.hpp"
 #include "barretenberg/plonk/proof_system/types/proof.hpp"
 #include "barretenberg/plonk/proof_system/verification_key/verification_key.hpp"
@@ -222,3 +223,55 @@ TEST_F(ECDSASecp256k1, TestECDSAConstraintFail)
     auto verifier = composer.create_verifier(builder);
     EXPECT_EQ(verifier.verify_proof(proof), true);
 }
+
+// Build several signature checks concurrently into forks of the builder, and make sure the merged circuit is satisfied
+TEST_F(ECDSASecp256k1, TestECDSAConstraintsParallelConstruction)
+{
+    EcdsaSecp256k1Constraint ecdsa_k1_constraint;
+    WitnessVector witness_values;
+    size_t num_variables = generate_ecdsa_constraint(ecdsa_k1_constraint, witness_values);
+    AcirFormat constraint_system{
+        .varnum = static_cast<uint32_t>(num_variables),
+        .recursive = false,
+        .public_inputs = {},
+        .logic_constraints = {},
+        .range_constraints = {},
+        .sha256_constraints = {},
+        .sha256_compression = {},
+        .schnorr_constraints = {},
+        .ecdsa_k1_constraints = { ecdsa_k1_constraint, ecdsa_k1_constraint, ecdsa_k1_constraint },
+        .ecdsa_r1_constraints = {},
+        .blake2s_constraints = {},
+        .blake3_constraints = {},
+        .keccak_constraints = {},
+        .keccak_permutations = {},
+        .pedersen_constraints = {},
+        .pedersen_hash_constraints = {},
+        .poseidon2_constraints = {},
+        .fixed_base_scalar_mul_constraints = {},
+        .variable_base_scalar_mul_constraints = {},
+        .ec_add_constraints = {},
+        .recursion_constraints = {},
+        .bigint_from_le_bytes_constraints = {},
+        .bigint_to_le_bytes_constraints = {},
+        .bigint_operations = {},
+        .poly_triple_constraints = {},
+        .quad_constraints = {},
+        .block_constraints = {},
+    };
+
+    auto builder = create_circuit(constraint_system, /*size_hint*/ 0, witness_values, /*parallel_construction=*/true);
+    EXPECT_EQ(builder.get_variable(ecdsa_k1_constraint.result), 1);
+    EXPECT_FALSE(builder.failed());
+    EXPECT_TRUE(CircuitChecker::check(builder));
+
+    // Each fork creates (and fixes) its own copies of the constants used by the constraints, which the sequentially
+    // built circuit shares between them
+    auto sequential_builder = create_circuit(constraint_system, /*size_hint*/ 0, witness_values);
+    EXPECT_GE(builder.get_num_gates(), sequential_builder.get_num_gates());
+    EXPECT_LT(builder.get_num_gates(), sequential_builder.get_num_gates() * 11 / 10);
+
+    // The verifier builds the circuit without a witness
+    auto verifier_builder = create_circuit(constraint_system, /*size_hint*/ 0, {}, /*parallel_construction=*/true);
+    EXPECT_EQ(verifier_builder.get_num_gates(), builder.get_num_gates());
+}
@@ -1,10 +1,60 @@
 #include "keccak_constraint.hpp"
+#include "barretenberg/crypto/keccak/keccak.hpp"
 #include "barretenberg/stdlib/hash/keccak/keccak.hpp"
 #include "barretenberg/stdlib/primitives/circuit_builders/circuit_builders_fwd.hpp"
 #include "round.hpp"
 
 namespace acir_format {
 
+/**
+ * @brief Compute the result witnesses of the keccak black box functions from their message witnesses
+ *
+ * @details This is the native counterpart of create_keccak_constraints, i.e. what the black box solver of the ACVM
+ * does. The messages of all constraints are hashed at once with ethash_keccak256_batch, which uses the multi-lane
+ * Keccak-f[1600] kernels if the CPU supports them. Must be called before any constraint is added, while the variables
+ * of the builder are still the ACIR witnesses.
+ */
+template <typename Builder>
+void solve_keccak_constraints(Builder& builder, const std::vector<KeccakConstraint>& constraints)
+{
+    // The message of each constraint is the concatenation of its inputs, in the big-endian byte order of byte_array,
+    // truncated to its (variable) size
+    std::vector<std::vector<uint8_t>> messages;
+    messages.reserve(constraints.size());
+    for (const auto& constraint : constraints) {
+        std::vector<uint8_t> message;
+        for (const auto& input : constraint.inputs) {
+            const uint256_t value = builder.get_variable(input.witness);
+            const size_t num_bytes = round_to_nearest_byte(input.num_bits);
+            for (size_t i = 0; i < num_bytes; ++i) {
+                message.push_back(static_cast<uint8_t>(value >> ((num_bytes - i - 1) * 8)));
+            }
+        }
+        const auto message_size = static_cast<size_t>(uint256_t(builder.get_variable(constraint.var_message_size)));
+        ASSERT(message_size <= message.size());
+        message.resize(message_size);
+        messages.push_back(std::move(message));
+    }
+
+    std::vector<const uint8_t*> data;
+    std::vector<size_t> sizes;
+    data.reserve(messages.size());
+    sizes.reserve(messages.size());
+    for (const auto& message : messages) {
+        data.push_back(message.data());
+        sizes.push_back(message.size());
+    }
+    std::vector<keccak256> hashes(messages.size());
+    ethash_keccak256_batch(data.data(), sizes.data(), messages.size(), hashes.data());
+
+    for (size_t i = 0; i < constraints.size(); ++i) {
+        const auto* hash_bytes = reinterpret_cast<const uint8_t*>(hashes[i].word64s);
+        for (size_t j = 0; j < constraints[i].result.size(); ++j) {
+            builder.variables[constraints[i].result[j]] = hash_bytes[j];
+        }
+    }
+}
+
 template <typename Builder> void create_keccak_constraints(Builder& builder, const KeccakConstraint& constraint)
 {
     using byte_array_ct = bb::stdlib::byte_array<Builder>;
@@ -60,11 +110,16 @@ template <typename Builder> void create_keccak_permutations(Builder& builder, co
         builder.assert_equal(output_state[i].normalize().witness_index, constraint.result[i]);
     }
 }
+template void solve_keccak_constraints<UltraCircuitBuilder>(UltraCircuitBuilder& builder,
+                                                            const std::vector<KeccakConstraint>& constraints);
 template void create_keccak_constraints<UltraCircuitBuilder>(UltraCircuitBuilder& builder,
                                                              const KeccakConstraint& constraint);
 template void create_keccak_permutations<UltraCircuitBuilder>(UltraCircuitBuilder& builder,
                                                               const Keccakf1600& constraint);
 
+template void solve_keccak_constraints<GoblinUltraCircuitBuilder>(GoblinUltraCircuitBuilder& builder,
+                                                                  const std::vector<KeccakConstraint>& constraints);
+
 template void create_keccak_constraints<GoblinUltraCircuitBuilder>(GoblinUltraCircuitBuilder& builder,
                                                                    const KeccakConstraint& constraint);
 
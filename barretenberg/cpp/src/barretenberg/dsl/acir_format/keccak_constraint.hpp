@@ -34,6 +34,8 @@ struct KeccakConstraint {
     friend bool operator==(KeccakConstraint const& lhs, KeccakConstraint const& rhs) = default;
 };
 
+template <typename Builder>
+void solve_keccak_constraints(Builder& builder, const std::vector<KeccakConstraint>& constraints);
 template <typename Builder> void create_keccak_constraints(Builder& builder, const KeccakConstraint& constraint);
 template <typename Builder> void create_keccak_permutations(Builder& builder, const Keccakf1600& constraint);
 
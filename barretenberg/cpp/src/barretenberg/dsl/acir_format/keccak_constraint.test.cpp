@@ -0,0 +1,75 @@
+#include "keccak_constraint.hpp"
+#include "acir_format.hpp"
+#include "barretenberg/circuit_checker/circuit_checker.hpp"
+#include "barretenberg/crypto/keccak/keccak.hpp"
+
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace acir_format::tests {
+
+class KeccakConstraintTests : public ::testing::Test {
+  protected:
+    static void SetUpTestSuite() { bb::srs::init_crs_factory("../srs_db/ignition"); }
+};
+
+// The result witnesses of keccak constraints are solved natively (in one batch) when the circuit is built
+TEST_F(KeccakConstraintTests, SolveResults)
+{
+    const std::vector<uint8_t> message{ 'a', 'b', 'c' };
+    // Witnesses 1-3 hold the message bytes, 4 and 5 the sizes of the two hashed prefixes, 6-37 and 38-69 the results
+    WitnessVector witness{ 0, message[0], message[1], message[2], 3, 2 };
+    witness.resize(70, 0);
+    std::vector<HashInput> inputs{ { .witness = 1, .num_bits = 8 },
+                                   { .witness = 2, .num_bits = 8 },
+                                   { .witness = 3, .num_bits = 8 } };
+    std::vector<KeccakConstraint> keccak_constraints(2);
+    for (size_t i = 0; i < 2; ++i) {
+        keccak_constraints[i].inputs = inputs;
+        keccak_constraints[i].var_message_size = static_cast<uint32_t>(4 + i);
+        for (size_t j = 0; j < 32; ++j) {
+            keccak_constraints[i].result[j] = static_cast<uint32_t>(6 + 32 * i + j);
+        }
+    }
+
+    AcirFormat constraint_system{ .varnum = 70,
+                                  .recursive = false,
+                                  .public_inputs = {},
+                                  .logic_constraints = {},
+                                  .range_constraints = {},
+                                  .sha256_constraints = {},
+                                  .sha256_compression = {},
+                                  .schnorr_constraints = {},
+                                  .ecdsa_k1_constraints = {},
+                                  .ecdsa_r1_constraints = {},
+                                  .blake2s_constraints = {},
+                                  .blake3_constraints = {},
+                                  .keccak_constraints = keccak_constraints,
+                                  .keccak_permutations = {},
+                                  .pedersen_constraints = {},
+                                  .pedersen_hash_constraints = {},
+                                  .poseidon2_constraints = {},
+                                  .fixed_base_scalar_mul_constraints = {},
+                                  .variable_base_scalar_mul_constraints = {},
+                                  .ec_add_constraints = {},
+                                  .recursion_constraints = {},
+                                  .bigint_from_le_bytes_constraints = {},
+                                  .bigint_to_le_bytes_constraints = {},
+                                  .bigint_operations = {},
+                                  .poly_triple_constraints = {},
+                                  .quad_constraints = {},
+                                  .block_constraints = {} };
+
+    auto builder = create_circuit(constraint_system, /*size_hint=*/0, witness);
+    EXPECT_TRUE(CircuitChecker::check(builder));
+
+    for (size_t i = 0; i < 2; ++i) {
+        const auto expected = ethash_keccak256(message.data(), 3 - i);
+        const auto* expected_bytes = reinterpret_cast<const uint8_t*>(expected.word64s);
+        for (size_t j = 0; j < 32; ++j) {
+            EXPECT_EQ(builder.get_variable(keccak_constraints[i].result[j]), expected_bytes[j]);
+        }
+    }
+}
+
+} // namespace acir_format::tests
@@ -81,11 +81,10 @@ void AcirComposer::load_verification_key(bb::plonk::verification_key_data&& data
                                                                       srs::get_bn254_crs_factory()->get_verifier_crs());
 }
 
-bool AcirComposer::verify_proof(std::vector<uint8_t> const& proof)
+void AcirComposer::prepare_verification(std::vector<uint8_t> const& proof)
 {
-    acir_format::Composer composer(proving_key_, verification_key_);
-
     if (!verification_key_) {
+        acir_format::Composer composer(proving_key_, verification_key_);
         vinfo("computing verification key...");
         verification_key_ = composer.compute_verification_key(builder_);
         vinfo("done.");
@@ -93,6 +92,12 @@ bool AcirComposer::verify_proof(std::vector<uint8_t> const& proof)
 
     // Hack. Shouldn't need to do this. 2144 is size with no public inputs.
     builder_.public_inputs.resize((proof.size() - 2144) / 32);
+}
+
+bool AcirComposer::verify_proof(std::vector<uint8_t> const& proof)
+{
+    prepare_verification(proof);
+    acir_format::Composer composer(proving_key_, verification_key_);
 
     if (verification_key_->is_recursive_circuit) {
         auto verifier = composer.create_verifier(builder_);
@@ -103,6 +108,40 @@ bool AcirComposer::verify_proof(std::vector<uint8_t> const& proof)
     }
 }
 
+/**
+ * @brief Verify a batch of proofs, each against the verification key of its composer, with a single pairing check
+ *
+ * @details The same composer may appear several times, e.g. to verify many proofs of one circuit. Recursive circuits
+ * and the others use different transcripts, so each kind is batched on its own, with one pairing check each.
+ *
+ * @return true iff every proof verifies
+ */
+bool AcirComposer::verify_proofs(std::span<AcirComposer* const> composers, std::span<const std::vector<uint8_t>> proofs)
+{
+    ASSERT(composers.size() == proofs.size());
+
+    std::vector<plonk::UltraVerifier> verifiers;
+    std::vector<plonk::proof> verifier_proofs;
+    std::vector<plonk::UltraWithKeccakVerifier> keccak_verifiers;
+    std::vector<plonk::proof> keccak_verifier_proofs;
+    for (size_t i = 0; i < proofs.size(); ++i) {
+        auto& acir_composer = *composers[i];
+        acir_composer.prepare_verification(proofs[i]);
+        acir_format::Composer composer(acir_composer.proving_key_, acir_composer.verification_key_);
+
+        if (acir_composer.verification_key_->is_recursive_circuit) {
+            verifiers.emplace_back(composer.create_verifier(acir_composer.builder_));
+            verifier_proofs.push_back({ proofs[i] });
+        } else {
+            keccak_verifiers.emplace_back(composer.create_ultra_with_keccak_verifier(acir_composer.builder_));
+            keccak_verifier_proofs.push_back({ proofs[i] });
+        }
+    }
+
+    return plonk::UltraVerifier::batch_verify(verifiers, verifier_proofs) &&
+           plonk::UltraWithKeccakVerifier::batch_verify(keccak_verifiers, keccak_verifier_proofs);
+}
+
 std::string AcirComposer::get_solidity_verifier()
 {
     std::ostringstream stream;
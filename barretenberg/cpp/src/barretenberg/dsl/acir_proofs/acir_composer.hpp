@@ -1,5 +1,6 @@
 #pragma once
 #include <barretenberg/dsl/acir_format/acir_format.hpp>
+#include <span>
 
 namespace acir_proofs {
 
@@ -29,6 +30,8 @@ class AcirComposer {
 
     bool verify_proof(std::vector<uint8_t> const& proof);
 
+    static bool verify_proofs(std::span<AcirComposer* const> composers, std::span<const std::vector<uint8_t>> proofs);
+
     std::string get_solidity_verifier();
     size_t get_total_circuit_size() { return builder_.get_total_circuit_size(); };
     size_t get_dyadic_circuit_size() { return builder_.get_circuit_subgroup_size(builder_.get_total_circuit_size()); };
@@ -38,6 +41,8 @@ class AcirComposer {
     std::vector<bb::fr> serialize_verification_key_into_fields();
 
   private:
+    void prepare_verification(std::vector<uint8_t> const& proof);
+
     acir_format::Builder builder_;
     size_t size_hint_;
     std::shared_ptr<bb::plonk::proving_key> proving_key_;
@@ -159,6 +159,14 @@ WASM_EXPORT void acir_verify_proof(in_ptr acir_composer_ptr, uint8_t const* proo
     *result = acir_composer->verify_proof(proof);
 }
 
+WASM_EXPORT void acir_verify_proofs(in_ptr acir_composer_ptr, uint8_t const* proofs_buf, bool* result)
+{
+    auto acir_composer = reinterpret_cast<acir_proofs::AcirComposer*>(*acir_composer_ptr);
+    auto proofs = from_buffer<std::vector<std::vector<uint8_t>>>(proofs_buf);
+    std::vector<acir_proofs::AcirComposer*> composers(proofs.size(), acir_composer);
+    *result = acir_proofs::AcirComposer::verify_proofs(composers, proofs);
+}
+
 WASM_EXPORT void acir_get_solidity_verifier(in_ptr acir_composer_ptr, out_str_buf out)
 {
     auto acir_composer = reinterpret_cast<acir_proofs::AcirComposer*>(*acir_composer_ptr);
@@ -69,6 +69,12 @@ WASM_EXPORT void acir_get_proving_key(in_ptr acir_composer_ptr, uint8_t const* a
 
 WASM_EXPORT void acir_verify_proof(in_ptr acir_composer_ptr, uint8_t const* proof_buf, bool* result);
 
+/**
+ * @brief Verifies a batch of proofs against the verification key of the composer, with a single pairing check
+ *
+ */
+WASM_EXPORT void acir_verify_proofs(in_ptr acir_composer_ptr, uint8_t const* proofs_buf, bool* result);
+
 /**
  * @brief Verifies a full goblin proof (and the GUH proof produced by accumulation)
  *
@@ -0,0 +1,82 @@
+#pragma once
+
+#include "./bn254.hpp"
+#include "./pairing.hpp"
+#include "barretenberg/ecc/scalar_multiplication/runtime_states.hpp"
+#include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
+#include "barretenberg/numeric/random/engine.hpp"
+
+#include <array>
+#include <span>
+#include <vector>
+
+namespace bb::pairing {
+
+/**
+ * @brief Checks e(P₀ᵢ,[1]₂)⋅e(P₁ᵢ,[x]₂) ≡ [1]ₜ for every pair of pairing points (P₀ᵢ, P₁ᵢ) using a single pairing
+ *
+ * @details This is the final check of KZG-based verifiers (Plonk and Honk). Instead of evaluating one pairing per
+ * proof, pair i is weighted by an independent random 128-bit scalar rᵢ (r₀ = 1) and we check
+ *
+ *      e(∑ rᵢ⋅P₀ᵢ, [1]₂)⋅e(∑ rᵢ⋅P₁ᵢ, [x]₂) ≡ [1]ₜ
+ *
+ * The two sums are computed with one MSM each, so N proofs cost a single two-point Miller loop and a single final
+ * exponentiation. If any individual equation does not hold, the batched one holds with probability at most 2⁻¹²⁸.
+ * The scalars must be unpredictable to the prover, so they are drawn from the system randomness.
+ *
+ * @param pairing_points The (P₀, P₁) pair produced by each individual verifier
+ * @param precomputed_g2_lines Precomputed Miller loop lines for [1]₂ and [x]₂
+ * @return true if every pairing equation holds (with overwhelming probability)
+ */
+inline bool batch_pairing_check(std::span<const std::array<g1::element, 2>> pairing_points,
+                                const miller_lines* precomputed_g2_lines)
+{
+    const size_t num_pairs = pairing_points.size();
+    if (num_pairs == 0) {
+        return true;
+    }
+
+    std::vector<fr> batching_scalars(num_pairs);
+    batching_scalars[0] = fr::one();
+    auto& engine = numeric::get_randomness();
+    for (size_t i = 1; i < num_pairs; ++i) {
+        const uint128_t random_bits = engine.get_random_uint128();
+        batching_scalars[i] =
+            fr(uint256_t(static_cast<uint64_t>(random_bits), static_cast<uint64_t>(random_bits >> 64), 0, 0));
+    }
+
+    auto state = scalar_multiplication::PippengerRuntimeStatePool<curve::BN254>::acquire(num_pairs);
+    g1::element batched[2];
+    for (size_t j = 0; j < 2; ++j) {
+        std::vector<g1::element> points(num_pairs);
+        for (size_t i = 0; i < num_pairs; ++i) {
+            points[i] = pairing_points[i][j];
+        }
+        g1::element::batch_normalize(points.data(), num_pairs);
+
+        // Points at infinity contribute nothing to the sum and are not handled by pippenger, so we drop them here
+        std::vector<fr> scalars;
+        std::vector<g1::affine_element> affine_points;
+        scalars.reserve(num_pairs);
+        affine_points.reserve(num_pairs * 2);
+        for (size_t i = 0; i < num_pairs; ++i) {
+            if (!points[i].is_point_at_infinity()) {
+                scalars.emplace_back(batching_scalars[i]);
+                affine_points.emplace_back(points[i].x, points[i].y);
+            }
+        }
+        const size_t num_points = scalars.size();
+        affine_points.resize(num_points * 2);
+        scalar_multiplication::generate_pippenger_point_table<curve::BN254>(
+            affine_points.data(), affine_points.data(), num_points);
+        batched[j] = scalar_multiplication::pippenger<curve::BN254>(
+            scalars.data(), affine_points.data(), num_points, *state, /*handle_edge_cases=*/true);
+    }
+
+    g1::element::batch_normalize(batched, 2);
+    g1::affine_element batched_affine[2]{ batched[0], batched[1] };
+    fq12 result = reduced_ate_pairing_batch_precomputed(batched_affine, precomputed_g2_lines, 2);
+    return result == fq12::one();
+}
+
+} // namespace bb::pairing
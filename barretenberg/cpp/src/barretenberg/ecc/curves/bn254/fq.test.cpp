@@ -318,6 +318,20 @@ TEST(fq, InvertOneIsOne)
     EXPECT_EQ((result == fq::one()), true);
 }
 
+TEST(fq, InvertMatchesPow)
+{
+    // invert() uses safegcd where available; check it against the Fermat inversion it replaced
+    std::vector<fq> inputs{ fq::one(), fq::neg_one(), fq(2), fq(fq::modulus - 2) };
+    for (size_t i = 0; i < 100; ++i) {
+        inputs.emplace_back(fq::random_element());
+    }
+    for (const auto& input : inputs) {
+        fq expected = input.pow(fq::modulus_minus_two);
+        EXPECT_EQ(input.invert(), expected);
+        EXPECT_EQ(input * input.invert(), fq::one());
+    }
+}
+
 TEST(fq, Sqrt)
 {
     fq input = fq::one();
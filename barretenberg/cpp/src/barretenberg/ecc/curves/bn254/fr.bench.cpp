@@ -423,6 +423,7 @@ void invert_bench(State& state) noexcept
 }
 BENCHMARK(invert_bench);
 
+// Fermat inversion x^(p-2), the reference for the safegcd inversion used by invert()
 void pow_bench(State& state) noexcept
 {
     for (auto _ : state) {
@@ -436,5 +437,24 @@ void pow_bench(State& state) noexcept
 }
 BENCHMARK(pow_bench);
 
+// Small batch inversions (e.g. in affine bucket additions and verifiers) are dominated by their one field inversion
+void batch_invert_bench(State& state) noexcept
+{
+    const auto batch_size = static_cast<size_t>(state.range(0));
+    std::vector<fr> elements(batch_size);
+    fr x = accx;
+    for (auto& element : elements) {
+        element = x;
+        x = x * accx;
+    }
+    for (auto _ : state) {
+        for (size_t i = 0; i < NUM_INVERSIONS / batch_size; ++i) {
+            fr::batch_invert(elements);
+        }
+        DoNotOptimize(elements[0]);
+    }
+}
+BENCHMARK(batch_invert_bench)->RangeMultiplier(4)->Range(4, 256);
+
 // NOLINTNEXTLINE macro invokation triggers style guideline errors from googletest code
 BENCHMARK_MAIN();
@@ -245,6 +245,20 @@ TEST(fr, InvertOneIsOne)
     EXPECT_EQ((result == fr::one()), true);
 }
 
+TEST(fr, InvertMatchesPow)
+{
+    // invert() uses safegcd where available; check it against the Fermat inversion it replaced
+    std::vector<fr> inputs{ fr::one(), fr::neg_one(), fr(2), fr(fr::modulus - 2) };
+    for (size_t i = 0; i < 100; ++i) {
+        inputs.emplace_back(fr::random_element());
+    }
+    for (const auto& input : inputs) {
+        fr expected = input.pow(fr::modulus_minus_two);
+        EXPECT_EQ(input.invert(), expected);
+        EXPECT_EQ(input * input.invert(), fr::one());
+    }
+}
+
 TEST(fr, Sqrt)
 {
     fr input = fr::one();
@@ -1,4 +1,5 @@
 #include "pairing.hpp"
+#include "batch_pairing_check.hpp"
 #include <gtest/gtest.h>
 
 using namespace bb;
@@ -127,4 +128,26 @@ TEST(pairing, ReducedAtePairingPrecomputeConsistencyCheckBatch)
     fq12 expected = pairing::reduced_ate_pairing_batch(&P_b[0], &Q_b[0], num_points).from_montgomery_form();
 
     EXPECT_EQ(result, expected);
-}
\ No newline at end of file
+}
+
+TEST(pairing, BatchPairingCheck)
+{
+    // Lines for [1]₂ and [x]₂ as in a KZG verifier SRS
+    const fr x = fr::random_element();
+    std::array<pairing::miller_lines, 2> lines;
+    pairing::precompute_miller_lines(g2::one, lines[0]);
+    pairing::precompute_miller_lines(g2::element(g2::affine_element(g2::one * x)), lines[1]);
+
+    // Valid pairs satisfy e(P₀,[1]₂)⋅e(P₁,[x]₂) ≡ [1]ₜ, i.e. P₀ = -x⋅P₁
+    constexpr size_t num_pairs = 40;
+    std::vector<std::array<g1::element, 2>> pairing_points(num_pairs);
+    for (auto& points : pairing_points) {
+        const g1::element P1 = g1::element::random_element();
+        points = { -(P1 * x), P1 };
+    }
+    EXPECT_TRUE(pairing::batch_pairing_check(pairing_points, lines.data()));
+
+    // A single invalid pair must make the whole batch fail
+    pairing_points[num_pairs / 2][0] += g1::one;
+    EXPECT_FALSE(pairing::batch_pairing_check(pairing_points, lines.data()));
+}
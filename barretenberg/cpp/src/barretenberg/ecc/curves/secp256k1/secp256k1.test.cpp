@@ -130,6 +130,19 @@ TEST(secp256k1, TestSqr)
     }
 }
 
+TEST(secp256k1, InvertMatchesPow)
+{
+    // The secp256k1 moduli use the full 256 bits, the widest inputs the safegcd inversion supports
+    for (size_t i = 0; i < 100; ++i) {
+        secp256k1::fq fq_input = secp256k1::fq::random_element();
+        EXPECT_EQ(fq_input.invert(), fq_input.pow(secp256k1::fq::modulus_minus_two));
+        secp256k1::fr fr_input = secp256k1::fr::random_element();
+        EXPECT_EQ(fr_input.invert(), fr_input.pow(secp256k1::fr::modulus_minus_two));
+    }
+    secp256k1::fq max_input(secp256k1::fq::modulus - 1);
+    EXPECT_EQ(max_input.invert(), max_input);
+}
+
 TEST(secp256k1, TestArithmetic)
 {
     secp256k1::fq a = secp256k1::fq::random_element();
@@ -597,6 +597,7 @@ template <class Params_> struct alignas(32) field {
 
 #if defined(__SIZEOF_INT128__) && !defined(__wasm__)
     static constexpr uint128_t lo_mask = 0xffffffffffffffffUL;
+    field invert_safegcd() const noexcept;
 #endif
 };
 
@@ -0,0 +1,351 @@
+#include "./fixed_base_msm.hpp"
+#include "./signed_digits.hpp"
+
+#include "barretenberg/common/assert.hpp"
+#include "barretenberg/common/log.hpp"
+#include "barretenberg/common/mem.hpp"
+#include "barretenberg/common/op_count.hpp"
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/crypto/sha256/sha256.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <limits>
+#include <span>
+#include <vector>
+
+#ifndef __wasm__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/**
+ * Fixed-base variant of the signed-digit MSM in signed_digit_msm.cpp. The scalars are split and recoded exactly as
+ * there, but since the multiples 2^{jc}⋅Q_p are precomputed, every digit of every window is added into one shared set
+ * of 2^{c-1} buckets. The MSM is parallelised over the points, each thread owning a set of buckets.
+ **/
+
+// NOLINTBEGIN(readability-identifier-length)
+
+namespace bb::scalar_multiplication {
+
+using signed_digits::get_window;
+using signed_digits::MAX_WINDOW_BITS;
+using signed_digits::MIN_WINDOW_BITS;
+using signed_digits::RECODED_BITS;
+using signed_digits::RecodedScalar;
+using signed_digits::XYZZBucket;
+
+namespace {
+
+// Layout of the cache file: this header, padded to a cache line, followed by the table
+struct FixedBaseCacheHeader {
+    static constexpr uint64_t MAGIC = 0x62622d6662746162; // "bb-fbtab"
+    uint64_t magic;
+    uint64_t num_initial_points;
+    uint64_t window_bits;
+    uint64_t point_size;
+    // SHA-256 of the entries of the point table the multiples were computed from
+    std::array<uint8_t, 32> point_table_hash;
+};
+static_assert(sizeof(FixedBaseCacheHeader) == 64);
+
+} // namespace
+
+template <typename Curve> size_t FixedBaseMsmTable<Curve>::get_num_windows(const size_t window_bits)
+{
+    return (RECODED_BITS + window_bits - 1) / window_bits;
+}
+
+template <typename Curve>
+size_t FixedBaseMsmTable<Curve>::get_size_in_bytes(const size_t num_initial_points, const size_t window_bits)
+{
+    return num_initial_points * 2 * get_num_windows(window_bits) * sizeof(AffineElement);
+}
+
+/**
+ * @brief Choose the window width that minimises the cost of a fixed-base MSM over all the points of the table
+ *
+ * @details One mixed addition per point and window, spread over the threads, plus the running-sum reduction of each
+ * thread's 2^{c-1} buckets. Wider windows need fewer windows and hence also less memory.
+ */
+template <typename Curve> size_t FixedBaseMsmTable<Curve>::get_optimal_window_bits(const size_t num_initial_points)
+{
+    constexpr double MIXED_ADD_COST = 10.0;
+    constexpr double ADD_COST = 14.0;
+    const auto num_threads = static_cast<double>(get_num_cpus());
+    size_t best = MIN_WINDOW_BITS;
+    double best_cost = std::numeric_limits<double>::max();
+    for (size_t c = MIN_WINDOW_BITS; c <= MAX_WINDOW_BITS; ++c) {
+        const auto num_additions = static_cast<double>(num_initial_points * 2 * get_num_windows(c));
+        const double cost =
+            num_additions * MIXED_ADD_COST / num_threads + static_cast<double>(1UL << (c - 1)) * 2 * ADD_COST;
+        if (cost < best_cost) {
+            best_cost = cost;
+            best = c;
+        }
+    }
+    return best;
+}
+
+/**
+ * @param point_table the pippenger point table of the bases, see `generate_pippenger_point_table`
+ * @param num_initial_points the number of bases (half the number of point table entries)
+ * @param window_bits the window width c
+ * @param cache_path if non-empty, a file to load the table from or, failing that, to store it in
+ */
+template <typename Curve>
+FixedBaseMsmTable<Curve>::FixedBaseMsmTable(const AffineElement* point_table,
+                                            const size_t num_initial_points,
+                                            const size_t window_bits,
+                                            const std::string& cache_path)
+    : num_initial_points(num_initial_points)
+    , window_bits(window_bits)
+    , num_windows(get_num_windows(window_bits))
+{
+    using Element = typename Curve::Element;
+    ASSERT(window_bits >= MIN_WINDOW_BITS && window_bits <= MAX_WINDOW_BITS);
+
+    PointTableHash point_table_hash{};
+    if (!cache_path.empty()) {
+        point_table_hash = hash_point_table(point_table);
+        if (load_cache(point_table_hash, cache_path)) {
+            loaded_from_cache = true;
+            return;
+        }
+    }
+
+    // Points are processed in blocks, so that the projective multiples can be normalized with one batch inversion
+    // per block without materialising the whole table in projective form
+    constexpr size_t BLOCK_SIZE = 1024;
+    const size_t num_points = num_initial_points * 2;
+    const size_t size_in_bytes = get_size_in_bytes(num_initial_points, window_bits);
+    multiples = static_cast<AffineElement*>(aligned_alloc(64, std::max(size_in_bytes, 64UL)));
+    parallel_for((num_points + BLOCK_SIZE - 1) / BLOCK_SIZE, [&](size_t block) {
+        const size_t start = block * BLOCK_SIZE;
+        const size_t end = std::min(start + BLOCK_SIZE, num_points);
+        std::vector<Element> block_multiples((end - start) * num_windows);
+        for (size_t i = start; i < end; ++i) {
+            Element multiple(point_table[i]);
+            for (size_t j = 0; j < num_windows; ++j) {
+                block_multiples[(i - start) * num_windows + j] = multiple;
+                for (size_t k = 0; k < window_bits; ++k) {
+                    multiple.self_dbl();
+                }
+            }
+        }
+        Element::batch_normalize(block_multiples.data(), block_multiples.size());
+        for (size_t i = 0; i < block_multiples.size(); ++i) {
+            AffineElement& target = multiples[start * num_windows + i];
+            if (block_multiples[i].is_point_at_infinity()) {
+                target.self_set_infinity();
+            } else {
+                target = AffineElement(block_multiples[i].x, block_multiples[i].y);
+            }
+        }
+    });
+
+    if (!cache_path.empty()) {
+        write_cache(point_table_hash, cache_path);
+    }
+}
+
+template <typename Curve> FixedBaseMsmTable<Curve>::~FixedBaseMsmTable()
+{
+#ifndef __wasm__
+    if (mapped_region != nullptr) {
+        munmap(mapped_region, mapped_size);
+        return;
+    }
+#endif
+    aligned_free(multiples);
+}
+
+/**
+ * @brief Hash the 2⋅n entries of the point table covered by the table, which identify the SRS prefix it is computed from
+ */
+template <typename Curve>
+typename FixedBaseMsmTable<Curve>::PointTableHash FixedBaseMsmTable<Curve>::hash_point_table(
+    const AffineElement* point_table) const
+{
+    const std::span<const uint8_t> bytes(reinterpret_cast<const uint8_t*>(point_table),
+                                         num_initial_points * 2 * sizeof(AffineElement));
+    return crypto::sha256(bytes);
+}
+
+/**
+ * @brief Memory-map a table previously written by `write_cache`, if it was computed from a point table with the given
+ * hash
+ */
+template <typename Curve>
+bool FixedBaseMsmTable<Curve>::load_cache(const PointTableHash& point_table_hash, const std::string& cache_path)
+{
+#ifndef __wasm__
+    if (num_initial_points == 0) {
+        return false;
+    }
+    const size_t expected_size = sizeof(FixedBaseCacheHeader) + get_size_in_bytes(num_initial_points, window_bits);
+    const int fd = open(cache_path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat file_stat {};
+    if (fstat(fd, &file_stat) != 0 || static_cast<size_t>(file_stat.st_size) != expected_size) {
+        close(fd);
+        return false;
+    }
+    void* region = mmap(nullptr, expected_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (region == MAP_FAILED) {
+        return false;
+    }
+
+    const auto* header = static_cast<const FixedBaseCacheHeader*>(region);
+    auto* table = reinterpret_cast<AffineElement*>(static_cast<uint8_t*>(region) + sizeof(FixedBaseCacheHeader));
+    const bool valid = header->magic == FixedBaseCacheHeader::MAGIC &&
+                       header->num_initial_points == num_initial_points && header->window_bits == window_bits &&
+                       header->point_size == sizeof(AffineElement) && header->point_table_hash == point_table_hash;
+    if (!valid) {
+        munmap(region, expected_size);
+        return false;
+    }
+    mapped_region = region;
+    mapped_size = expected_size;
+    multiples = table;
+    return true;
+#else
+    static_cast<void>(point_table_hash);
+    static_cast<void>(cache_path);
+    return false;
+#endif
+}
+
+/**
+ * @brief Write the table to a temporary file and move it into place, so that concurrent readers never see a partial
+ * cache
+ * @details The temporary file is created with a unique name, so that concurrent writers (in this process or others)
+ * never write to the same file.
+ */
+template <typename Curve>
+void FixedBaseMsmTable<Curve>::write_cache(const PointTableHash& point_table_hash, const std::string& cache_path) const
+{
+#ifndef __wasm__
+    const FixedBaseCacheHeader header{
+        FixedBaseCacheHeader::MAGIC, num_initial_points, window_bits, sizeof(AffineElement), point_table_hash
+    };
+    std::string temp_path = cache_path + ".tmp.XXXXXX";
+    const int fd = mkstemp(temp_path.data());
+    if (fd < 0) {
+        info("FixedBaseMsmTable: could not write cache file ", cache_path);
+        return;
+    }
+    close(fd);
+    std::ofstream file(temp_path, std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(multiples),
+               static_cast<std::streamsize>(get_size_in_bytes(num_initial_points, window_bits)));
+    file.close();
+    if (!file || std::rename(temp_path.c_str(), cache_path.c_str()) != 0) {
+        info("FixedBaseMsmTable: could not write cache file ", cache_path);
+        std::remove(temp_path.c_str());
+    }
+#else
+    static_cast<void>(point_table_hash);
+    static_cast<void>(cache_path);
+#endif
+}
+
+/**
+ * @brief Compute ∑ᵢ sᵢ⋅Pᵢ over the bases P_{start_index}, ..., P_{start_index + n - 1} of a fixed-base table
+ *
+ * @param scalars the n scalars sᵢ
+ * @param table the precomputed multiples of the bases
+ * @param start_index the index of the first base
+ * @param num_initial_points n
+ */
+template <typename Curve>
+typename Curve::Element fixed_base_pippenger(const typename Curve::ScalarField* scalars,
+                                             const FixedBaseMsmTable<Curve>& table,
+                                             const size_t start_index,
+                                             const size_t num_initial_points)
+{
+    BB_OP_COUNT_TIME();
+    using Element = typename Curve::Element;
+    using Bucket = XYZZBucket<Curve>;
+
+    ASSERT(start_index + num_initial_points <= table.get_num_initial_points());
+    Element result;
+    result.self_set_infinity();
+    if (num_initial_points == 0) {
+        return result;
+    }
+
+    const size_t c = table.get_window_bits();
+    const size_t num_windows = FixedBaseMsmTable<Curve>::get_num_windows(c);
+    const size_t num_buckets = 1UL << (c - 1);
+    const uint64_t mask = (1ULL << c) - 1;
+    const uint64_t half = 1ULL << (c - 1);
+    const std::vector<RecodedScalar> recoded =
+        signed_digits::recode_scalars<Curve>(scalars, num_initial_points, c);
+
+    // Only use as many threads as keep the bucket reductions cheap relative to the additions
+    const size_t num_points = num_initial_points * 2;
+    const size_t num_chunks =
+        std::clamp((num_points * num_windows) / (4 * num_buckets), 1UL, std::min(get_num_cpus(), num_points));
+    const size_t chunk_size = (num_points + num_chunks - 1) / num_chunks;
+    std::vector<Element> chunk_results(num_chunks);
+    parallel_for(num_chunks, [&](size_t chunk) {
+        const size_t start = chunk * chunk_size;
+        const size_t end = std::min(start + chunk_size, num_points);
+        std::vector<Bucket> buckets(num_buckets);
+        for (size_t i = start; i < end; ++i) {
+            const auto* multiples = table.get_multiples(start_index * 2 + i);
+            for (size_t j = 0; j < num_windows; ++j) {
+                const uint64_t w = get_window(recoded[i], j * c, mask);
+                if (w == half) {
+                    continue;
+                }
+                const auto& point = multiples[j];
+                if (point.is_point_at_infinity()) {
+                    continue;
+                }
+                const bool negative = w < half;
+                const uint64_t bucket = (negative ? half - w : w - half) - 1;
+                buckets[bucket].add_affine(point.x, negative ? -point.y : point.y);
+            }
+        }
+
+        Bucket running;
+        Bucket sum;
+        for (size_t b = num_buckets; b-- > 0;) {
+            running.add(buckets[b]);
+            sum.add(running);
+        }
+        chunk_results[chunk] = sum.to_element();
+    });
+
+    for (const auto& chunk_result : chunk_results) {
+        result += chunk_result;
+    }
+    return result;
+}
+
+template class FixedBaseMsmTable<curve::BN254>;
+template class FixedBaseMsmTable<curve::Grumpkin>;
+
+template curve::BN254::Element fixed_base_pippenger<curve::BN254>(const curve::BN254::ScalarField* scalars,
+                                                                  const FixedBaseMsmTable<curve::BN254>& table,
+                                                                  const size_t start_index,
+                                                                  const size_t num_initial_points);
+template curve::Grumpkin::Element fixed_base_pippenger<curve::Grumpkin>(
+    const curve::Grumpkin::ScalarField* scalars,
+    const FixedBaseMsmTable<curve::Grumpkin>& table,
+    const size_t start_index,
+    const size_t num_initial_points);
+
+} // namespace bb::scalar_multiplication
+
+// NOLINTEND(readability-identifier-length)
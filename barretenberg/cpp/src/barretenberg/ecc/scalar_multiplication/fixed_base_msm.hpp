@@ -0,0 +1,72 @@
+#pragma once
+
+#include "barretenberg/ecc/curves/bn254/bn254.hpp"
+#include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace bb::scalar_multiplication {
+
+/**
+ * @brief Precomputed multiples of a fixed set of bases, for MSMs without a doubling chain
+ *
+ * @details For every entry Q_p of a pippenger point table (the bases and their endomorphisms), stores the W multiples
+ * 2^{jc}⋅Q_p, j = 0, ..., W - 1, where c is the window width and W the number of c-bit windows of a recoded
+ * endomorphism-split scalar. A signed digit d_{pj} in window j of the scalar multiplying Q_p then contributes
+ * d_{pj}⋅(2^{jc}⋅Q_p), so all windows share a single set of buckets and no doublings are required.
+ *
+ * The table takes 2⋅n⋅W affine points. If a cache path is given, the table is read from (memory-mapped) or written to
+ * that file, so that prover processes using the same SRS do not need to recompute it. The file records a SHA-256 hash
+ * of the point table it was computed from, and is only used for a point table with the same hash.
+ */
+template <typename Curve> class FixedBaseMsmTable {
+  public:
+    using AffineElement = typename Curve::AffineElement;
+
+    FixedBaseMsmTable(const AffineElement* point_table,
+                      size_t num_initial_points,
+                      size_t window_bits,
+                      const std::string& cache_path = "");
+    FixedBaseMsmTable(const FixedBaseMsmTable&) = delete;
+    FixedBaseMsmTable(FixedBaseMsmTable&&) = delete;
+    FixedBaseMsmTable& operator=(const FixedBaseMsmTable&) = delete;
+    FixedBaseMsmTable& operator=(FixedBaseMsmTable&&) = delete;
+    ~FixedBaseMsmTable();
+
+    static size_t get_num_windows(size_t window_bits);
+    static size_t get_size_in_bytes(size_t num_initial_points, size_t window_bits);
+    static size_t get_optimal_window_bits(size_t num_initial_points);
+
+    size_t get_num_initial_points() const { return num_initial_points; }
+    size_t get_window_bits() const { return window_bits; }
+    bool is_loaded_from_cache() const { return loaded_from_cache; }
+
+    // The multiples 2^{jc}⋅Q_p, j = 0, ..., W - 1, of the p-th entry of the point table
+    const AffineElement* get_multiples(size_t point_index) const { return multiples + point_index * num_windows; }
+
+  private:
+    using PointTableHash = std::array<uint8_t, 32>;
+
+    PointTableHash hash_point_table(const AffineElement* point_table) const;
+    bool load_cache(const PointTableHash& point_table_hash, const std::string& cache_path);
+    void write_cache(const PointTableHash& point_table_hash, const std::string& cache_path) const;
+
+    size_t num_initial_points;
+    size_t window_bits;
+    size_t num_windows;
+    bool loaded_from_cache = false;
+    AffineElement* multiples = nullptr;
+    // Set if `multiples` points into a memory-mapped cache file
+    void* mapped_region = nullptr;
+    size_t mapped_size = 0;
+};
+
+template <typename Curve>
+typename Curve::Element fixed_base_pippenger(const typename Curve::ScalarField* scalars,
+                                             const FixedBaseMsmTable<Curve>& table,
+                                             size_t start_index,
+                                             size_t num_initial_points);
+
+} // namespace bb::scalar_multiplication
@@ -202,10 +202,116 @@ template <typename Curve> pippenger_runtime_state<Curve>::~pippenger_runtime_sta
     }
 }
 
+template <typename Curve> PippengerRuntimeStatePool<Curve>& PippengerRuntimeStatePool<Curve>::get_instance()
+{
+    // Never destroyed, so that states released during static destruction still have a pool to return to
+    static auto* pool = new PippengerRuntimeStatePool<Curve>();
+    return *pool;
+}
+
+template <typename Curve> size_t PippengerRuntimeStatePool<Curve>::get_size_class(const size_t num_initial_points)
+{
+    if (num_initial_points <= 4) {
+        return num_initial_points;
+    }
+    const size_t step = (1ULL << numeric::get_msb(num_initial_points)) / 4;
+    return ((num_initial_points + step - 1) / step) * step;
+}
+
+/**
+ * @brief Get a runtime state for MSMs of up to num_initial_points points, reusing an idle one if possible
+ */
+template <typename Curve>
+std::shared_ptr<pippenger_runtime_state<Curve>> PippengerRuntimeStatePool<Curve>::acquire(
+    const size_t num_initial_points)
+{
+    auto& pool = get_instance();
+    const size_t size_class = get_size_class(num_initial_points);
+    const auto deleter = [size_class](State* state) { get_instance().release(size_class, state); };
+    {
+        std::lock_guard<std::mutex> lock(pool.mutex);
+        auto it = pool.idle_states.find(size_class);
+        if (it != pool.idle_states.end() && !it->second.empty()) {
+            State* state = it->second.back().release();
+            it->second.pop_back();
+            pool.stats.num_reuses++;
+            pool.stats.num_idle_states--;
+            return std::shared_ptr<State>(state, deleter);
+        }
+        pool.stats.num_allocations++;
+    }
+    // Construct (and pre-fault) the state outside of the lock
+    return std::shared_ptr<State>(new State(size_class), deleter);
+}
+
+template <typename Curve> void PippengerRuntimeStatePool<Curve>::release(const size_t size_class, State* state)
+{
+    std::unique_ptr<State> owned_state(state);
+    std::lock_guard<std::mutex> lock(mutex);
+    auto& idle = idle_states[size_class];
+    if (enabled && idle.size() < max_idle_states_per_size_class) {
+        idle.emplace_back(std::move(owned_state));
+        stats.num_idle_states++;
+    }
+}
+
+template <typename Curve> void PippengerRuntimeStatePool<Curve>::set_enabled(const bool enabled)
+{
+    auto& pool = get_instance();
+    {
+        std::lock_guard<std::mutex> lock(pool.mutex);
+        pool.enabled = enabled;
+    }
+    if (!enabled) {
+        clear();
+    }
+}
+
+/**
+ * @brief Set the number of idle states of each size class to keep, freeing any beyond it
+ */
+template <typename Curve>
+void PippengerRuntimeStatePool<Curve>::set_max_idle_states_per_size_class(const size_t max_idle_states)
+{
+    auto& pool = get_instance();
+    std::vector<std::unique_ptr<State>> evicted_states;
+    {
+        std::lock_guard<std::mutex> lock(pool.mutex);
+        pool.max_idle_states_per_size_class = max_idle_states;
+        for (auto& [size_class, idle] : pool.idle_states) {
+            while (idle.size() > max_idle_states) {
+                evicted_states.emplace_back(std::move(idle.back()));
+                idle.pop_back();
+                pool.stats.num_idle_states--;
+            }
+        }
+    }
+}
+
+template <typename Curve> void PippengerRuntimeStatePool<Curve>::clear()
+{
+    auto& pool = get_instance();
+    std::map<size_t, std::vector<std::unique_ptr<State>>> states;
+    {
+        std::lock_guard<std::mutex> lock(pool.mutex);
+        std::swap(states, pool.idle_states);
+        pool.stats.num_idle_states = 0;
+    }
+}
+
+template <typename Curve> typename PippengerRuntimeStatePool<Curve>::Stats PippengerRuntimeStatePool<Curve>::get_stats()
+{
+    auto& pool = get_instance();
+    std::lock_guard<std::mutex> lock(pool.mutex);
+    return pool.stats;
+}
+
 template struct affine_product_runtime_state<curve::BN254>;
 template struct affine_product_runtime_state<curve::Grumpkin>;
 template struct pippenger_runtime_state<curve::BN254>;
 template struct pippenger_runtime_state<curve::Grumpkin>;
+template class PippengerRuntimeStatePool<curve::BN254>;
+template class PippengerRuntimeStatePool<curve::Grumpkin>;
 } // namespace bb::scalar_multiplication
 
 // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
@@ -3,6 +3,10 @@
 #include "barretenberg/ecc/curves/bn254/bn254.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
 #include "barretenberg/ecc/groups/wnaf.hpp"
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
 
 namespace bb::scalar_multiplication {
 // simple helper functions to retrieve pointers to pre-allocated memory for the scalar multiplication algorithm.
@@ -114,4 +118,50 @@ template <typename Curve> struct pippenger_runtime_state {
     affine_product_runtime_state<Curve> get_affine_product_runtime_state(size_t num_threads, size_t thread_index);
 };
 
+/**
+ * @brief A process-wide pool of pippenger runtime states
+ *
+ * @details A runtime state for n points holds several arrays of O(n * num_rounds) bytes, which its constructor
+ * allocates and writes to so that the MSM itself does not page fault. Provers create a commitment key, and hence a
+ * runtime state, per instance (Oink, decider, ECCVM, translator...), paying for this every time. Instead, states are
+ * acquired from this pool, and returned to it when the last reference is dropped, to be handed out again to a later
+ * request of the same size class.
+ *
+ * Size classes are spaced four per octave, so that a state is at most 25% larger than requested. Acquired states are
+ * exclusively owned by the caller, so concurrent provers never share a state. At most max_idle_states_per_size_class
+ * states of each size class are kept idle, and any further released states are freed, so that a burst of concurrent
+ * MSMs (e.g. with commitment keys forked for overlapping tasks) does not pin its peak memory for the rest of the run.
+ */
+template <typename Curve> class PippengerRuntimeStatePool {
+  public:
+    using State = pippenger_runtime_state<Curve>;
+
+    struct Stats {
+        size_t num_allocations = 0;
+        size_t num_reuses = 0;
+        size_t num_idle_states = 0;
+    };
+
+    static constexpr size_t DEFAULT_MAX_IDLE_STATES_PER_SIZE_CLASS = 2;
+
+    static std::shared_ptr<State> acquire(size_t num_initial_points);
+    static size_t get_size_class(size_t num_initial_points);
+    // When disabled, acquired states are freed on release rather than pooled
+    static void set_enabled(bool enabled);
+    static void set_max_idle_states_per_size_class(size_t max_idle_states);
+    // Free all idle states
+    static void clear();
+    static Stats get_stats();
+
+  private:
+    static PippengerRuntimeStatePool& get_instance();
+    void release(size_t size_class, State* state);
+
+    std::mutex mutex;
+    bool enabled = true;
+    size_t max_idle_states_per_size_class = DEFAULT_MAX_IDLE_STATES_PER_SIZE_CLASS;
+    Stats stats;
+    std::map<size_t, std::vector<std::unique_ptr<State>>> idle_states;
+};
+
 } // namespace bb::scalar_multiplication
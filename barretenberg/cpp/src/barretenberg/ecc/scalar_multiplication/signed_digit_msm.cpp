@@ -0,0 +1,225 @@
+#include "./signed_digit_msm.hpp"
+#include "./signed_digits.hpp"
+
+#include "barretenberg/common/assert.hpp"
+#include "barretenberg/common/op_count.hpp"
+#include "barretenberg/common/thread.hpp"
+
+#include <array>
+#include <limits>
+#include <vector>
+
+/**
+ * Bucket-parallel Pippenger with signed digits.
+ *
+ * Each scalar is split with the endomorphism into two ~128-bit halves k1, k2, which are multiplied against the points
+ * P and -λP that the pippenger point table already stores at indices 2i and 2i + 1.
+ *
+ * Every half is then recoded into signed c-bit digits. Rather than propagating a carry from window to window, we add
+ * the constant H = Σⱼ 2^{c-1}⋅2^{jc} once: the j-th c-bit window of k + H, minus 2^{c-1}, is the j-th digit of a
+ * signed representation of k with digits in [-2^{c-1}, 2^{c-1}). Every window can therefore be read off independently,
+ * and a digit d only needs |d| buckets (we add -P for d < 0, which is free in affine coordinates), halving the bucket
+ * count of an unsigned window of the same width.
+ *
+ * Work is split across threads by bucket rather than by point: each (window, tile of buckets) pair is an independent
+ * task, which scans all the points and accumulates only those whose digit falls into its tile. The tile is sized so
+ * that its buckets stay resident in L2, which keeps the random bucket accesses cheap; the points themselves are
+ * streamed in order. No sorting or inter-thread synchronisation is required, and no point is ever added twice.
+ *
+ * Buckets are kept in XYZZ coordinates (x = X/ZZ, y = Y/ZZZ, ZZ³ = ZZZ²), whose mixed addition costs 8M + 2S. The
+ * formulae are complete up to the explicit doubling/inverse checks, so the algorithm is always safe to use with
+ * linearly dependent points.
+ **/
+
+// NOLINTBEGIN(readability-identifier-length)
+
+namespace bb::scalar_multiplication {
+
+using signed_digits::get_window;
+using signed_digits::MAX_WINDOW_BITS;
+using signed_digits::MIN_WINDOW_BITS;
+using signed_digits::RECODED_BITS;
+using signed_digits::RecodedScalar;
+using signed_digits::XYZZBucket;
+
+namespace {
+
+// Buckets per tile are capped so that one tile of XYZZ buckets (128 bytes each) fits in a 1MB L2 cache
+constexpr size_t MAX_BUCKETS_PER_TILE = 1UL << 13;
+
+// Computes k⋅P for a small k, used to weight the bucket sum of a tile by its starting bucket index
+template <typename Curve> typename Curve::Element mul_small(const typename Curve::Element& point, uint64_t k)
+{
+    typename Curve::Element result;
+    result.self_set_infinity();
+    for (size_t i = 64; i-- > 0;) {
+        result.self_dbl();
+        if (((k >> i) & 1) != 0) {
+            result += point;
+        }
+    }
+    return result;
+}
+
+} // namespace
+
+/**
+ * @brief Choose the window width and tiling that minimise the modelled runtime of `signed_digit_pippenger`
+ *
+ * @details The cost of a task (one window, one tile) is: scanning every point for its digit, one mixed addition per
+ * point whose digit lands in the tile, and two full additions per bucket for the running-sum reduction. Tasks are
+ * spread over `num_threads`; the final combination of windows costs a handful of doublings. Costs are in units of
+ * field multiplications.
+ */
+SignedDigitMsmConfig get_signed_digit_msm_config(const size_t num_points, const size_t num_threads)
+{
+    constexpr double MIXED_ADD_COST = 10.0;
+    constexpr double ADD_COST = 14.0;
+    constexpr double DBL_COST = 10.0;
+    constexpr double SCAN_COST = 0.5;
+
+    const auto n = static_cast<double>(num_points);
+    const size_t threads = std::max(num_threads, 1UL);
+    SignedDigitMsmConfig best{ MIN_WINDOW_BITS, 1 };
+    double best_cost = std::numeric_limits<double>::max();
+    for (size_t c = MIN_WINDOW_BITS; c <= MAX_WINDOW_BITS; ++c) {
+        const size_t num_buckets = 1UL << (c - 1);
+        const size_t num_windows = (RECODED_BITS + c - 1) / c;
+        for (size_t tile = std::min(num_buckets, MAX_BUCKETS_PER_TILE); tile > 0; tile >>= 1) {
+            const size_t num_tiles = num_buckets / tile;
+            const size_t num_tasks = num_windows * num_tiles;
+            const double task_cost = n * SCAN_COST + (n / static_cast<double>(num_tiles)) * MIXED_ADD_COST +
+                                     static_cast<double>(2 * tile) * ADD_COST +
+                                     static_cast<double>(2 * c) * (DBL_COST + ADD_COST);
+            const auto rounds = static_cast<double>((num_tasks + threads - 1) / threads);
+            const double cost = rounds * task_cost + static_cast<double>(num_windows * c) * DBL_COST;
+            if (cost < best_cost) {
+                best_cost = cost;
+                best = { c, tile };
+            }
+            // more tiles than threads only adds scanning cost
+            if (num_tasks >= threads) {
+                break;
+            }
+        }
+    }
+    return best;
+}
+
+/**
+ * @brief Compute ∑ᵢ sᵢ⋅Pᵢ with a bucket-parallel, signed-digit Pippenger
+ *
+ * @param scalars the n scalars sᵢ
+ * @param points the pippenger point table of 2n points { Pᵢ, endo(Pᵢ) }, see `generate_pippenger_point_table`
+ * @param num_initial_points n
+ * @param config window width and tiling, see `get_signed_digit_msm_config`
+ */
+template <typename Curve>
+typename Curve::Element signed_digit_pippenger(typename Curve::ScalarField* scalars,
+                                               typename Curve::AffineElement* points,
+                                               const size_t num_initial_points,
+                                               const SignedDigitMsmConfig& config)
+{
+    BB_OP_COUNT_TIME();
+    using Element = typename Curve::Element;
+    using Bucket = XYZZBucket<Curve>;
+
+    const size_t c = config.window_bits;
+    ASSERT(c >= MIN_WINDOW_BITS && c <= MAX_WINDOW_BITS);
+    ASSERT(config.buckets_per_tile > 0 && config.num_buckets() % config.buckets_per_tile == 0);
+
+    Element result;
+    result.self_set_infinity();
+    if (num_initial_points == 0) {
+        return result;
+    }
+
+    const size_t num_points = num_initial_points * 2;
+    const std::vector<RecodedScalar> recoded = signed_digits::recode_scalars<Curve>(scalars, num_initial_points, c);
+
+    const size_t num_windows = config.num_windows();
+    const size_t num_tiles = config.num_tiles();
+    const size_t tile_size = config.buckets_per_tile;
+    const uint64_t mask = (1ULL << c) - 1;
+    const uint64_t half = 1ULL << (c - 1);
+
+    // Each task computes ∑_{b in tile} (b + 1)⋅B_b for its window; the windows are combined below
+    std::vector<Element> task_results(num_windows * num_tiles);
+    parallel_for(num_windows * num_tiles, [&](size_t task) {
+        const size_t window = task / num_tiles;
+        const size_t tile = task % num_tiles;
+        const uint64_t tile_start = tile * tile_size;
+        const size_t bit_offset = window * c;
+
+        std::vector<Bucket> buckets(tile_size);
+        for (size_t i = 0; i < num_points; ++i) {
+            // The window holds d + 2^{c-1} for a digit d in [-2^{c-1}, 2^{c-1}). Digit d goes in bucket |d| - 1
+            const uint64_t w = get_window(recoded[i], bit_offset, mask);
+            if (w == half) {
+                continue;
+            }
+            const bool negative = w < half;
+            const uint64_t bucket = (negative ? half - w : w - half) - 1 - tile_start;
+            if (bucket >= tile_size) {
+                continue;
+            }
+            const auto& point = points[i];
+            if (point.is_point_at_infinity()) {
+                continue;
+            }
+            buckets[bucket].add_affine(point.x, negative ? -point.y : point.y);
+        }
+
+        // running = ∑_{b' >= b} B_b', sum = ∑ (b - tile_start + 1)⋅B_b
+        Bucket running;
+        Bucket sum;
+        for (size_t b = tile_size; b-- > 0;) {
+            running.add(buckets[b]);
+            sum.add(running);
+        }
+        Element tile_result = sum.to_element();
+        if (tile_start != 0) {
+            tile_result += mul_small<Curve>(running.to_element(), tile_start);
+        }
+        task_results[task] = tile_result;
+    });
+
+    for (size_t window = num_windows; window-- > 0;) {
+        for (size_t i = 0; i < c; ++i) {
+            result.self_dbl();
+        }
+        for (size_t tile = 0; tile < num_tiles; ++tile) {
+            result += task_results[window * num_tiles + tile];
+        }
+    }
+    return result;
+}
+
+template <typename Curve>
+typename Curve::Element signed_digit_pippenger(typename Curve::ScalarField* scalars,
+                                               typename Curve::AffineElement* points,
+                                               const size_t num_initial_points)
+{
+    return signed_digit_pippenger<Curve>(
+        scalars, points, num_initial_points, get_signed_digit_msm_config(num_initial_points * 2, get_num_cpus()));
+}
+
+template curve::BN254::Element signed_digit_pippenger<curve::BN254>(curve::BN254::ScalarField* scalars,
+                                                                    curve::BN254::AffineElement* points,
+                                                                    const size_t num_initial_points,
+                                                                    const SignedDigitMsmConfig& config);
+template curve::BN254::Element signed_digit_pippenger<curve::BN254>(curve::BN254::ScalarField* scalars,
+                                                                    curve::BN254::AffineElement* points,
+                                                                    const size_t num_initial_points);
+
+template curve::Grumpkin::Element signed_digit_pippenger<curve::Grumpkin>(curve::Grumpkin::ScalarField* scalars,
+                                                                          curve::Grumpkin::AffineElement* points,
+                                                                          const size_t num_initial_points,
+                                                                          const SignedDigitMsmConfig& config);
+template curve::Grumpkin::Element signed_digit_pippenger<curve::Grumpkin>(curve::Grumpkin::ScalarField* scalars,
+                                                                          curve::Grumpkin::AffineElement* points,
+                                                                          const size_t num_initial_points);
+
+} // namespace bb::scalar_multiplication
+
+// NOLINTEND(readability-identifier-length)
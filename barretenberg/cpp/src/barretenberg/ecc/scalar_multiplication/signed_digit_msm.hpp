@@ -0,0 +1,47 @@
+#pragma once
+
+#include "barretenberg/ecc/curves/bn254/bn254.hpp"
+#include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include <cstddef>
+#include <cstdint>
+
+namespace bb::scalar_multiplication {
+
+/**
+ * @brief The multi-scalar multiplication algorithms that can be used to compute a commitment
+ *
+ * @details WNAF_PIPPENGER is the sorted-schedule, affine-addition Pippenger in scalar_multiplication.cpp.
+ * SIGNED_DIGIT is the bucket-parallel variant in signed_digit_msm.cpp.
+ */
+enum class MsmEngine { WNAF_PIPPENGER, SIGNED_DIGIT };
+
+/**
+ * @brief Window width and bucket tiling used by the signed-digit MSM
+ *
+ * @details A window of `window_bits` bits yields signed digits in [-2^{c-1}, 2^{c-1}), so each window needs 2^{c-1}
+ * buckets. These are split into tiles of `buckets_per_tile` buckets; every (window, tile) pair is an independent task.
+ */
+struct SignedDigitMsmConfig {
+    size_t window_bits;
+    size_t buckets_per_tile;
+
+    size_t num_buckets() const { return 1UL << (window_bits - 1); }
+    size_t num_tiles() const { return num_buckets() / buckets_per_tile; }
+    // the scalars are recoded to fit 130 bits, see `signed_digit_pippenger`
+    size_t num_windows() const { return (130 + window_bits - 1) / window_bits; }
+};
+
+SignedDigitMsmConfig get_signed_digit_msm_config(size_t num_points, size_t num_threads);
+
+template <typename Curve>
+typename Curve::Element signed_digit_pippenger(typename Curve::ScalarField* scalars,
+                                               typename Curve::AffineElement* points,
+                                               size_t num_initial_points,
+                                               const SignedDigitMsmConfig& config);
+
+template <typename Curve>
+typename Curve::Element signed_digit_pippenger(typename Curve::ScalarField* scalars,
+                                               typename Curve::AffineElement* points,
+                                               size_t num_initial_points);
+
+} // namespace bb::scalar_multiplication
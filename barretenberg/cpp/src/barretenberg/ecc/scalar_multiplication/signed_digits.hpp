@@ -0,0 +1,212 @@
+#pragma once
+
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/ecc/curves/bn254/bn254.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * Helpers shared by the signed-digit MSM engines (signed_digit_msm.cpp, fixed_base_msm.cpp): recoding of the
+ * endomorphism-split scalars into independent signed windows, and XYZZ bucket accumulators.
+ **/
+
+// NOLINTBEGIN(readability-identifier-length)
+
+namespace bb::scalar_multiplication::signed_digits {
+
+constexpr size_t MIN_WINDOW_BITS = 2;
+constexpr size_t MAX_WINDOW_BITS = 20;
+// Wc >= 130 guarantees that k + H cannot overflow the windows for any k < 2^128. 3 limbs hold up to 192 bits.
+constexpr size_t RECODED_BITS = 130;
+constexpr size_t NUM_RECODED_LIMBS = 3;
+
+using RecodedScalar = std::array<uint64_t, NUM_RECODED_LIMBS>;
+
+template <typename Curve> struct XYZZBucket {
+    using Fq = typename Curve::BaseField;
+    Fq x = Fq::zero();
+    Fq y = Fq::zero();
+    Fq zz = Fq::zero();
+    Fq zzz = Fq::zero();
+
+    bool is_empty() const { return zz.is_zero(); }
+
+    void set_empty()
+    {
+        zz = Fq::zero();
+        zzz = Fq::zero();
+    }
+
+    // mdbl-2008-s-1
+    void set_double_of(const Fq& x2, const Fq& y2)
+    {
+        Fq u = y2 + y2;
+        Fq v = u.sqr();
+        Fq w = u * v;
+        Fq s = x2 * v;
+        Fq xx = x2.sqr();
+        Fq m = xx + xx + xx;
+        if constexpr (Curve::Group::has_a) {
+            m += Curve::Group::curve_a;
+        }
+        x = m.sqr() - (s + s);
+        y = m * (s - x) - w * y2;
+        zz = v;
+        zzz = w;
+    }
+
+    // dbl-2008-s-1
+    void self_dbl()
+    {
+        Fq u = y + y;
+        Fq v = u.sqr();
+        Fq w = u * v;
+        Fq s = x * v;
+        Fq xx = x.sqr();
+        Fq m = xx + xx + xx;
+        if constexpr (Curve::Group::has_a) {
+            m += Curve::Group::curve_a * zz.sqr();
+        }
+        x = m.sqr() - (s + s);
+        y = m * (s - x) - w * y;
+        zz *= v;
+        zzz *= w;
+    }
+
+    // madd-2008-s
+    void add_affine(const Fq& x2, const Fq& y2)
+    {
+        if (is_empty()) {
+            x = x2;
+            y = y2;
+            zz = Fq::one();
+            zzz = Fq::one();
+            return;
+        }
+        Fq p = x2 * zz - x;
+        Fq r = y2 * zzz - y;
+        if (p.is_zero()) {
+            if (r.is_zero()) {
+                set_double_of(x2, y2);
+            } else {
+                set_empty();
+            }
+            return;
+        }
+        Fq pp = p.sqr();
+        Fq ppp = p * pp;
+        Fq q = x * pp;
+        x = r.sqr() - ppp - (q + q);
+        y = r * (q - x) - y * ppp;
+        zz *= pp;
+        zzz *= ppp;
+    }
+
+    // add-2008-s
+    void add(const XYZZBucket& other)
+    {
+        if (other.is_empty()) {
+            return;
+        }
+        if (is_empty()) {
+            *this = other;
+            return;
+        }
+        Fq u1 = x * other.zz;
+        Fq s1 = y * other.zzz;
+        Fq p = other.x * zz - u1;
+        Fq r = other.y * zzz - s1;
+        if (p.is_zero()) {
+            if (r.is_zero()) {
+                self_dbl();
+            } else {
+                set_empty();
+            }
+            return;
+        }
+        Fq pp = p.sqr();
+        Fq ppp = p * pp;
+        Fq q = u1 * pp;
+        x = r.sqr() - ppp - (q + q);
+        y = r * (q - x) - s1 * ppp;
+        zz *= other.zz * pp;
+        zzz *= other.zzz * ppp;
+    }
+
+    // Jacobian (X⋅ZZ², Y⋅ZZZ², ZZZ) represents the same point, without requiring an inversion
+    typename Curve::Element to_element() const
+    {
+        typename Curve::Element result;
+        if (is_empty()) {
+            result.self_set_infinity();
+            return result;
+        }
+        result.x = x * zz.sqr();
+        result.y = y * zzz.sqr();
+        result.z = zzz;
+        return result;
+    }
+};
+
+inline RecodedScalar get_window_offset(const size_t window_bits)
+{
+    RecodedScalar offset{ 0, 0, 0 };
+    const size_t num_windows = (RECODED_BITS + window_bits - 1) / window_bits;
+    for (size_t j = 0; j < num_windows; ++j) {
+        const size_t bit = j * window_bits + window_bits - 1;
+        offset[bit >> 6] |= 1ULL << (bit & 63);
+    }
+    return offset;
+}
+
+inline RecodedScalar recode(const uint64_t lo, const uint64_t hi, const RecodedScalar& offset)
+{
+    RecodedScalar result;
+    const uint128_t sum_lo = static_cast<uint128_t>(lo) + offset[0];
+    const uint128_t sum_hi = static_cast<uint128_t>(hi) + offset[1] + static_cast<uint64_t>(sum_lo >> 64);
+    result[0] = static_cast<uint64_t>(sum_lo);
+    result[1] = static_cast<uint64_t>(sum_hi);
+    result[2] = offset[2] + static_cast<uint64_t>(sum_hi >> 64);
+    return result;
+}
+
+inline uint64_t get_window(const RecodedScalar& scalar, const size_t bit_offset, const uint64_t mask)
+{
+    const size_t limb = bit_offset >> 6;
+    const size_t shift = bit_offset & 63;
+    uint64_t window = scalar[limb] >> shift;
+    if (shift != 0 && limb + 1 < NUM_RECODED_LIMBS) {
+        window |= scalar[limb + 1] << (64 - shift);
+    }
+    return window & mask;
+}
+
+/**
+ * @brief Split each scalar with the endomorphism and recode both halves for windows of width `window_bits`
+ *
+ * @details Entry 2i (resp. 2i + 1) multiplies entry 2i (resp. 2i + 1) of the pippenger point table
+ */
+template <typename Curve>
+std::vector<RecodedScalar> recode_scalars(const typename Curve::ScalarField* scalars,
+                                          const size_t num_initial_points,
+                                          const size_t window_bits)
+{
+    using Fr = typename Curve::ScalarField;
+    const RecodedScalar offset = get_window_offset(window_bits);
+    std::vector<RecodedScalar> recoded(num_initial_points * 2);
+    run_loop_in_parallel(num_initial_points, [&](size_t start, size_t end) {
+        for (size_t i = start; i < end; ++i) {
+            Fr k = scalars[i].from_montgomery_form();
+            Fr::split_into_endomorphism_scalars(k, k, *(Fr*)&k.data[2]);
+            recoded[2 * i] = recode(k.data[0], k.data[1], offset);
+            recoded[2 * i + 1] = recode(k.data[2], k.data[3], offset);
+        }
+    });
+    return recoded;
+}
+
+} // namespace bb::scalar_multiplication::signed_digits
+
+// NOLINTEND(readability-identifier-length)
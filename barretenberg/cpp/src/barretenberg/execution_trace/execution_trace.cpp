@@ -6,10 +6,12 @@
 namespace bb {
 
 template <class Flavor>
-void ExecutionTrace_<Flavor>::populate(Builder& builder, typename Flavor::ProvingKey& proving_key, bool is_structured)
+void ExecutionTrace_<Flavor>::populate(Builder& builder,
+                                       typename Flavor::ProvingKey& proving_key,
+                                       const TraceStructure& trace_structure)
 {
     // Construct wire polynomials, selector polynomials, and copy cycles from raw circuit data
-    auto trace_data = construct_trace_data(builder, proving_key.circuit_size, is_structured);
+    auto trace_data = construct_trace_data(builder, proving_key.circuit_size, trace_structure);
 
     add_wires_and_selectors_to_proving_key(trace_data, builder, proving_key);
 
@@ -40,6 +42,7 @@ void ExecutionTrace_<Flavor>::add_wires_and_selectors_to_proving_key(TraceData&
             pkey_selector = trace_selector.share();
         }
         proving_key.pub_inputs_offset = trace_data.pub_inputs_offset;
+        proving_key.active_block_ranges = std::move(trace_data.active_block_ranges);
     } else if constexpr (IsPlonkFlavor<Flavor>) {
         for (size_t idx = 0; idx < trace_data.wires.size(); ++idx) {
             std::string wire_tag = "w_" + std::to_string(idx + 1) + "_lagrange";
@@ -69,34 +72,60 @@ void ExecutionTrace_<Flavor>::add_memory_records_to_proving_key(TraceData& trace
     }
 }
 
+template <class Flavor> std::vector<size_t> ExecutionTrace_<Flavor>::get_block_sizes(Builder& builder)
+{
+    std::vector<size_t> block_sizes;
+    for (auto& block : builder.blocks.get()) {
+        block_sizes.emplace_back(block.is_pub_inputs ? builder.public_inputs.size() : block.size());
+    }
+    return block_sizes;
+}
+
 template <class Flavor>
-typename ExecutionTrace_<Flavor>::TraceData ExecutionTrace_<Flavor>::construct_trace_data(Builder& builder,
-                                                                                          size_t dyadic_circuit_size,
-                                                                                          bool is_structured)
+typename ExecutionTrace_<Flavor>::TraceData ExecutionTrace_<Flavor>::construct_trace_data(
+    Builder& builder, size_t dyadic_circuit_size, const TraceStructure& trace_structure)
 {
-    TraceData trace_data{ dyadic_circuit_size, builder };
+    TraceData trace_data{ dyadic_circuit_size };
+
+    // The copy cycles are built from the real variable of every wire; flatten the variable equivalence classes first so
+    // that each of these lookups is a single indirection
+    builder.compress_variable_classes();
 
     // Complete the public inputs execution trace block from builder.public_inputs
     populate_public_inputs_block(builder);
 
+    // One copy cycle node per wire of every gate; these are grouped into cycles once the trace is complete
+    size_t num_gates = 0;
+    for (auto& block : builder.blocks.get()) {
+        num_gates += block.size();
+    }
+    std::vector<uint64_t> copy_cycle_nodes(num_gates * NUM_WIRES);
+
     uint32_t offset = Flavor::has_zero_row ? 1 : 0; // Offset at which to place each block in the trace polynomials
+    size_t node_offset = 0;                         // Offset of the copy cycle nodes of each block
     // For each block in the trace, populate wire polys, copy cycles and selector polys
+    size_t block_idx = 0;
     for (auto& block : builder.blocks.get()) {
         auto block_size = static_cast<uint32_t>(block.size());
-
-        // Update wire polynomials and copy cycles
-        // NB: The order of row/column loops is arbitrary but needs to be row/column to match old copy_cycle code
-        for (uint32_t block_row_idx = 0; block_row_idx < block_size; ++block_row_idx) {
-            for (uint32_t wire_idx = 0; wire_idx < NUM_WIRES; ++wire_idx) {
-                uint32_t var_idx = block.wires[wire_idx][block_row_idx]; // an index into the variables array
-                uint32_t real_var_idx = builder.real_variable_index[var_idx];
-                uint32_t trace_row_idx = block_row_idx + offset;
-                // Insert the real witness values from this block into the wire polys at the correct offset
-                trace_data.wires[wire_idx][trace_row_idx] = builder.get_variable(var_idx);
-                // Add the address of the witness value to its corresponding copy cycle
-                trace_data.copy_cycles[real_var_idx].emplace_back(cycle_node{ wire_idx, trace_row_idx });
+        ASSERT(!trace_structure.is_structured() || block_size <= trace_structure.block_capacities[block_idx]);
+        trace_data.active_block_ranges.emplace_back(offset, offset + block_size);
+
+        // Update wire polynomials and copy cycle nodes. Each row is independent, so this is done in parallel.
+        run_loop_in_parallel(block_size, [&](size_t start, size_t end) {
+            for (auto block_row_idx = static_cast<uint32_t>(start); block_row_idx < end; ++block_row_idx) {
+                for (uint32_t wire_idx = 0; wire_idx < NUM_WIRES; ++wire_idx) {
+                    uint32_t var_idx = block.wires[wire_idx][block_row_idx]; // an index into the variables array
+                    uint32_t real_var_idx = builder.get_real_variable_index(var_idx);
+                    uint32_t trace_row_idx = block_row_idx + offset;
+                    // Insert the real witness values from this block into the wire polys at the correct offset
+                    trace_data.wires[wire_idx][trace_row_idx] = builder.get_variable(var_idx);
+                    // Record the address of the witness value, to be added to its corresponding copy cycle
+                    copy_cycle_nodes[node_offset + block_row_idx * NUM_WIRES + wire_idx] =
+                        CopyCycles::make_node(real_var_idx, trace_row_idx, wire_idx);
+                }
             }
-        }
+        });
+        node_offset += block_size * NUM_WIRES;
 
         // Insert the selector values for this block into the selector polynomials at the correct offset
         // TODO(https://github.com/AztecProtocol/barretenberg/issues/398): implicit arithmetization/flavor consistency
@@ -116,13 +145,17 @@ typename ExecutionTrace_<Flavor>::TraceData ExecutionTrace_<Flavor>::construct_t
             trace_data.pub_inputs_offset = offset;
         }
 
-        // If the trace is structured, we populate the data from the next block at a fixed block size offset
-        if (is_structured) {
-            offset += builder.FIXED_BLOCK_SIZE;
+        // If the trace is structured, we populate the data from the next block at the offset given by the capacity of
+        // this one
+        if (trace_structure.is_structured()) {
+            offset += static_cast<uint32_t>(trace_structure.block_capacities[block_idx]);
         } else { // otherwise, the next block starts immediately following the previous one
             offset += block_size;
         }
+        ++block_idx;
     }
+
+    trace_data.copy_cycles = CopyCycles(std::move(copy_cycle_nodes), builder.variables.size());
     return trace_data;
 }
 
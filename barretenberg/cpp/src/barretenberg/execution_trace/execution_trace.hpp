@@ -1,5 +1,6 @@
 #pragma once
 #include "barretenberg/flavor/flavor.hpp"
+#include "barretenberg/plonk_honk_shared/arithmetization/arithmetization.hpp"
 #include "barretenberg/plonk_honk_shared/composer/permutation_lib.hpp"
 #include "barretenberg/srs/global_crs.hpp"
 
@@ -19,12 +20,14 @@ template <class Flavor> class ExecutionTrace_ {
     struct TraceData {
         std::array<Polynomial, NUM_WIRES> wires;
         std::array<Polynomial, Builder::Arithmetization::NUM_SELECTORS> selectors;
-        // A vector of sets (vectors) of addresses into the wire polynomials whose values are copy constrained
-        std::vector<CyclicPermutation> copy_cycles;
+        // The sets of addresses into the wire polynomials whose values are copy constrained
+        CopyCycles copy_cycles;
         uint32_t ram_rom_offset = 0;    // offset of the RAM/ROM block in the execution trace
         uint32_t pub_inputs_offset = 0; // offset of the public inputs block in the execution trace
+        // The [start, end) range of rows occupied by each block of the trace
+        std::vector<std::pair<size_t, size_t>> active_block_ranges;
 
-        TraceData(size_t dyadic_circuit_size, Builder& builder)
+        TraceData(size_t dyadic_circuit_size)
         {
             // Initializate the wire and selector polynomials
             for (auto& wire : wires) {
@@ -33,7 +36,6 @@ template <class Flavor> class ExecutionTrace_ {
             for (auto& selector : selectors) {
                 selector = Polynomial(dyadic_circuit_size);
             }
-            copy_cycles.resize(builder.variables.size());
         }
     };
 
@@ -46,9 +48,18 @@ template <class Flavor> class ExecutionTrace_ {
      * consistent across all instances.
      *
      * @param builder
-     * @param is_structured whether or not the trace is to be structured with a fixed block size
+     * @param trace_structure the number of rows reserved for each block if the trace is to be structured
      */
-    static void populate(Builder& builder, ProvingKey&, bool is_structured = false);
+    static void populate(Builder& builder, ProvingKey&, const TraceStructure& trace_structure = {});
+
+    /**
+     * @brief The number of rows each block of the builder will occupy in the execution trace
+     * @details The public inputs block is only populated when the trace is constructed, so its size is taken to be the
+     * number of public inputs.
+     *
+     * @param builder
+     */
+    static std::vector<size_t> get_block_sizes(Builder& builder);
 
   private:
     /**
@@ -84,10 +95,12 @@ template <class Flavor> class ExecutionTrace_ {
      *
      * @param builder
      * @param dyadic_circuit_size
-     * @param is_structured whether or not the trace is to be structured with a fixed block size
+     * @param trace_structure the number of rows reserved for each block if the trace is to be structured
      * @return TraceData
      */
-    static TraceData construct_trace_data(Builder& builder, size_t dyadic_circuit_size, bool is_structured = false);
+    static TraceData construct_trace_data(Builder& builder,
+                                          size_t dyadic_circuit_size,
+                                          const TraceStructure& trace_structure = {});
 
     /**
      * @brief Populate the public inputs block
@@ -111,6 +111,10 @@ template <typename FF, typename CommitmentKey_> class ProvingKey_ {
     // Offset off the public inputs from the start of the execution trace
     size_t pub_inputs_offset = 0;
 
+    // The [start, end) range of rows of the execution trace occupied by each block of gates. Outside of these ranges the
+    // wires (and selectors) vanish, which is significant for a structured trace.
+    std::vector<std::pair<size_t, size_t>> active_block_ranges;
+
     // The number of public inputs has to be the same for all instances because they are
     // folded element by element.
     std::vector<FF> public_inputs;
@@ -288,6 +292,38 @@ template <typename Tuple, std::size_t Index = 0> static constexpr auto create_su
     }
 }
 
+/**
+ * @brief Recursive utility function to construct a container for the subrelation accumulators of batched sumcheck
+ * edge evaluation.
+ * @details Same layout as create_sumcheck_tuple_of_tuples_of_univariates, but each univariate holds the evaluations of
+ * BATCH_SIZE edges (see compute_batched_subrelation_partial_lengths).
+ */
+template <typename Tuple, size_t BATCH_SIZE, std::size_t Index = 0>
+static constexpr auto create_batched_sumcheck_tuple_of_tuples_of_univariates()
+{
+    if constexpr (Index >= std::tuple_size<Tuple>::value) {
+        return std::tuple<>{}; // Return empty when reach end of the tuple
+    } else {
+        using UnivariateTuple = typename std::tuple_element_t<Index, Tuple>::
+            template BatchedSumcheckTupleOfUnivariatesOverSubrelations<BATCH_SIZE>;
+        return std::tuple_cat(std::tuple<UnivariateTuple>{},
+                              create_batched_sumcheck_tuple_of_tuples_of_univariates<Tuple, BATCH_SIZE, Index + 1>());
+    }
+}
+
+/**
+ * @brief The number of edges the sumcheck prover feeds to the relations at once.
+ * @details Flavors opt in by defining SUMCHECK_EDGE_BATCH_SIZE; otherwise relations are evaluated one edge at a time.
+ */
+template <typename Flavor> static constexpr size_t get_sumcheck_edge_batch_size()
+{
+    if constexpr (requires { Flavor::SUMCHECK_EDGE_BATCH_SIZE; }) {
+        return Flavor::SUMCHECK_EDGE_BATCH_SIZE;
+    } else {
+        return 1;
+    }
+}
+
 /**
  * @brief Recursive utility function to construct tuple of arrays
  * @details Container for storing value of each identity in each relation. Each Relation contributes an array of
@@ -1,6 +1,7 @@
 #include <filesystem>
 #include <fstream>
 #include <iostream>
+#include <numeric>
 
 #include "barretenberg/common/net.hpp"
 #include "barretenberg/crypto/sha256/sha256.hpp"
@@ -36,39 +37,49 @@ int main(int argc, char** argv)
 
     std::vector<bb::grumpkin::g1::affine_element> srs(subgroup_size);
 
-    std::vector<uint8_t> hash_input;
+    // Every point is derived independently, so we hash the current attempt of all points that are still missing
+    // together: the batch hash computes several hashes at once where the CPU supports it.
+    std::vector<size_t> pending_points(subgroup_size);
+    std::iota(pending_points.begin(), pending_points.end(), 0);
+    std::vector<size_t> attempts(subgroup_size, 0);
 
-    for (size_t point_idx = 0; point_idx < subgroup_size; ++point_idx) {
-        bool rational_point_found = false;
-        size_t attempt = 0;
-        while (!rational_point_found) {
-            hash_input.clear();
+    while (!pending_points.empty()) {
+        std::vector<std::vector<uint8_t>> hash_inputs(pending_points.size());
+        for (size_t i = 0; i < pending_points.size(); ++i) {
+            auto& hash_input = hash_inputs[i];
             // We hash |BARRETENBERG_GRUMPKIN_IPA_CRS|POINT_INDEX_IN_LITTLE_ENDIAN|POINT_ATTEMPT_INDEX_IN_LITTLE_ENDIAN|
             std::copy(protocol_name.begin(), protocol_name.end(), std::back_inserter(hash_input));
-            uint64_t point_index_le_order = htonll(static_cast<uint64_t>(point_idx));
-            uint64_t point_attempt_le_order = htonll(static_cast<uint64_t>(attempt));
+            uint64_t point_index_le_order = htonll(static_cast<uint64_t>(pending_points[i]));
+            uint64_t point_attempt_le_order = htonll(static_cast<uint64_t>(attempts[pending_points[i]]));
             hash_input.insert(hash_input.end(),
                               reinterpret_cast<uint8_t*>(&point_index_le_order),
                               reinterpret_cast<uint8_t*>(&point_index_le_order) + sizeof(uint64_t));
             hash_input.insert(hash_input.end(),
                               reinterpret_cast<uint8_t*>(&point_attempt_le_order),
                               reinterpret_cast<uint8_t*>(&point_attempt_le_order) + sizeof(uint64_t));
-            auto hash_result = crypto::sha256(hash_input);
-            uint256_t hash_result_uint(ntohll(*reinterpret_cast<uint64_t*>(hash_result.data())),
-                                       ntohll(*reinterpret_cast<uint64_t*>(hash_result.data() + sizeof(uint64_t))),
-                                       ntohll(*reinterpret_cast<uint64_t*>(hash_result.data() + 2 * sizeof(uint64_t))),
-                                       ntohll(*reinterpret_cast<uint64_t*>(hash_result.data() + 3 * sizeof(uint64_t))));
+        }
+        const auto hash_results = crypto::sha256_batch(hash_inputs);
+
+        std::vector<size_t> remaining_points;
+        for (size_t i = 0; i < pending_points.size(); ++i) {
+            const size_t point_idx = pending_points[i];
+            const auto& hash_result = hash_results[i];
+            const auto read_limb = [&](size_t limb) {
+                return ntohll(*reinterpret_cast<const uint64_t*>(hash_result.data() + limb * sizeof(uint64_t)));
+            };
+            uint256_t hash_result_uint(read_limb(0), read_limb(1), read_limb(2), read_limb(3));
             // We try to get a point from the resulting hash
             auto crs_element = grumpkin::g1::affine_element::from_compressed(hash_result_uint);
             // If the points coordinates are (0,0) then the compressed representation didn't land on an actual point
             // (happens half of the time) and we need to continue searching
             if (!crs_element.x.is_zero() || !crs_element.y.is_zero()) {
-                rational_point_found = true;
                 srs.at(point_idx) = static_cast<grumpkin::g1::affine_element>(crs_element);
-                break;
+            } else {
+                attempts[point_idx] += 1;
+                remaining_points.push_back(point_idx);
             }
-            attempt += 1;
         }
+        pending_points.swap(remaining_points);
     }
 
     bb::srs::Manifest manifest{ 0, 1, static_cast<uint32_t>(subgroup_size), 0, static_cast<uint32_t>(subgroup_size),
@@ -1,8 +1,35 @@
 #pragma once
+#include "barretenberg/common/constexpr_utils.hpp"
+#include "barretenberg/common/thread.hpp"
+
 #include <typeinfo>
 
 namespace bb {
 
+/**
+ * @brief Compute the product of all read and write terms of a log-derivative lookup or permutation at a row, i.e. the
+ * value whose inverse is stored in the inverse polynomial at that row
+ */
+template <typename FF, typename Relation, typename Row>
+FF compute_logderivative_inverse_denominator(const Row& row, const auto& relation_parameters)
+{
+    using Accumulator = typename Relation::ValueAccumulator0;
+    constexpr size_t READ_TERMS = Relation::READ_TERMS;
+    constexpr size_t WRITE_TERMS = Relation::WRITE_TERMS;
+
+    FF denominator = 1;
+    bb::constexpr_for<0, READ_TERMS, 1>([&]<size_t read_index> {
+        auto denominator_term = Relation::template compute_read_term<Accumulator, read_index>(row, relation_parameters);
+        denominator *= denominator_term;
+    });
+    bb::constexpr_for<0, WRITE_TERMS, 1>([&]<size_t write_index> {
+        auto denominator_term =
+            Relation::template compute_write_term<Accumulator, write_index>(row, relation_parameters);
+        denominator *= denominator_term;
+    });
+    return denominator;
+}
+
 /**
  * @brief Compute the inverse polynomial I(X) required for logderivative lookups
  * *
@@ -26,33 +53,20 @@ template <typename Flavor, typename Relation, typename Polynomials>
 void compute_logderivative_inverse(Polynomials& polynomials, auto& relation_parameters, const size_t circuit_size)
 {
     using FF = typename Flavor::FF;
-    using Accumulator = typename Relation::ValueAccumulator0;
-    constexpr size_t READ_TERMS = Relation::READ_TERMS;
-    constexpr size_t WRITE_TERMS = Relation::WRITE_TERMS;
-
-    auto lookup_relation = Relation();
 
-    auto& inverse_polynomial = lookup_relation.template get_inverse_polynomial(polynomials);
-    for (size_t i = 0; i < circuit_size; ++i) {
-        // TODO(https://github.com/AztecProtocol/barretenberg/issues/940): avoid get_row if possible.
-        auto row = polynomials.get_row(i);
-        bool has_inverse = lookup_relation.operation_exists_at_row(row);
-        if (!has_inverse) {
-            continue;
+    auto& inverse_polynomial = Relation::get_inverse_polynomial(polynomials);
+    // Rows are independent, only the batch inversion below runs over the whole polynomial
+    run_loop_in_parallel(circuit_size, [&](size_t start, size_t end) {
+        for (size_t i = start; i < end; ++i) {
+            // TODO(https://github.com/AztecProtocol/barretenberg/issues/940): avoid get_row if possible.
+            auto row = polynomials.get_row(i);
+            bool has_inverse = Relation::operation_exists_at_row(row);
+            if (!has_inverse) {
+                continue;
+            }
+            inverse_polynomial[i] = compute_logderivative_inverse_denominator<FF, Relation>(row, relation_parameters);
         }
-        FF denominator = 1;
-        bb::constexpr_for<0, READ_TERMS, 1>([&]<size_t read_index> {
-            auto denominator_term =
-                lookup_relation.template compute_read_term<Accumulator, read_index>(row, relation_parameters);
-            denominator *= denominator_term;
-        });
-        bb::constexpr_for<0, WRITE_TERMS, 1>([&]<size_t write_index> {
-            auto denominator_term =
-                lookup_relation.template compute_write_term<Accumulator, write_index>(row, relation_parameters);
-            denominator *= denominator_term;
-        });
-        inverse_polynomial[i] = denominator;
-    };
+    });
 
     // todo might be inverting zero in field bleh bleh
     FF::batch_invert(inverse_polynomial);
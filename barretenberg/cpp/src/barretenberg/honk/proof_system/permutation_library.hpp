@@ -1,8 +1,11 @@
 #pragma once
 #include "barretenberg/common/ref_vector.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/common/zip_view.hpp"
 #include "barretenberg/polynomials/polynomial.hpp"
 #include "barretenberg/relations/relation_parameters.hpp"
+#include <algorithm>
+#include <numeric>
 #include <typeinfo>
 
 namespace bb {
@@ -35,24 +38,59 @@ template <typename Flavor> void compute_concatenated_polynomials(typename Flavor
     // concatenation index
     const size_t MINI_CIRCUIT_SIZE = targets[0].size() / Flavor::CONCATENATION_GROUP_SIZE;
     ASSERT(MINI_CIRCUIT_SIZE * Flavor::CONCATENATION_GROUP_SIZE == targets[0].size());
-    // A function that produces 1 concatenated polynomial
-    // TODO(#756): This can be rewritten to use more cores. Currently uses at maximum the number of concatenated
-    // polynomials (4 in Goblin Translator)
-    auto ordering_function = [&](size_t i) {
-        auto my_group = concatenation_groups[i];
+    // A function that copies one member of one concatenation group into its position in the concatenated polynomial.
+    // Each (group, member) pair is an independent task, so we can use up to NUM_CONCATENATED_WIRES *
+    // CONCATENATION_GROUP_SIZE cores (64 in Goblin Translator) rather than one core per concatenated polynomial
+    auto ordering_function = [&](size_t task_index) {
+        const size_t i = task_index / Flavor::CONCATENATION_GROUP_SIZE;
+        const size_t j = task_index % Flavor::CONCATENATION_GROUP_SIZE;
+        auto& my_group = concatenation_groups[i];
+        if (j >= my_group.size()) {
+            return;
+        }
         auto& current_target = targets[i];
+        auto starting_write_offset = current_target.begin();
+        auto finishing_read_offset = my_group[j].begin();
+        std::advance(starting_write_offset, j * MINI_CIRCUIT_SIZE);
+        std::advance(finishing_read_offset, MINI_CIRCUIT_SIZE);
+        // Copy into appropriate position in the concatenated polynomial
+        std::copy(my_group[j].begin(), finishing_read_offset, starting_write_offset);
+    };
+    parallel_for(concatenation_groups.size() * Flavor::CONCATENATION_GROUP_SIZE, ordering_function);
+}
 
-        // For each polynomial in group
-        for (size_t j = 0; j < my_group.size(); j++) {
-            auto starting_write_offset = current_target.begin();
-            auto finishing_read_offset = my_group[j].begin();
-            std::advance(starting_write_offset, j * MINI_CIRCUIT_SIZE);
-            std::advance(finishing_read_offset, MINI_CIRCUIT_SIZE);
-            // Copy into appropriate position in the concatenated polynomial
-            std::copy(my_group[j].begin(), finishing_read_offset, starting_write_offset);
+/**
+ * @brief Write the values counted in a histogram into a polynomial in non-descending order
+ *
+ * @details `counts[v]` is the number of times the value v occurs. The output rows are split between threads and each
+ * thread locates the first value it has to write with a binary search over the prefix sums of the histogram, so the
+ * work stays balanced even when the histogram is heavily skewed (e.g. the extra denominator, which is mostly zeroes).
+ *
+ * @param counts Histogram over the domain [0, counts.size())
+ * @param target Polynomial with at least sum(counts) coefficients
+ */
+template <typename Polynomial>
+void write_sorted_values_from_histogram(const std::vector<size_t>& counts, Polynomial& target)
+{
+    using FF = typename Polynomial::FF;
+    // ends[v] is the row just past the last occurence of the value v
+    std::vector<size_t> ends(counts.size());
+    std::partial_sum(counts.begin(), counts.end(), ends.begin());
+    const size_t num_rows = ends.back();
+    ASSERT(num_rows <= target.size());
+
+    run_loop_in_parallel(num_rows, [&](size_t start, size_t end) {
+        auto value = static_cast<size_t>(std::upper_bound(ends.begin(), ends.end(), start) - ends.begin());
+        size_t row = start;
+        while (row < end) {
+            const size_t run_end = std::min(ends[value], end);
+            const FF value_ff(value);
+            for (; row < run_end; ++row) {
+                target[row] = value_ff;
+            }
+            ++value;
         }
-    };
-    parallel_for(concatenation_groups.size(), ordering_function);
+    });
 }
 
 /**
@@ -99,99 +137,67 @@ void compute_goblin_translator_range_constraint_ordered_polynomials(typename Fla
     // Check if we can construct these polynomials
     ASSERT((num_concatenated_wires + 1) * sorted_elements_count < full_circuit_size);
 
-    // First use integers (easier to sort)
-    std::vector<size_t> sorted_elements(sorted_elements_count);
+    // The range constrained values live in [0, max_value], so instead of comparison-sorting each ordered polynomial we
+    // build a histogram of its values and expand it (counting sort). Values outside of the range can only come from an
+    // invalid witness; they are masked to keep the histogram in bounds, which still makes the permutation argument fail
+    constexpr size_t histogram_size = static_cast<size_t>(max_value) + 1;
+    const auto to_histogram_index = [](const FF& value) {
+        return static_cast<size_t>(uint256_t(value).data[0]) & static_cast<size_t>(max_value);
+    };
 
-    // Fill with necessary steps
-    sorted_elements[0] = max_value;
+    // Each ordered polynomial and the extra denominator contain the step sequence 0, 3, 6, ..., max_value once
+    std::vector<size_t> step_counts(histogram_size, 0);
+    step_counts[max_value] = 1;
     for (size_t i = 1; i < sorted_elements_count; i++) {
-        sorted_elements[i] = (sorted_elements_count - 1 - i) * sort_step;
+        step_counts[(sorted_elements_count - 1 - i) * sort_step]++;
     }
 
-    std::vector<std::vector<uint32_t>> ordered_vectors_uint(num_concatenated_wires);
     auto ordered_constraint_polynomials = std::vector{ &polynomials.ordered_range_constraints_0,
                                                        &polynomials.ordered_range_constraints_1,
                                                        &polynomials.ordered_range_constraints_2,
                                                        &polynomials.ordered_range_constraints_3 };
-    std::vector<size_t> extra_denominator_uint(full_circuit_size);
 
     // Get information which polynomials need to be concatenated
     auto concatenation_groups = polynomials.get_concatenation_groups();
 
-    // A function that transfers elements from each of the polynomials in the chosen concatenation group in the uint
-    // ordered polynomials
-    auto ordering_function = [&](size_t i) {
-        // Get the group and the main target vector
-        auto my_group = concatenation_groups[i];
-        auto& current_vector = ordered_vectors_uint[i];
-        current_vector.resize(full_circuit_size);
+    // Calculate how much space there is for values from the original polynomials. Values past this point in each
+    // concatenated polynomial overflow into the extra denominator
+    const size_t free_space_before_runway = full_circuit_size - sorted_elements_count;
 
-        // Calculate how much space there is for values from the original polynomials
-        auto free_space_before_runway = full_circuit_size - sorted_elements_count;
-
-        // Calculate the offset of this group's overflowing elements in the extra denominator polynomial
-        size_t extra_denominator_offset = i * sorted_elements_count;
-
-        // Go through each polynomial in the concatenation group
+    // Count the values of each concatenation group that fit in its ordered polynomial
+    std::vector<std::vector<size_t>> counts(num_concatenated_wires, step_counts);
+    parallel_for(num_concatenated_wires, [&](size_t i) {
+        auto& my_group = concatenation_groups[i];
         for (size_t j = 0; j < Flavor::CONCATENATION_GROUP_SIZE; j++) {
-
-            // Calculate the offset in the target vector
-            auto current_offset = j * mini_circuit_size;
-            // For each element in the polynomial
-            for (size_t k = 0; k < mini_circuit_size; k++) {
-
-                // Put it it the target polynomial
-                if ((current_offset + k) < free_space_before_runway) {
-                    current_vector[current_offset + k] = static_cast<uint32_t>(uint256_t(my_group[j][k]).data[0]);
-
-                    // Or in the extra one if there is no space left
-                } else {
-                    extra_denominator_uint[extra_denominator_offset] =
-                        static_cast<uint32_t>(uint256_t(my_group[j][k]).data[0]);
-                    extra_denominator_offset++;
-                }
+            const size_t current_offset = j * mini_circuit_size;
+            if (current_offset >= free_space_before_runway) {
+                break;
+            }
+            const size_t in_range_count = std::min(mini_circuit_size, free_space_before_runway - current_offset);
+            for (size_t k = 0; k < in_range_count; k++) {
+                counts[i][to_histogram_index(my_group[j][k])]++;
             }
         }
-        // Copy the steps into the target polynomial
-        auto starting_write_offset = current_vector.begin();
-        std::advance(starting_write_offset, free_space_before_runway);
-        std::copy(sorted_elements.cbegin(), sorted_elements.cend(), starting_write_offset);
-
-        // Sort the polynomial in nondescending order. We sort using vector with size_t elements for 2 reasons:
-        // 1. It is faster to sort size_t
-        // 2. Comparison operators for finite fields are operating on internal form, so we'd have to convert them from
-        // Montgomery
-        std::sort(current_vector.begin(), current_vector.end());
-
-        // Copy the values into the actual polynomial
-        std::transform(current_vector.cbegin(),
-                       current_vector.cend(),
-                       (*ordered_constraint_polynomials[i]).begin(),
-                       [](uint32_t in) { return FF(in); });
-    };
+    });
 
-    // Construct the first 4 polynomials
-    parallel_for(num_concatenated_wires, ordering_function);
-    ordered_vectors_uint.clear();
-
-    auto sorted_element_insertion_offset = extra_denominator_uint.begin();
-    std::advance(sorted_element_insertion_offset, num_concatenated_wires * sorted_elements_count);
-
-    // Add steps to the extra denominator polynomial
-    std::copy(sorted_elements.cbegin(), sorted_elements.cend(), sorted_element_insertion_offset);
+    // Construct the first 4 polynomials. Each of them is written by a parallel loop of its own, as parallel loops must
+    // not be nested
+    for (size_t i = 0; i < num_concatenated_wires; i++) {
+        write_sorted_values_from_histogram(counts[i], *ordered_constraint_polynomials[i]);
+    }
 
-    // Sort it
-#ifdef NO_TBB
-    std::sort(extra_denominator_uint.begin(), extra_denominator_uint.end());
-#else
-    std::sort(std::execution::par_unseq, extra_denominator_uint.begin(), extra_denominator.end());
-#endif
+    // The extra denominator holds the overflowing values of each concatenated polynomial, the steps and zeroes
+    // everywhere else
+    std::vector<size_t> extra_denominator_counts(step_counts);
+    for (auto& group : concatenation_groups) {
+        for (size_t position = free_space_before_runway; position < full_circuit_size; position++) {
+            const FF& value = group[position / mini_circuit_size][position % mini_circuit_size];
+            extra_denominator_counts[to_histogram_index(value)]++;
+        }
+    }
+    extra_denominator_counts[0] += full_circuit_size - (num_concatenated_wires + 1) * sorted_elements_count;
 
-    // And copy it to the actual polynomial
-    std::transform(extra_denominator_uint.cbegin(),
-                   extra_denominator_uint.cend(),
-                   polynomials.ordered_range_constraints_4.begin(),
-                   [](uint32_t in) { return FF(in); });
+    write_sorted_values_from_histogram(extra_denominator_counts, polynomials.ordered_range_constraints_4);
 }
 
 } // namespace bb
\ No newline at end of file
@@ -765,6 +765,55 @@ TYPED_TEST(ultra_plonk_composer, range_checks_on_duplicates)
     TestFixture::prove_and_verify(builder, /*expected_result=*/true);
 }
 
+/**
+ * @brief Test that a batch of proofs of different circuits verifies with a single pairing check, and that a single bad
+ * proof makes the whole batch fail
+ *
+ */
+TYPED_TEST(ultra_plonk_composer, batch_verify)
+{
+    using Verifier = std::conditional_t<TypeParam::use_keccak, UltraWithKeccakVerifier, UltraVerifier>;
+    std::vector<Verifier> verifiers;
+    std::vector<plonk::proof> proofs;
+    const auto add_proof = [&](const size_t num_gates, const bool satisfied) {
+        auto builder = UltraCircuitBuilder();
+        for (size_t i = 0; i < num_gates; ++i) {
+            fr a = fr::random_element();
+            fr b = fr::random_element();
+            fr c = (satisfied || i + 1 < num_gates) ? a + b : a + b + 1;
+            uint32_t a_idx = builder.add_public_variable(a);
+            uint32_t b_idx = builder.add_variable(b);
+            uint32_t c_idx = builder.add_variable(c);
+            builder.create_add_gate({ a_idx, b_idx, c_idx, 1, 1, -1, 0 });
+        }
+        auto composer = UltraComposer();
+        if constexpr (TypeParam::use_keccak) {
+            auto prover = composer.create_ultra_with_keccak_prover(builder);
+            verifiers.emplace_back(composer.create_ultra_with_keccak_verifier(builder));
+            proofs.emplace_back(prover.construct_proof());
+        } else {
+            auto prover = composer.create_prover(builder);
+            verifiers.emplace_back(composer.create_verifier(builder));
+            proofs.emplace_back(prover.construct_proof());
+        }
+    };
+
+    constexpr size_t num_proofs = 3;
+    for (size_t i = 0; i < num_proofs; ++i) {
+        add_proof(10UL << i, /*satisfied=*/true);
+    }
+    for (size_t i = 0; i < num_proofs; ++i) {
+        EXPECT_TRUE(verifiers[i].verify_proof(proofs[i]));
+    }
+    EXPECT_TRUE(Verifier::batch_verify(verifiers, proofs));
+
+    // Replace the last proof with a proof of an unsatisfied circuit
+    verifiers.pop_back();
+    proofs.pop_back();
+    add_proof(10, /*satisfied=*/false);
+    EXPECT_FALSE(Verifier::batch_verify(verifiers, proofs));
+}
+
 // Ensure copy constraints added on variables smaller than 2^14, which have been previously
 // range constrained, do not break the set equivalence checks because of indices mismatch.
 // 2^14 is DEFAULT_PLOOKUP_RANGE_BITNUM i.e. the maximum size before a variable gets sliced
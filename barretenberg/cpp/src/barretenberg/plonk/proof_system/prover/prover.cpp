@@ -11,6 +11,12 @@ using namespace bb;
 
 namespace bb::plonk {
 
+namespace {
+// The transition widgets are evaluated together over chunks of this many points of the large domain, so that the coset
+// FFTs they share (wires, selectors) are read from memory once per chunk rather than once per widget
+constexpr size_t QUOTIENT_CHUNK_SIZE = 1UL << 8;
+} // namespace
+
 /**
  * Create ProverBase from proving key, witness and manifest.
  *
@@ -361,16 +367,7 @@ template <typename settings> void ProverBase<settings>::execute_fourth_round()
     transcript.apply_fiat_shamir("alpha");
     fr alpha_base = fr::serialize_from_buffer(transcript.get_challenge("alpha").begin());
 
-    // Compute FFT of lagrange polynomial L_1 (needed in random widgets only)
-    compute_lagrange_1_fft();
-
-    for (auto& widget : random_widgets) {
-        alpha_base = widget->compute_quotient_contribution(alpha_base, transcript);
-    }
-
-    for (auto& widget : transition_widgets) {
-        alpha_base = widget->compute_quotient_contribution(alpha_base, transcript);
-    }
+    compute_quotient_contributions(alpha_base);
 
     // The parts of the quotient polynomial t(X) are stored as 4 separate polynomials in
     // the code. However, operations such as dividing by the pseudo vanishing polynomial
@@ -474,6 +471,46 @@ template <typename settings> void ProverBase<settings>::add_blinding_to_quotient
     }
 }
 
+/**
+ * @brief Compute the contributions of all widgets to the quotient polynomial, on the coset of the large domain
+ *
+ * @details The random widgets each make their own pass over the domain. The transition widgets are fused: each
+ * thread walks its range of the large domain in chunks of QUOTIENT_CHUNK_SIZE points and evaluates every transition
+ * widget on a chunk before moving to the next, so that the polynomials used by several widgets stay in cache.
+ *
+ * @return The alpha base following the last widget
+ */
+template <typename settings> fr ProverBase<settings>::compute_quotient_contributions(const fr& alpha)
+{
+    fr alpha_base = alpha;
+
+    // Compute FFT of lagrange polynomial L_1 (needed in random widgets only)
+    compute_lagrange_1_fft();
+
+    for (auto& widget : random_widgets) {
+        alpha_base = widget->compute_quotient_contribution(alpha_base, transcript);
+    }
+
+    for (auto& widget : transition_widgets) {
+        alpha_base = widget->prepare_quotient_contribution(alpha_base, transcript);
+    }
+
+    const auto& large_domain = key->large_domain;
+    // Chunks must not cross two parts of the quotient
+    const size_t chunk_size = std::min(QUOTIENT_CHUNK_SIZE, std::min(large_domain.thread_size, circuit_size));
+    parallel_for(large_domain.num_threads, [&](size_t j) {
+        const size_t start = j * large_domain.thread_size;
+        const size_t end = (j + 1) * large_domain.thread_size;
+        for (size_t chunk_start = start; chunk_start < end; chunk_start += chunk_size) {
+            for (auto& widget : transition_widgets) {
+                widget->accumulate_quotient_contribution(chunk_start, chunk_start + chunk_size);
+            }
+        }
+    });
+
+    return alpha_base;
+}
+
 // Compute FFT of lagrange polynomial L_1 needed in random widgets only
 template <typename settings> void ProverBase<settings>::compute_lagrange_1_fft()
 {
@@ -37,6 +37,7 @@ template <typename settings> class ProverBase {
     void compute_opening_elements();
     void add_plookup_memory_records_to_w_4();
 
+    fr compute_quotient_contributions(const fr& alpha_base);
     void compute_quotient_evaluation();
     void add_blinding_to_quotient_polynomial_parts();
     void compute_lagrange_1_fft();
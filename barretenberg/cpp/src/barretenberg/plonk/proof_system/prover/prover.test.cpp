@@ -2,7 +2,10 @@
 #include "../widgets/random_widgets/permutation_widget.hpp"
 #include "../widgets/transition_widgets/arithmetic_widget.hpp"
 
+#include "barretenberg/crypto/pedersen_commitment/pedersen.hpp"
 #include "barretenberg/ecc/curves/bn254/bn254.hpp"
+#include "barretenberg/plonk/composer/standard_composer.hpp"
+#include "barretenberg/plonk/composer/ultra_composer.hpp"
 #include "barretenberg/plonk/proof_system/commitment_scheme/kate_commitment_scheme.hpp"
 #include "barretenberg/polynomials/polynomial_arithmetic.hpp"
 #include "barretenberg/srs/factories/file_crs_factory.hpp"
@@ -283,6 +286,47 @@ plonk::Prover generate_test_data(const size_t n)
     state.commitment_scheme = std::move(kate_commitment_scheme);
     return state;
 }
+
+/**
+ * @brief Run the prover up to the quotient round, then check that the fused evaluation of the transition widgets
+ * produces the same quotient and alpha base as running each widget's compute_quotient_contribution in turn
+ */
+template <typename settings> void check_fused_quotient_contributions(plonk::ProverBase<settings>& prover)
+{
+    prover.execute_preamble_round();
+    prover.queue.process_queue();
+    prover.execute_first_round();
+    prover.queue.process_queue();
+    prover.execute_second_round();
+    prover.queue.process_queue();
+    prover.execute_third_round();
+    prover.queue.process_queue();
+
+    prover.transcript.apply_fiat_shamir("alpha");
+    const fr alpha = fr::serialize_from_buffer(prover.transcript.get_challenge("alpha").begin());
+
+    auto& quotient_parts = prover.key->quotient_polynomial_parts;
+    const fr fused_alpha_base = prover.compute_quotient_contributions(alpha);
+    std::vector<polynomial> fused_quotient_parts;
+    for (auto& part : quotient_parts) {
+        fused_quotient_parts.emplace_back(part);
+        std::fill(part.begin(), part.end(), fr::zero());
+    }
+
+    fr alpha_base = alpha;
+    prover.compute_lagrange_1_fft();
+    for (auto& widget : prover.random_widgets) {
+        alpha_base = widget->compute_quotient_contribution(alpha_base, prover.transcript);
+    }
+    for (auto& widget : prover.transition_widgets) {
+        alpha_base = widget->compute_quotient_contribution(alpha_base, prover.transcript);
+    }
+
+    EXPECT_EQ(fused_alpha_base, alpha_base);
+    for (size_t i = 0; i < plonk::NUM_QUOTIENT_PARTS; ++i) {
+        EXPECT_EQ(fused_quotient_parts[i], quotient_parts[i]);
+    }
+}
 } // namespace prover_helpers
 
 TEST(prover, compute_quotient_polynomial)
@@ -303,3 +347,76 @@ TEST(prover, compute_quotient_polynomial)
         EXPECT_EQ((state.key->quotient_polynomial_parts[3].at(i) == fr::zero()), true);
     }
 }
+
+TEST(prover, fused_quotient_contributions_standard)
+{
+    bb::srs::init_crs_factory("../srs_db/ignition");
+    auto builder = StandardCircuitBuilder();
+    for (size_t i = 0; i < 1000; ++i) {
+        const fr a = fr::random_element();
+        const fr b = fr::random_element();
+        const uint32_t a_idx = builder.add_variable(a);
+        const uint32_t b_idx = builder.add_variable(b);
+        const uint32_t c_idx = builder.add_variable(a + b);
+        const uint32_t d_idx = builder.add_variable(a * b);
+        builder.create_add_gate({ a_idx, b_idx, c_idx, fr::one(), fr::one(), fr::neg_one(), fr::zero() });
+        builder.create_mul_gate({ a_idx, b_idx, d_idx, fr::one(), fr::neg_one(), fr::zero() });
+    }
+
+    auto composer = plonk::StandardComposer();
+    auto prover = composer.create_prover(builder);
+    prover_helpers::check_fused_quotient_contributions(prover);
+}
+
+TEST(prover, fused_quotient_contributions_ultra)
+{
+    bb::srs::init_crs_factory("../srs_db/ignition");
+    auto builder = UltraCircuitBuilder();
+
+    // Arithmetic, delta range, plookup and auxiliary gates
+    for (size_t i = 0; i < 200; ++i) {
+        const fr a = fr::random_element();
+        const fr b = fr::random_element();
+        const uint32_t a_idx = builder.add_variable(a);
+        const uint32_t b_idx = builder.add_variable(b);
+        const uint32_t c_idx = builder.add_variable(a * b);
+        const uint32_t d_idx = builder.add_variable(a * b + a + b);
+        builder.create_big_add_gate({ a_idx, b_idx, c_idx, d_idx, 1, 1, 1, -1, 0 });
+        builder.create_mul_gate({ a_idx, b_idx, c_idx, 1, -1, 0 });
+
+        const uint32_t range_idx = builder.add_variable(fr(i));
+        builder.create_new_range_constraint(range_idx, 255);
+
+        const fr left(i * 7);
+        const fr right(i * 13);
+        const auto accumulators =
+            plookup::get_lookup_accumulators(plookup::MultiTableId::UINT32_XOR, left, right, true);
+        builder.create_gates_from_plookup_accumulators(
+            plookup::MultiTableId::UINT32_XOR, accumulators, builder.add_variable(left), builder.add_variable(right));
+    }
+    const size_t rom_id = builder.create_ROM_array(8);
+    for (size_t i = 0; i < 8; ++i) {
+        builder.set_ROM_element(rom_id, i, builder.add_variable(fr::random_element()));
+    }
+    for (size_t i = 0; i < 8; ++i) {
+        builder.read_ROM_array(rom_id, builder.add_variable(fr(i)));
+    }
+
+    // Elliptic gate
+    using affine_element = grumpkin::g1::affine_element;
+    using element = grumpkin::g1::element;
+    const affine_element p1 = crypto::pedersen_commitment::commit_native({ bb::fr(1) }, 0);
+    const affine_element p2 = crypto::pedersen_commitment::commit_native({ bb::fr(1) }, 1);
+    const affine_element p3(element(p1) + element(p2));
+    builder.create_ecc_add_gate({ builder.add_variable(p1.x),
+                                  builder.add_variable(p1.y),
+                                  builder.add_variable(p2.x),
+                                  builder.add_variable(p2.y),
+                                  builder.add_variable(p3.x),
+                                  builder.add_variable(p3.y),
+                                  1 });
+
+    auto composer = plonk::UltraComposer();
+    auto prover = composer.create_prover(builder);
+    prover_helpers::check_fused_quotient_contributions(prover);
+}
@@ -1,7 +1,9 @@
 #include "./verifier.hpp"
 #include "../public_inputs/public_inputs.hpp"
 #include "../utils/kate_verification.hpp"
+#include "barretenberg/common/task_graph.hpp"
 #include "barretenberg/common/throw_or_abort.hpp"
+#include "barretenberg/ecc/curves/bn254/batch_pairing_check.hpp"
 #include "barretenberg/ecc/curves/bn254/fq12.hpp"
 #include "barretenberg/ecc/curves/bn254/pairing.hpp"
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
@@ -38,6 +40,30 @@ VerifierBase<program_settings>& VerifierBase<program_settings>::operator=(Verifi
 }
 
 template <typename program_settings> bool VerifierBase<program_settings>::verify_proof(const plonk::proof& proof)
+{
+    std::array<g1::element, 2> P = reduce_to_pairing_check(proof);
+
+    g1::element::batch_normalize(P.data(), 2);
+
+    g1::affine_element P_affine[2]{
+        { P[0].x, P[0].y },
+        { P[1].x, P[1].y },
+    };
+
+    // The final pairing check of step 12.
+    bb::fq12 result = bb::pairing::reduced_ate_pairing_batch_precomputed(
+        P_affine, key->reference_string->get_precomputed_g2_lines(), 2);
+
+    return (result == bb::fq12::one());
+}
+
+/**
+ * @brief Run every step of proof verification except the final pairing check
+ *
+ * @return The pairing points (P₀, P₁) for which e(P₀,[1]₂)⋅e(P₁,[x]₂) ≡ [1]ₜ must hold
+ */
+template <typename program_settings>
+std::array<g1::element, 2> VerifierBase<program_settings>::reduce_to_pairing_check(const plonk::proof& proof)
 {
     // This function verifies a PLONK proof for given program settings.
     // A PLONK proof for standard PLONK is of the form:
@@ -180,7 +206,7 @@ template <typename program_settings> bool VerifierBase<program_settings>::verify
     bb::scalar_multiplication::generate_pippenger_point_table<curve::BN254>(&elements[0], &elements[0], num_elements);
     scalar_multiplication::pippenger_runtime_state<curve::BN254> state(num_elements);
 
-    g1::element P[2];
+    std::array<g1::element, 2> P;
 
     P[0] = bb::scalar_multiplication::pippenger<curve::BN254>(&scalars[0], &elements[0], num_elements, state);
     P[1] = -(g1::element(PI_Z_OMEGA) * separator_challenge + PI_Z);
@@ -224,18 +250,38 @@ template <typename program_settings> bool VerifierBase<program_settings>::verify
         P[1] += g1::element(x1, y1, 1) * recursion_separator_challenge;
     }
 
-    g1::element::batch_normalize(P, 2);
+    return P;
+}
 
-    g1::affine_element P_affine[2]{
-        { P[0].x, P[0].y },
-        { P[1].x, P[1].y },
-    };
+/**
+ * @brief Verify a batch of proofs, each with its own verifier, with a single pairing check
+ *
+ * @details The transcript and Kate work of each proof is independent, and the proofs are reduced as concurrent tasks
+ * of a TaskGraph. Each task only touches its own verifier and its own pairing points. The resulting pairing points are
+ * then combined with random weights into one pairing check, see bb::pairing::batch_pairing_check. All verifiers must
+ * share the same verifier reference string.
+ *
+ * @return true iff every proof verifies
+ */
+template <typename program_settings>
+bool VerifierBase<program_settings>::batch_verify(std::span<VerifierBase> verifiers,
+                                                  std::span<const plonk::proof> proofs)
+{
+    ASSERT(verifiers.size() == proofs.size());
+    if (proofs.empty()) {
+        return true;
+    }
 
-    // The final pairing check of step 12.
-    bb::fq12 result = bb::pairing::reduced_ate_pairing_batch_precomputed(
-        P_affine, key->reference_string->get_precomputed_g2_lines(), 2);
+    const auto& reference_string = verifiers[0].key->reference_string;
+    std::vector<std::array<g1::element, 2>> pairing_points(proofs.size());
+    TaskGraph graph("plonk_batch_verify");
+    for (size_t i = 0; i < proofs.size(); ++i) {
+        ASSERT(verifiers[i].key->reference_string->get_g2x() == reference_string->get_g2x());
+        graph.add([&, i] { pairing_points[i] = verifiers[i].reduce_to_pairing_check(proofs[i]); });
+    }
+    graph.run();
 
-    return (result == bb::fq12::one());
+    return bb::pairing::batch_pairing_check(pairing_points, reference_string->get_precomputed_g2_lines());
 }
 
 template class VerifierBase<standard_verifier_settings>;
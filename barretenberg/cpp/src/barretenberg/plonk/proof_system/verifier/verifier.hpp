@@ -5,6 +5,9 @@
 #include "barretenberg/plonk/proof_system/commitment_scheme/commitment_scheme.hpp"
 #include "barretenberg/plonk/transcript/manifest.hpp"
 
+#include <array>
+#include <span>
+
 namespace bb::plonk {
 template <typename program_settings> class VerifierBase {
 
@@ -20,6 +23,10 @@ template <typename program_settings> class VerifierBase {
     bool validate_scalars();
 
     bool verify_proof(const plonk::proof& proof);
+    std::array<bb::g1::element, 2> reduce_to_pairing_check(const plonk::proof& proof);
+
+    static bool batch_verify(std::span<VerifierBase> verifiers, std::span<const plonk::proof> proofs);
+
     transcript::Manifest manifest;
 
     std::shared_ptr<verification_key> key;
@@ -1,9 +1,9 @@
 #pragma once
 
+#include <algorithm>
 #include <array>
 #include <cstddef>
 #include <set>
-#include <unordered_map>
 #include <vector>
 
 #include "../../types/prover_settings.hpp"
@@ -43,7 +43,8 @@ template <class Field, size_t num_widget_relations> struct challenge_array {
 template <class Field> using poly_array = std::array<std::pair<Field, Field>, PolynomialIndex::MAX_NUM_POLYNOMIALS>;
 
 template <class Field> struct poly_ptr_map {
-    std::unordered_map<PolynomialIndex, polynomial::pointer> coefficients;
+    // Indexed by PolynomialIndex, null for polynomials a widget does not require
+    std::array<polynomial::pointer, PolynomialIndex::MAX_NUM_POLYNOMIALS> coefficients;
     size_t block_mask;
     size_t index_shift;
 };
@@ -246,7 +247,7 @@ class FFTGetter : public BaseGetter<Field, Transcript, Settings, num_widget_rela
                 .coefficients[id][(ptrdiff_t)((index + polynomials.index_shift) & polynomials.block_mask)];
         }
         // This ID should exist
-        ASSERT(polynomials.coefficients.count(id) > 0);
+        ASSERT(polynomials.coefficients[id] != nullptr);
         return polynomials.coefficients[id][(ptrdiff_t)index];
     }
 };
@@ -274,6 +275,20 @@ template <class Field> class TransitionWidgetBase {
 
     virtual Field compute_quotient_contribution(const Field&, const transcript::StandardTranscript&) = 0;
 
+    /**
+     * @brief Load the challenges and polynomials the widget needs to contribute to the quotient, so that the
+     * contribution can then be accumulated over parts of the large domain
+     *
+     * @return The alpha base for the next widget
+     */
+    virtual Field prepare_quotient_contribution(const Field&, const transcript::StandardTranscript&) = 0;
+
+    /**
+     * @brief Accumulate the contribution of the widget to the quotient at the points [start, end) of the large domain,
+     * after prepare_quotient_contribution. The range must not cross two parts of the quotient.
+     */
+    virtual void accumulate_quotient_contribution(size_t start, size_t end) = 0;
+
   public:
     proving_key* key;
 };
@@ -313,6 +328,24 @@ class TransitionWidget : public TransitionWidgetBase<Field> {
 
     Field compute_quotient_contribution(const Field& alpha_base,
                                         const transcript::StandardTranscript& transcript) override
+    {
+        auto* key = TransitionWidgetBase<Field>::key;
+        const Field next_alpha_base = prepare_quotient_contribution(alpha_base, transcript);
+
+        parallel_for(key->large_domain.num_threads, [&](size_t j) {
+            const size_t start = j * key->large_domain.thread_size;
+            const size_t end = (j + 1) * key->large_domain.thread_size;
+            // A thread's range of the large domain may cover several parts of the quotient
+            for (size_t part_start = start; part_start < end; part_start += key->circuit_size) {
+                accumulate_quotient_contribution(part_start, std::min(part_start + key->circuit_size, end));
+            }
+        });
+
+        return next_alpha_base;
+    }
+
+    Field prepare_quotient_contribution(const Field& alpha_base,
+                                        const transcript::StandardTranscript& transcript) override
     {
         auto* key = TransitionWidgetBase<Field>::key;
         ASSERT(key != nullptr);
@@ -321,20 +354,28 @@ class TransitionWidget : public TransitionWidgetBase<Field> {
         auto& required_polynomial_ids = FFTKernel::get_required_polynomial_ids();
 
         // Construct the map of pointers to the required polynomials
-        poly_ptr_map polynomials = FFTGetter::get_polynomials(key, required_polynomial_ids);
-
-        challenge_array challenges =
-            FFTGetter::get_challenges(transcript, alpha_base, FFTKernel::quotient_required_challenges);
+        polynomials = FFTGetter::get_polynomials(key, required_polynomial_ids);
 
-        ITERATE_OVER_DOMAIN_START(key->large_domain);
-        // populate split quotient components
-        Field& quotient_term =
-            key->quotient_polynomial_parts[i >> key->small_domain.log2_size][i & (key->circuit_size - 1)];
-        FFTKernel::accumulate_contribution(polynomials, challenges, quotient_term, i);
-        ITERATE_OVER_DOMAIN_END;
+        challenges = FFTGetter::get_challenges(transcript, alpha_base, FFTKernel::quotient_required_challenges);
 
         return FFTGetter::update_alpha(challenges, FFTKernel::num_independent_relations);
     }
+
+    void accumulate_quotient_contribution(const size_t start, const size_t end) override
+    {
+        auto* key = TransitionWidgetBase<Field>::key;
+        // populate split quotient components
+        Field* quotient_part = &key->quotient_polynomial_parts[start >> key->small_domain.log2_size][0];
+        const size_t part_mask = key->circuit_size - 1;
+        for (size_t i = start; i < end; ++i) {
+            FFTKernel::accumulate_contribution(polynomials, challenges, quotient_part[i & part_mask], i);
+        }
+    }
+
+  private:
+    // Set by prepare_quotient_contribution
+    poly_ptr_map polynomials;
+    challenge_array challenges;
 };
 
 template <class Field, class Transcript, class Settings, template <typename, typename, typename> typename KernelBase>
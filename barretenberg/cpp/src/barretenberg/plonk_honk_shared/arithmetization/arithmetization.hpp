@@ -5,6 +5,7 @@
 #include <array>
 #include <barretenberg/common/slab_allocator.hpp>
 #include <cstddef>
+#include <numeric>
 #include <vector>
 
 namespace bb {
@@ -66,6 +67,88 @@ template <typename FF, size_t NUM_WIRES, size_t NUM_SELECTORS> class ExecutionTr
     }
 };
 
+/**
+ * @brief The layout of a structured execution trace: the number of rows reserved for each block of the trace, in the
+ * order of TraceBlocks::get()
+ * @details In a structured trace each block is placed at a fixed offset regardless of how many gates it actually
+ * contains, so that the traces of different circuits line up row for row (which is what makes them cheap to fold). The
+ * capacities may be supplied by the caller or fitted to a set of observed circuits via fit(). An empty structure
+ * denotes a conventional, unstructured trace in which each block immediately follows the previous one.
+ */
+struct TraceStructure {
+    std::vector<size_t> block_capacities;
+
+    TraceStructure() = default;
+    TraceStructure(size_t num_blocks, size_t block_capacity)
+        : block_capacities(num_blocks, block_capacity)
+    {}
+    explicit TraceStructure(std::vector<size_t> block_capacities)
+        : block_capacities(std::move(block_capacities))
+    {}
+
+    bool is_structured() const { return !block_capacities.empty(); }
+
+    // The total number of rows reserved for the blocks of the trace
+    size_t num_rows() const { return std::accumulate(block_capacities.begin(), block_capacities.end(), size_t(0)); }
+
+    bool fits(const std::vector<size_t>& block_sizes) const
+    {
+        if (block_sizes.size() != block_capacities.size()) {
+            return false;
+        }
+        for (size_t i = 0; i < block_sizes.size(); ++i) {
+            if (block_sizes[i] > block_capacities[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Grow the capacity of each block as needed to accommodate blocks of the given sizes
+     * @details Fitting the structure to each of a set of circuits in turn yields the smallest structure that can hold
+     * any of them.
+     */
+    void fit(const std::vector<size_t>& block_sizes)
+    {
+        if (block_capacities.size() < block_sizes.size()) {
+            block_capacities.resize(block_sizes.size(), 0);
+        }
+        for (size_t i = 0; i < block_sizes.size(); ++i) {
+            block_capacities[i] = std::max(block_capacities[i], block_sizes[i]);
+        }
+    }
+
+    /**
+     * @brief The fraction of the capacity of each block used by blocks of the given sizes
+     */
+    std::vector<double> fill_ratios(const std::vector<size_t>& block_sizes) const
+    {
+        std::vector<double> ratios(block_capacities.size(), 0.0);
+        for (size_t i = 0; i < block_capacities.size() && i < block_sizes.size(); ++i) {
+            if (block_capacities[i] > 0) {
+                ratios[i] = static_cast<double>(block_sizes[i]) / static_cast<double>(block_capacities[i]);
+            }
+        }
+        return ratios;
+    }
+
+    void print_fill_ratios(const std::vector<size_t>& block_sizes) const
+    {
+        auto ratios = fill_ratios(block_sizes);
+        size_t total_size = std::accumulate(block_sizes.begin(), block_sizes.end(), size_t(0));
+        info("Structured trace fill:");
+        for (size_t i = 0; i < block_capacities.size(); ++i) {
+            size_t size = i < block_sizes.size() ? block_sizes[i] : 0;
+            info("block ", i, ":\t", size, " / ", block_capacities[i], "\t(", static_cast<int>(100 * ratios[i]), "%)");
+        }
+        info("total:\t\t", total_size, " / ", num_rows());
+        info("");
+    }
+
+    bool operator==(const TraceStructure& other) const = default;
+};
+
 // These are not magic numbers and they should not be written with global constants. These parameters are not
 // accessible through clearly named static class members.
 template <typename FF_> class StandardArith {
@@ -119,7 +202,8 @@ template <typename FF_> class UltraArith {
   public:
     static constexpr size_t NUM_WIRES = 4;
     static constexpr size_t NUM_SELECTORS = 11;
-    static constexpr size_t FIXED_BLOCK_SIZE = 1 << 10; // Size of each block in a structured trace (arbitrary for now)
+    // Size of each block in the default structured trace (arbitrary for now), see TraceStructure
+    static constexpr size_t FIXED_BLOCK_SIZE = 1 << 10;
     using FF = FF_;
 
     class UltraTraceBlock : public ExecutionTraceBlock<FF, NUM_WIRES, NUM_SELECTORS> {
@@ -197,7 +281,8 @@ template <typename FF_> class UltraHonkArith {
   public:
     static constexpr size_t NUM_WIRES = 4;
     static constexpr size_t NUM_SELECTORS = 14;
-    static constexpr size_t FIXED_BLOCK_SIZE = 1 << 10; // Size of each block in a structured trace (arbitrary for now)
+    // Size of each block in the default structured trace (arbitrary for now), see TraceStructure
+    static constexpr size_t FIXED_BLOCK_SIZE = 1 << 10;
 
     using FF = FF_;
 
@@ -1,8 +1,10 @@
 #pragma once
 #include "barretenberg/common/ref_array.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/flavor/flavor.hpp"
 #include "barretenberg/polynomials/polynomial_store.hpp"
 
+#include <algorithm>
 #include <memory>
 
 namespace bb {
@@ -23,16 +25,15 @@ void construct_lookup_table_polynomials(RefArray<typename Flavor::Polynomial, 4>
     ASSERT(dyadic_circuit_size > circuit.get_tables_size() + additional_offset);
     size_t offset = dyadic_circuit_size - circuit.get_tables_size() - additional_offset;
 
+    // The table columns are stored contiguously (and shared between circuits), so each one is a single block copy
     for (const auto& table : circuit.lookup_tables) {
         const fr table_index(table.table_index);
 
-        for (size_t i = 0; i < table.size; ++i) {
-            table_polynomials[0][offset] = table.column_1[i];
-            table_polynomials[1][offset] = table.column_2[i];
-            table_polynomials[2][offset] = table.column_3[i];
-            table_polynomials[3][offset] = table_index;
-            ++offset;
-        }
+        std::copy_n(table.column_1.begin(), table.size, &table_polynomials[0][offset]);
+        std::copy_n(table.column_2.begin(), table.size, &table_polynomials[1][offset]);
+        std::copy_n(table.column_3.begin(), table.size, &table_polynomials[2][offset]);
+        std::fill_n(&table_polynomials[3][offset], table.size, table_index);
+        offset += table.size;
     }
 }
 
@@ -66,47 +67,54 @@ std::array<typename Flavor::Polynomial, 4> construct_sorted_list_polynomials(typ
 
     for (auto& table : circuit.lookup_tables) {
         const fr table_index(table.table_index);
-        auto& lookup_gates = table.lookup_gates;
-        for (size_t i = 0; i < table.size; ++i) {
-            if (table.use_twin_keys) {
-                lookup_gates.push_back({
-                    {
-                        table.column_1[i].from_montgomery_form().data[0],
-                        table.column_2[i].from_montgomery_form().data[0],
-                    },
-                    {
-                        table.column_3[i],
-                        0,
-                    },
-                });
-            } else {
-                lookup_gates.push_back({
-                    {
-                        table.column_1[i].from_montgomery_form().data[0],
-                        0,
-                    },
-                    {
-                        table.column_2[i],
-                        table.column_3[i],
-                    },
-                });
-            }
-        }
+        const auto get_read_count = [&](const size_t row) -> size_t {
+            return table.lookup_read_counts.empty() ? 0 : table.lookup_read_counts[row];
+        };
 
+        if (!table.key_index || !table.unmatched_lookup_gates.empty()) {
+            // Gates that do not read a row of the table (or a table without a key index) have to be sorted in with the
+            // table entries by comparison
+            auto lookup_gates = table.unmatched_lookup_gates;
+            lookup_gates.reserve(table.size + table.num_lookup_gates);
+            for (size_t i = 0; i < table.size; ++i) {
+                lookup_gates.insert(lookup_gates.end(), 1 + get_read_count(i), table.get_row_entry(i));
+            }
 #ifdef NO_TBB
-        std::sort(lookup_gates.begin(), lookup_gates.end());
+            std::sort(lookup_gates.begin(), lookup_gates.end());
 #else
-        std::sort(std::execution::par_unseq, lookup_gates.begin(), lookup_gates.end());
+            std::sort(std::execution::par_unseq, lookup_gates.begin(), lookup_gates.end());
 #endif
+            for (const auto& entry : lookup_gates) {
+                const auto components = entry.to_sorted_list_components(table.use_twin_keys);
+                sorted_polynomials[0][s_index] = components[0];
+                sorted_polynomials[1][s_index] = components[1];
+                sorted_polynomials[2][s_index] = components[2];
+                sorted_polynomials[3][s_index] = table_index;
+                ++s_index;
+            }
+            continue;
+        }
 
-        for (const auto& entry : lookup_gates) {
-            const auto components = entry.to_sorted_list_components(table.use_twin_keys);
-            sorted_polynomials[0][s_index] = components[0];
-            sorted_polynomials[1][s_index] = components[1];
-            sorted_polynomials[2][s_index] = components[2];
-            sorted_polynomials[3][s_index] = table_index;
-            ++s_index;
+        // Otherwise the sorted list is every row of the table in the order of its keys, each followed by one copy per
+        // gate reading it. A prefix sum over the read counts gives the position of each row, which can then be written
+        // independently.
+        const auto& rows = table.key_index->rows;
+        std::vector<size_t> row_offsets(table.size + 1);
+        for (size_t i = 0; i < table.size; ++i) {
+            row_offsets[i + 1] = row_offsets[i] + 1 + get_read_count(rows[i]);
         }
+        run_loop_in_parallel(table.size, [&](size_t start, size_t end) {
+            for (size_t i = start; i < end; ++i) {
+                const size_t row = rows[i];
+                for (size_t idx = s_index + row_offsets[i]; idx < s_index + row_offsets[i + 1]; ++idx) {
+                    sorted_polynomials[0][idx] = table.column_1[row];
+                    sorted_polynomials[1][idx] = table.column_2[row];
+                    sorted_polynomials[2][idx] = table.column_3[row];
+                    sorted_polynomials[3][idx] = table_index;
+                }
+            }
+        });
+        s_index += row_offsets[table.size];
     }
     return sorted_polynomials;
 }
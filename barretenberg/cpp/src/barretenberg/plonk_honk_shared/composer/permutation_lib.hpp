@@ -9,6 +9,7 @@
 
 #include "barretenberg/common/ref_span.hpp"
 #include "barretenberg/common/ref_vector.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/ecc/curves/bn254/fr.hpp"
 #include "barretenberg/flavor/flavor.hpp"
 #include "barretenberg/plonk/proof_system/proving_key/proving_key.hpp"
@@ -27,32 +28,45 @@
 
 namespace bb {
 
-/**
- * @brief cycle_node represents the index of a value of the circuit.
- * It will belong to a CyclicPermutation, such that all nodes in a CyclicPermutation
- * must have the value.
- * The total number of constraints is always <2^32 since that is the type used to represent variables, so we can save
- * space by using a type smaller than size_t.
- */
-struct cycle_node {
-    uint32_t wire_index;
-    uint32_t gate_index;
-};
-
 /**
  * @brief Permutations subgroup element structure is used to hold data necessary to construct permutation polynomials.
  *
- * @details All parameters define the evaluation of an id or sigma polynomial.
+ * @details All parameters define the evaluation of an id or sigma polynomial. They are packed into 32 bits, as there is
+ * one element per wire per row of the circuit: the row index takes the low 28 bits, followed by two bits of column
+ * index and the public input and tag flags.
  *
  */
 struct permutation_subgroup_element {
-    uint32_t row_index = 0;
-    uint8_t column_index = 0;
-    bool is_public_input = false;
-    bool is_tag = false;
+    static constexpr uint32_t ROW_BITS = 28;
+    static constexpr uint32_t MAX_NUM_ROWS = 1U << ROW_BITS;
+    static constexpr uint32_t MAX_NUM_COLUMNS = 4;
+    static constexpr uint32_t PUBLIC_INPUT_FLAG = 1U << 30;
+    static constexpr uint32_t TAG_FLAG = 1U << 31;
+
+    uint32_t data = 0;
+
+    constexpr permutation_subgroup_element() = default;
+    constexpr permutation_subgroup_element(uint32_t row_index,
+                                           uint32_t column_index,
+                                           bool is_public_input = false,
+                                           bool is_tag = false)
+        : data(row_index | (column_index << ROW_BITS) | (is_public_input ? PUBLIC_INPUT_FLAG : 0) |
+               (is_tag ? TAG_FLAG : 0))
+    {
+        ASSERT(row_index < MAX_NUM_ROWS && column_index < MAX_NUM_COLUMNS);
+    }
+
+    constexpr uint32_t row_index() const { return data & (MAX_NUM_ROWS - 1); }
+    constexpr uint32_t column_index() const { return (data >> ROW_BITS) & (MAX_NUM_COLUMNS - 1); }
+    constexpr bool is_public_input() const { return (data & PUBLIC_INPUT_FLAG) != 0; }
+    constexpr bool is_tag() const { return (data & TAG_FLAG) != 0; }
+
+    bool operator==(const permutation_subgroup_element& other) const = default;
 };
 
 template <size_t NUM_WIRES, bool generalized> struct PermutationMapping {
+    static_assert(NUM_WIRES <= permutation_subgroup_element::MAX_NUM_COLUMNS);
+
     using Mapping = std::array<std::vector<permutation_subgroup_element>, NUM_WIRES>;
     Mapping sigmas;
     Mapping ids;
@@ -63,24 +77,109 @@ template <size_t NUM_WIRES, bool generalized> struct PermutationMapping {
      */
     PermutationMapping(size_t circuit_size)
     {
-        for (uint8_t col_idx = 0; col_idx < NUM_WIRES; ++col_idx) {
-            sigmas[col_idx].reserve(circuit_size);
+        ASSERT(circuit_size <= permutation_subgroup_element::MAX_NUM_ROWS);
+        for (size_t col_idx = 0; col_idx < NUM_WIRES; ++col_idx) {
+            sigmas[col_idx].resize(circuit_size);
             if constexpr (generalized) {
-                ids[col_idx].reserve(circuit_size);
+                ids[col_idx].resize(circuit_size);
             }
-            // Initialize every element to point to itself
-            for (uint32_t row_idx = 0; row_idx < circuit_size; ++row_idx) {
-                permutation_subgroup_element self{ row_idx, col_idx };
-                sigmas[col_idx].emplace_back(self);
-                if constexpr (generalized) {
-                    ids[col_idx].emplace_back(self);
+        }
+        // Initialize every element to point to itself
+        run_loop_in_parallel(circuit_size, [&](size_t start, size_t end) {
+            for (uint32_t col_idx = 0; col_idx < NUM_WIRES; ++col_idx) {
+                for (auto row_idx = static_cast<uint32_t>(start); row_idx < end; ++row_idx) {
+                    const permutation_subgroup_element self{ row_idx, col_idx };
+                    sigmas[col_idx][row_idx] = self;
+                    if constexpr (generalized) {
+                        ids[col_idx][row_idx] = self;
+                    }
                 }
             }
-        }
+        });
     }
 };
 
-using CyclicPermutation = std::vector<cycle_node>;
+/**
+ * @brief The copy cycles of a circuit: for every real variable, the positions in the execution trace of the wires that
+ * hold it
+ *
+ * @details Each node is a (variable, position) pair packed into 64 bits, with the variable in the high half and the
+ * position row << 2 | column in the low half. The nodes are sorted, so the cycle of variable i is nodes[offsets[i]],
+ * ..., nodes[offsets[i + 1] - 1] in the order in which the positions appear in the trace (row by row, then column by
+ * column). Sorting a flat array scales much better than growing one vector per variable.
+ */
+struct CopyCycles {
+    static constexpr uint32_t COLUMN_BITS = 2;
+
+    std::vector<uint64_t> nodes;
+    std::vector<uint32_t> offsets;
+
+    CopyCycles() = default;
+
+    /**
+     * @brief Sort the nodes of the trace (in any order) into cycles
+     *
+     * @param unsorted_nodes One node per wire of every row of the trace, as constructed by `make_node`
+     * @param num_variables The number of (real or not) variables of the circuit
+     * @param max_num_chunks The maximum number of chunks sorted in parallel
+     */
+    CopyCycles(std::vector<uint64_t> unsorted_nodes,
+               size_t num_variables,
+               size_t max_num_chunks = get_num_cpus_pow2())
+        : nodes(std::move(unsorted_nodes))
+        , offsets(num_variables + 1)
+    {
+        ASSERT(nodes.size() < (1ULL << 32));
+        // Sort chunks of the nodes in parallel, then merge neighbouring chunks until a single one remains
+        const size_t num_chunks = std::max(std::min(max_num_chunks, nodes.size()), size_t(1));
+        std::vector<size_t> bounds(num_chunks + 1);
+        for (size_t i = 0; i <= num_chunks; ++i) {
+            bounds[i] = nodes.size() * i / num_chunks;
+        }
+        parallel_for(num_chunks, [&](size_t i) {
+            std::sort(nodes.begin() + static_cast<std::ptrdiff_t>(bounds[i]),
+                      nodes.begin() + static_cast<std::ptrdiff_t>(bounds[i + 1]));
+        });
+        // Each level merges pairs of runs of width chunks. The number of chunks need not be a power of 2, so the last
+        // pair of a level may be short, or a single run with nothing to merge it with.
+        for (size_t width = 1; width < num_chunks; width *= 2) {
+            const size_t num_merges = (num_chunks + 2 * width - 1) / (2 * width);
+            parallel_for(num_merges, [&](size_t i) {
+                const size_t middle = std::min((2 * i + 1) * width, num_chunks);
+                const size_t end = std::min((2 * i + 2) * width, num_chunks);
+                std::inplace_merge(nodes.begin() + static_cast<std::ptrdiff_t>(bounds[2 * i * width]),
+                                   nodes.begin() + static_cast<std::ptrdiff_t>(bounds[middle]),
+                                   nodes.begin() + static_cast<std::ptrdiff_t>(bounds[end]));
+            });
+        }
+
+        // Cycle i starts at the first node whose variable is at least i. Each offset is written by exactly one node (or
+        // by the tail below), the one at which the variable first exceeds i - 1.
+        const size_t num_nodes = nodes.size();
+        run_loop_in_parallel(num_nodes, [&](size_t start, size_t end) {
+            for (size_t i = start; i < end; ++i) {
+                const size_t first_variable = i == 0 ? 0 : get_variable(nodes[i - 1]) + 1;
+                for (size_t variable = first_variable; variable <= get_variable(nodes[i]); ++variable) {
+                    offsets[variable] = static_cast<uint32_t>(i);
+                }
+            }
+        });
+        const size_t first_empty_variable = num_nodes == 0 ? 0 : get_variable(nodes.back()) + 1;
+        std::fill(offsets.begin() + static_cast<std::ptrdiff_t>(first_empty_variable),
+                  offsets.end(),
+                  static_cast<uint32_t>(num_nodes));
+    }
+
+    static uint64_t make_node(uint32_t variable, uint32_t row, uint32_t column)
+    {
+        return (static_cast<uint64_t>(variable) << 32) | (row << COLUMN_BITS) | column;
+    }
+    static uint32_t get_variable(uint64_t node) { return static_cast<uint32_t>(node >> 32); }
+    static uint32_t get_row(uint64_t node) { return static_cast<uint32_t>(node) >> COLUMN_BITS; }
+    static uint32_t get_column(uint64_t node) { return static_cast<uint32_t>(node) & ((1U << COLUMN_BITS) - 1); }
+
+    size_t num_cycles() const { return offsets.empty() ? 0 : offsets.size() - 1; }
+};
 
 namespace {
 /**
@@ -99,53 +198,53 @@ template <typename Flavor, bool generalized>
 PermutationMapping<Flavor::NUM_WIRES, generalized> compute_permutation_mapping(
     const typename Flavor::CircuitBuilder& circuit_constructor,
     typename Flavor::ProvingKey* proving_key,
-    std::vector<CyclicPermutation> wire_copy_cycles)
+    const CopyCycles& wire_copy_cycles)
 {
 
     // Initialize the table of permutations so that every element points to itself
     PermutationMapping<Flavor::NUM_WIRES, generalized> mapping{ proving_key->circuit_size };
 
     // Represents the index of a variable in circuit_constructor.variables (needed only for generalized)
-    std::span<const uint32_t> real_variable_tags = circuit_constructor.real_variable_tags;
-
-    // Go through each cycle
-    size_t cycle_index = 0;
-    for (auto& copy_cycle : wire_copy_cycles) {
-        for (size_t node_idx = 0; node_idx < copy_cycle.size(); ++node_idx) {
-            // Get the indices of the current node and next node in the cycle
-            cycle_node current_cycle_node = copy_cycle[node_idx];
-            // If current node is the last one in the cycle, then the next one is the first one
-            size_t next_cycle_node_index = (node_idx == copy_cycle.size() - 1 ? 0 : node_idx + 1);
-            cycle_node next_cycle_node = copy_cycle[next_cycle_node_index];
-            const auto current_row = current_cycle_node.gate_index;
-            const auto next_row = next_cycle_node.gate_index;
-
-            const auto current_column = current_cycle_node.wire_index;
-            const auto next_column = static_cast<uint8_t>(next_cycle_node.wire_index);
-            // Point current node to the next node
-            mapping.sigmas[current_column][current_row] = {
-                .row_index = next_row, .column_index = next_column, .is_public_input = false, .is_tag = false
-            };
-
-            if constexpr (generalized) {
-                bool first_node = (node_idx == 0);
-                bool last_node = (next_cycle_node_index == 0);
+    const auto& real_variable_tags = circuit_constructor.real_variable_tags;
+
+    // Go through each cycle. The cycles are disjoint, so they can be processed in parallel.
+    run_loop_in_parallel(wire_copy_cycles.num_cycles(), [&](size_t start, size_t end) {
+        for (size_t cycle_index = start; cycle_index < end; ++cycle_index) {
+            const size_t cycle_start = wire_copy_cycles.offsets[cycle_index];
+            const size_t cycle_end = wire_copy_cycles.offsets[cycle_index + 1];
+            for (size_t node_idx = cycle_start; node_idx < cycle_end; ++node_idx) {
+                // Get the indices of the current node and next node in the cycle
+                const uint64_t current_cycle_node = wire_copy_cycles.nodes[node_idx];
+                // If current node is the last one in the cycle, then the next one is the first one
+                const bool first_node = (node_idx == cycle_start);
+                const bool last_node = (node_idx == cycle_end - 1);
+                const uint64_t next_cycle_node = wire_copy_cycles.nodes[last_node ? cycle_start : node_idx + 1];
+                const uint32_t current_row = CopyCycles::get_row(current_cycle_node);
+                const uint32_t current_column = CopyCycles::get_column(current_cycle_node);
+
+                // Point current node to the next node
+                mapping.sigmas[current_column][current_row] = { CopyCycles::get_row(next_cycle_node),
+                                                                 CopyCycles::get_column(next_cycle_node) };
 
-                if (first_node) {
-                    mapping.ids[current_column][current_row].is_tag = true;
-                    mapping.ids[current_column][current_row].row_index = (real_variable_tags[cycle_index]);
-                }
-                if (last_node) {
-                    mapping.sigmas[current_column][current_row].is_tag = true;
-
-                    // TODO(Zac): yikes, std::maps (tau) are expensive. Can we find a way to get rid of this?
-                    mapping.sigmas[current_column][current_row].row_index =
-                        circuit_constructor.tau.at(real_variable_tags[cycle_index]);
+                if constexpr (generalized) {
+                    if (first_node) {
+                        mapping.ids[current_column][current_row] = {
+                            real_variable_tags[cycle_index], current_column, false, /*is_tag=*/true
+                        };
+                    }
+                    if (last_node) {
+                        // TODO(Zac): yikes, std::maps (tau) are expensive. Can we find a way to get rid of this?
+                        mapping.sigmas[current_column][current_row] = {
+                            circuit_constructor.tau.at(real_variable_tags[cycle_index]),
+                            CopyCycles::get_column(next_cycle_node),
+                            false,
+                            /*is_tag=*/true
+                        };
+                    }
                 }
             }
         }
-        cycle_index++;
-    }
+    });
 
     // Add information about public inputs so that the cycles can be altered later; See the construction of the
     // permutation polynomials for details.
@@ -157,10 +256,9 @@ PermutationMapping<Flavor::NUM_WIRES, generalized> compute_permutation_mapping(
     }
     for (size_t i = 0; i < num_public_inputs; ++i) {
         size_t idx = i + pub_inputs_offset;
-        mapping.sigmas[0][idx].row_index = static_cast<uint32_t>(idx);
-        mapping.sigmas[0][idx].column_index = 0;
-        mapping.sigmas[0][idx].is_public_input = true;
-        if (mapping.sigmas[0][idx].is_tag) {
+        const bool is_tag = mapping.sigmas[0][idx].is_tag();
+        mapping.sigmas[0][idx] = { static_cast<uint32_t>(idx), 0, /*is_public_input=*/true, is_tag };
+        if (is_tag) {
             std::cerr << "MAPPING IS BOTH A TAG AND A PUBLIC INPUT" << std::endl;
         }
     }
@@ -189,24 +287,26 @@ void compute_honk_style_permutation_lagrange_polynomials_from_mapping(
     size_t wire_index = 0;
     for (auto& current_permutation_poly : permutation_polynomials) {
         ITERATE_OVER_DOMAIN_START(proving_key->evaluation_domain);
-        const auto& current_mapping = permutation_mappings[wire_index][i];
-        if (current_mapping.is_public_input) {
+        const auto current_mapping = permutation_mappings[wire_index][i];
+        if (current_mapping.is_public_input()) {
             // We intentionally want to break the cycles of the public input variables.
             // During the witness generation, the left and right wire polynomials at index i contain the i-th public
-            // input. The CyclicPermutation created for these variables always start with (i) -> (n+i), followed by
+            // input. The copy cycle of these variables always start with (i) -> (n+i), followed by
             // the indices of the variables in the "real" gates. We make i point to -(i+1), so that the only way of
             // repairing the cycle is add the mapping
             //  -(i+1) -> (n+i)
             // These indices are chosen so they can easily be computed by the verifier. They can expect the running
             // product to be equal to the "public input delta" that is computed in <honk/utils/grand_product_delta.hpp>
-            current_permutation_poly[i] = -FF(current_mapping.row_index + 1 + num_gates * current_mapping.column_index);
-        } else if (current_mapping.is_tag) {
+            current_permutation_poly[i] =
+                -FF(current_mapping.row_index() + 1 + num_gates * current_mapping.column_index());
+        } else if (current_mapping.is_tag()) {
             // Set evaluations to (arbitrary) values disjoint from non-tag values
-            current_permutation_poly[i] = num_gates * Flavor::NUM_WIRES + current_mapping.row_index;
+            current_permutation_poly[i] = num_gates * Flavor::NUM_WIRES + current_mapping.row_index();
         } else {
             // For the regular permutation we simply point to the next location by setting the evaluation to its
             // index
-            current_permutation_poly[i] = FF(current_mapping.row_index + num_gates * current_mapping.column_index);
+            current_permutation_poly[i] =
+                FF(current_mapping.row_index() + num_gates * current_mapping.column_index());
         }
         ITERATE_OVER_DOMAIN_END;
         wire_index++;
@@ -248,7 +348,7 @@ inline void compute_standard_plonk_lagrange_polynomial(bb::polynomial& output,
     // We first have to accommodate for the fact that `roots` only contains *half* of our subgroup elements. This is
     // because ω^{n/2} = -ω and we don't want to perform redundant work computing roots of unity.
 
-    size_t raw_idx = permutation[i].row_index;
+    size_t raw_idx = permutation[i].row_index();
 
     // Step 1: is `raw_idx` >= (n / 2)? if so, we will need to index `-roots[raw_idx - subgroup_size / 2]` instead
     // of `roots[raw_idx]`
@@ -271,16 +371,16 @@ inline void compute_standard_plonk_lagrange_polynomial(bb::polynomial& output,
     // wires gives unique values that are not repeated in the right or output wire permutations) (ditto for right
     // wire and output wire mappings)
 
-    if (permutation[i].is_public_input) {
+    if (permutation[i].is_public_input()) {
         // As per the paper which modifies plonk to include the public inputs in a permutation argument, the permutation
         // `σ` is modified to `σ'`, where `σ'` maps all public inputs to a set of l distinct ζ elements which are
         // disjoint from H ∪ k1·H ∪ k2·H.
         output[i] *= bb::fr::external_coset_generator();
-    } else if (permutation[i].is_tag) {
+    } else if (permutation[i].is_tag()) {
         output[i] *= bb::fr::tag_coset_generator();
     } else {
         {
-            const uint32_t column_index = permutation[i].column_index;
+            const uint32_t column_index = permutation[i].column_index();
             if (column_index > 0) {
                 output[i] *= bb::fr::coset_generator(column_index - 1);
             }
@@ -368,7 +468,7 @@ inline std::tuple<Polynomial<FF>, Polynomial<FF>> compute_first_and_last_lagrang
 template <typename Flavor>
 void compute_permutation_argument_polynomials(const typename Flavor::CircuitBuilder& circuit,
                                               typename Flavor::ProvingKey* key,
-                                              std::vector<CyclicPermutation> copy_cycles)
+                                              const CopyCycles& copy_cycles)
 {
     constexpr bool generalized = IsUltraPlonkFlavor<Flavor> || IsUltraFlavor<Flavor>;
     auto mapping = compute_permutation_mapping<Flavor, generalized>(circuit, key, copy_cycles);
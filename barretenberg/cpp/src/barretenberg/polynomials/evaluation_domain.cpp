@@ -8,6 +8,8 @@
 #include "barretenberg/plonk_honk_shared/types/circuit_type.hpp"
 #include <memory.h>
 #include <memory>
+#include <mutex>
+#include <unordered_map>
 
 namespace bb {
 
@@ -24,6 +26,17 @@ size_t compute_num_threads(const size_t size)
     return num_threads;
 }
 
+template <typename Fr> void set_round_roots(Fr* const roots, const size_t size, std::vector<Fr*>& round_roots)
+{
+    const size_t num_rounds = static_cast<size_t>(numeric::get_msb(size));
+
+    round_roots.clear();
+    round_roots.emplace_back(&roots[0]);
+    for (size_t i = 1; i < num_rounds - 1; ++i) {
+        round_roots.emplace_back(round_roots.back() + (1UL << i));
+    }
+}
+
 template <typename Fr>
 void compute_lookup_table_single(const Fr& input_root,
                                  const size_t size,
@@ -32,10 +45,7 @@ void compute_lookup_table_single(const Fr& input_root,
 {
     const size_t num_rounds = static_cast<size_t>(numeric::get_msb(size));
 
-    round_roots.emplace_back(&roots[0]);
-    for (size_t i = 1; i < num_rounds - 1; ++i) {
-        round_roots.emplace_back(round_roots.back() + (1UL << i));
-    }
+    set_round_roots(roots, size, round_roots);
 
     for (size_t i = 0; i < num_rounds - 1; ++i) {
         const size_t m = 1UL << (i + 1);
@@ -47,6 +57,35 @@ void compute_lookup_table_single(const Fr& input_root,
         }
     }
 }
+
+/**
+ * @brief Get the table of the roots of unity used by the FFT rounds of a domain, followed by that of their inverses
+ *
+ * @details The tables only depend on the domain size, so every domain of the same size (e.g. the small and large
+ * domains of each proving key) shares one copy for as long as any of them is alive, rather than each computing and
+ * holding its own.
+ */
+template <typename Fr> std::shared_ptr<Fr[]> get_root_table(const size_t size, const Fr& root, const Fr& root_inverse)
+{
+    struct CachedRootTable {
+        Fr root;
+        std::weak_ptr<Fr[]> table;
+    };
+    static std::mutex mutex;
+    static std::unordered_map<size_t, CachedRootTable> cache;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto& cached = cache[size];
+    if (auto table = cached.table.lock(); table != nullptr && cached.root == root) {
+        return table;
+    }
+    auto table = std::static_pointer_cast<Fr[]>(get_mem_slab(sizeof(Fr) * size * 2));
+    std::vector<Fr*> round_roots;
+    compute_lookup_table_single(root, size, table.get(), round_roots);
+    compute_lookup_table_single(root_inverse, size, &table.get()[size], round_roots);
+    cached = { root, table };
+    return table;
+}
 } // namespace
 
 template <typename Fr>
@@ -100,17 +139,10 @@ EvaluationDomain<Fr>::EvaluationDomain(const EvaluationDomain& other)
     ASSERT((1UL << log2_thread_size) == thread_size);
     ASSERT((1UL << log2_num_threads) == num_threads);
     if (other.roots != nullptr) {
-        const size_t mem_size = sizeof(Fr) * size * 2;
-        roots = std::static_pointer_cast<Fr[]>(get_mem_slab(mem_size));
-        memcpy(static_cast<void*>(roots.get()), static_cast<void*>(other.roots.get()), mem_size);
-        round_roots.resize(log2_size - 1);
-        inverse_round_roots.resize(log2_size - 1);
-        round_roots[0] = &roots[0];
-        inverse_round_roots[0] = &roots.get()[size];
-        for (size_t i = 1; i < log2_size - 1; ++i) {
-            round_roots[i] = round_roots[i - 1] + (1UL << i);
-            inverse_round_roots[i] = inverse_round_roots[i - 1] + (1UL << i);
-        }
+        // The root tables are never modified, so the copy shares them
+        roots = other.roots;
+        set_round_roots(roots.get(), size, round_roots);
+        set_round_roots(&roots.get()[size], size, inverse_round_roots);
     } else {
         roots = nullptr;
     }
@@ -170,10 +202,9 @@ template <typename Fr> EvaluationDomain<Fr>::~EvaluationDomain() {}
 template <typename Fr> void EvaluationDomain<Fr>::compute_lookup_table()
 {
     ASSERT(roots == nullptr);
-    // roots = (Fr*)(aligned_alloc(32, sizeof(Fr) * size * 2));
-    roots = std::static_pointer_cast<Fr[]>(get_mem_slab(sizeof(Fr) * size * 2));
-    compute_lookup_table_single(root, size, roots.get(), round_roots);
-    compute_lookup_table_single(root_inverse, size, &roots.get()[size], inverse_round_roots);
+    roots = get_root_table(size, root, root_inverse);
+    set_round_roots(roots.get(), size, round_roots);
+    set_round_roots(&roots.get()[size], size, inverse_round_roots);
 }
 
 // explicitly instantiate both EvaluationDomain
@@ -63,6 +63,7 @@ template <typename FF> class EvaluationDomain {
                                   //      ...
     std::vector<FF*> inverse_round_roots;
 
+    // Shared by all domains of the same size, and never modified
     std::shared_ptr<FF[]> roots;
 };
 
@@ -168,229 +168,254 @@ void compute_multiplicative_subgroup(const size_t log2_subgroup_size,
     }
 }
 
-template <typename Fr>
-    requires SupportsFFT<Fr>
-void fft_inner_parallel(std::vector<Fr*> coeffs,
-                        const EvaluationDomain<Fr>& domain,
-                        const Fr&,
-                        const std::vector<Fr*>& root_table)
-{
-    auto scratch_space_ptr = get_scratch_space<Fr>(domain.size);
-    auto scratch_space = scratch_space_ptr.get();
+namespace {
 
-    const size_t num_polys = coeffs.size();
-    ASSERT(is_power_of_two(num_polys));
-    const size_t poly_size = domain.size / num_polys;
-    ASSERT(is_power_of_two(poly_size));
-    const size_t poly_mask = poly_size - 1;
-    const size_t log2_poly_size = (size_t)numeric::get_msb(poly_size);
+// The rounds of an FFT that only combine elements within an aligned block of this many elements are done block by
+// block, while the block is in cache (2^12 elements of 32 bytes fill 128KiB, which fits in L2)
+constexpr size_t FFT_BLOCK_SIZE = 1UL << 12;
 
-    parallel_for(domain.num_threads, [&](size_t j) {
-        Fr temp_1;
-        Fr temp_2;
-        for (size_t i = (j * domain.thread_size); i < ((j + 1) * domain.thread_size); i += 2) {
-            uint32_t next_index_1 = (uint32_t)reverse_bits((uint32_t)i + 2, (uint32_t)domain.log2_size);
-            uint32_t next_index_2 = (uint32_t)reverse_bits((uint32_t)i + 3, (uint32_t)domain.log2_size);
-            __builtin_prefetch(&coeffs[next_index_1]);
-            __builtin_prefetch(&coeffs[next_index_2]);
-
-            uint32_t swap_index_1 = (uint32_t)reverse_bits((uint32_t)i, (uint32_t)domain.log2_size);
-            uint32_t swap_index_2 = (uint32_t)reverse_bits((uint32_t)i + 1, (uint32_t)domain.log2_size);
-
-            size_t poly_idx_1 = swap_index_1 >> log2_poly_size;
-            size_t elem_idx_1 = swap_index_1 & poly_mask;
-            size_t poly_idx_2 = swap_index_2 >> log2_poly_size;
-            size_t elem_idx_2 = swap_index_2 & poly_mask;
-
-            Fr::__copy(coeffs[poly_idx_1][elem_idx_1], temp_1);
-            Fr::__copy(coeffs[poly_idx_2][elem_idx_2], temp_2);
-            scratch_space[i + 1] = temp_1 - temp_2;
-            scratch_space[i] = temp_1 + temp_2;
-        }
-    });
+/**
+ * @brief Load the elements at the bit-reversed positions of [start, end) and apply the first round of the FFT, in which
+ * all the roots are 1
+ */
+template <typename Fr, typename Load, typename Emit>
+inline void fft_first_round(
+    const size_t start, const size_t end, const size_t log2_size, const Load& load, const Emit& emit)
+{
+    Fr temp_1;
+    Fr temp_2;
+    for (size_t i = start; i < end; i += 2) {
+        uint32_t next_index_1 = (uint32_t)reverse_bits((uint32_t)i + 2, (uint32_t)log2_size);
+        uint32_t next_index_2 = (uint32_t)reverse_bits((uint32_t)i + 3, (uint32_t)log2_size);
+        __builtin_prefetch(&load(next_index_1));
+        __builtin_prefetch(&load(next_index_2));
+
+        uint32_t swap_index_1 = (uint32_t)reverse_bits((uint32_t)i, (uint32_t)log2_size);
+        uint32_t swap_index_2 = (uint32_t)reverse_bits((uint32_t)i + 1, (uint32_t)log2_size);
+
+        Fr::__copy(load(swap_index_1), temp_1);
+        Fr::__copy(load(swap_index_2), temp_2);
+        emit(i + 1, temp_1 - temp_2);
+        emit(i, temp_1 + temp_2);
+    }
+}
 
-    // hard code exception for when the domain size is tiny - we won't execute the next loop, so need to manually
-    // reduce + copy
-    if (domain.size <= 2) {
-        coeffs[0][0] = scratch_space[0];
-        coeffs[0][1] = scratch_space[1];
+/**
+ * @brief Apply the butterflies [start, end) of the FFT round combining elements at distance m, to the elements of
+ * `work` from `base` onwards
+ *
+ * @details As in the original flattened loop, butterfly i combines the elements at k + j and k + j + m, where j = i
+ * mod m is also the index into the round's roots, and k = 2(i - j).
+ */
+template <typename Fr, typename Emit>
+inline void fft_radix_2_round(Fr* work,
+                              const size_t base,
+                              const size_t start,
+                              const size_t end,
+                              const size_t m,
+                              const Fr* round_roots,
+                              const Emit& emit)
+{
+    const size_t block_mask = m - 1;
+    const size_t index_mask = ~block_mask;
+    Fr temp;
+    for (size_t i = start; i < end; ++i) {
+        const size_t k1 = base + ((i & index_mask) << 1);
+        const size_t j1 = i & block_mask;
+        temp = round_roots[j1] * work[k1 + j1 + m];
+        emit(k1 + j1 + m, work[k1 + j1] - temp);
+        emit(k1 + j1, work[k1 + j1] + temp);
     }
+}
 
-    // outer FFT loop
-    for (size_t m = 2; m < (domain.size); m <<= 1) {
-        parallel_for(domain.num_threads, [&](size_t j) {
-            Fr temp;
-
-            // Ok! So, what's going on here? This is the inner loop of the FFT algorithm, and we want to break it
-            // out into multiple independent threads. For `num_threads`, each thread will evaluation `domain.size /
-            // num_threads` of the polynomial. The actual iteration length will be half of this, because we leverage
-            // the fact that \omega^{n/2} = -\omega (where \omega is a root of unity)
-
-            // Here, `start` and `end` are used as our iterator limits, so that we can use our iterator `i` to
-            // directly access the roots of unity lookup table
-            const size_t start = j * (domain.thread_size >> 1);
-            const size_t end = (j + 1) * (domain.thread_size >> 1);
-
-            // For all but the last round of our FFT, the roots of unity that we need, will be a subset of our
-            // lookup table. e.g. for a size 2^n FFT, the 2^n'th roots create a multiplicative subgroup of order 2^n
-            //      the 1st round will use the roots from the multiplicative subgroup of order 2 : the 2'th roots of
-            //      unity the 2nd round will use the roots from the multiplicative subgroup of order 4 : the 4'th
-            //      roots of unity
-            // i.e. each successive FFT round will double the set of roots that we need to index.
-            // We have already laid out the `root_table` container so that each FFT round's roots are linearly
-            // ordered in memory. For all FFT rounds, the number of elements we're iterating over is greater than
-            // the size of our lookup table. We need to access this table in a cyclical fasion - i.e. for a subgroup
-            // of size x, the first x iterations will index the subgroup elements in order, then for the next x
-            // iterations, we loop back to the start.
-
-            // We could implement the algorithm by having 2 nested loops (where the inner loop iterates over the
-            // root table), but we want to flatten this out - as for the first few rounds, the inner loop will be
-            // tiny and we'll have quite a bit of unneccesary branch checks For each iteration of our flattened
-            // loop, indexed by `i`, the element of the root table we need to access will be `i % (current round
-            // subgroup size)` Given that each round subgroup size is `m`, which is a power of 2, we can index the
-            // root table with a very cheap `i & (m - 1)` Which is why we have this odd `block_mask` variable
-            const size_t block_mask = m - 1;
-
-            // The next problem to tackle, is we now need to efficiently index the polynomial element in
-            // `scratch_space` in our flattened loop If we used nested loops, the outer loop (e.g. `y`) iterates
-            // from 0 to 'domain size', in steps of 2 * m, with the inner loop (e.g. `z`) iterating from 0 to m. We
-            // have our inner loop indexer with `i & (m - 1)`. We need to add to this our outer loop indexer, which
-            // is equivalent to taking our indexer `i`, masking out the bits used in the 'inner loop', and doubling
-            // the result. i.e. polynomial indexer = (i & (m - 1)) + ((i & ~(m - 1)) >> 1) To simplify this, we
-            // cache index_mask = ~block_mask, meaning that our indexer is just `((i & index_mask) << 1 + (i &
-            // block_mask)`
-            const size_t index_mask = ~block_mask;
-
-            // `round_roots` fetches the pointer to this round's lookup table. We use `numeric::get_msb(m) - 1` as
-            // our indexer, because we don't store the precomputed root values for the 1st round (because they're
-            // all 1).
-            const Fr* round_roots = root_table[static_cast<size_t>(numeric::get_msb(m)) - 1];
-
-            // Finally, we want to treat the final round differently from the others,
-            // so that we can reduce out of our 'coarse' reduction and store the output in `coeffs` instead of
-            // `scratch_space`
-            if (m != (domain.size >> 1)) {
-                for (size_t i = start; i < end; ++i) {
-                    size_t k1 = (i & index_mask) << 1;
-                    size_t j1 = i & block_mask;
-                    temp = round_roots[j1] * scratch_space[k1 + j1 + m];
-                    scratch_space[k1 + j1 + m] = scratch_space[k1 + j1] - temp;
-                    scratch_space[k1 + j1] += temp;
-                }
+/**
+ * @brief Apply the FFT rounds combining elements at distance m and 2m in a single pass, as radix-4 butterflies
+ *
+ * @details Butterfly i reads the four elements at k + j + {0, m, 2m, 3m}, where j = i mod m and k = 4(i - j), applies
+ * the two radix-2 butterflies of round m and then the two of round 2m, and writes them back. This halves the number
+ * of passes over memory, which is what limits the large FFTs, for the same number of multiplications.
+ */
+template <typename Fr, typename Emit>
+inline void fft_radix_4_round(Fr* work,
+                              const size_t base,
+                              const size_t start,
+                              const size_t end,
+                              const size_t m,
+                              const Fr* round_roots,
+                              const Fr* next_round_roots,
+                              const Emit& emit)
+{
+    const size_t block_mask = m - 1;
+    const size_t index_mask = ~block_mask;
+    for (size_t i = start; i < end; ++i) {
+        const size_t j1 = i & block_mask;
+        const size_t idx = base + ((i & index_mask) << 2) + j1;
+
+        Fr temp = round_roots[j1] * work[idx + m];
+        const Fr b = work[idx] - temp;
+        const Fr a = work[idx] + temp;
+        temp = round_roots[j1] * work[idx + 3 * m];
+        const Fr d = work[idx + 2 * m] - temp;
+        const Fr c = work[idx + 2 * m] + temp;
+
+        temp = next_round_roots[j1] * c;
+        emit(idx + 2 * m, a - temp);
+        emit(idx, a + temp);
+        temp = next_round_roots[j1 + m] * d;
+        emit(idx + 3 * m, b - temp);
+        emit(idx + m, b + temp);
+    }
+}
+
+/**
+ * @brief Apply the FFT rounds m, 2m, ... up to (excluding) m_end to the radix-2 butterflies [start, end), two rounds
+ * per pass where possible. The final round of the FFT (m = final_m) is written through `emit_final`.
+ */
+template <typename Fr, typename Emit>
+void fft_rounds(Fr* work,
+                const size_t base,
+                const size_t start,
+                const size_t end,
+                size_t m,
+                const size_t m_end,
+                const size_t final_m,
+                const std::vector<Fr*>& root_table,
+                const Emit& emit_final)
+{
+    const auto write_back = [work](const size_t idx, const Fr& value) { Fr::__copy(value, work[idx]); };
+    while (m < m_end) {
+        const size_t round = static_cast<size_t>(numeric::get_msb(m));
+        if (2 * m < m_end) {
+            const Fr* round_roots = root_table[round - 1];
+            const Fr* next_round_roots = root_table[round];
+            if (2 * m == final_m) {
+                fft_radix_4_round(work, base, start >> 1, end >> 1, m, round_roots, next_round_roots, emit_final);
             } else {
-                for (size_t i = start; i < end; ++i) {
-                    size_t k1 = (i & index_mask) << 1;
-                    size_t j1 = i & block_mask;
-
-                    size_t poly_idx_1 = (k1 + j1) >> log2_poly_size;
-                    size_t elem_idx_1 = (k1 + j1) & poly_mask;
-                    size_t poly_idx_2 = (k1 + j1 + m) >> log2_poly_size;
-                    size_t elem_idx_2 = (k1 + j1 + m) & poly_mask;
-
-                    temp = round_roots[j1] * scratch_space[k1 + j1 + m];
-                    coeffs[poly_idx_2][elem_idx_2] = scratch_space[k1 + j1] - temp;
-                    coeffs[poly_idx_1][elem_idx_1] = scratch_space[k1 + j1] + temp;
-                }
+                fft_radix_4_round(work, base, start >> 1, end >> 1, m, round_roots, next_round_roots, write_back);
             }
-        });
+            m <<= 2;
+        } else {
+            if (m == final_m) {
+                fft_radix_2_round(work, base, start, end, m, root_table[round - 1], emit_final);
+            } else {
+                fft_radix_2_round(work, base, start, end, m, root_table[round - 1], write_back);
+            }
+            m <<= 1;
+        }
     }
 }
 
-template <typename Fr>
-    requires SupportsFFT<Fr>
-void fft_inner_parallel(
-    Fr* coeffs, Fr* target, const EvaluationDomain<Fr>& domain, const Fr&, const std::vector<Fr*>& root_table)
+/**
+ * @brief Compute the FFT of the elements given by `load` (in natural order), using `work` (of the domain size) as
+ * working memory, and write the result through `emit_final`
+ *
+ * @details Each thread owns a contiguous chunk of `work`. The bit-reversal permutation is fused with the first round,
+ * and every round that only combines elements of the same chunk is done by the owning thread without synchronisation:
+ * the rounds within a block of FFT_BLOCK_SIZE elements block by block while it is in cache, then the remaining
+ * rounds within the chunk. Only the last log2(num_threads) rounds need a pass over the whole domain each, and those
+ * are paired into radix-4 passes. `emit_final` is only called once every element has been loaded, so it may write to
+ * the memory `load` reads.
+ */
+template <typename Fr, typename Load, typename Emit>
+void fft_inner_blocked(Fr* work,
+                       const EvaluationDomain<Fr>& domain,
+                       const std::vector<Fr*>& root_table,
+                       const Load& load,
+                       const Emit& emit_final)
 {
+    const size_t final_m = domain.size >> 1;
+    const size_t thread_size = domain.thread_size;
+    const size_t block_size = std::min(FFT_BLOCK_SIZE, thread_size);
+    const auto write_back = [work](const size_t idx, const Fr& value) { Fr::__copy(value, work[idx]); };
+
     parallel_for(domain.num_threads, [&](size_t j) {
-        Fr temp_1;
-        Fr temp_2;
-        for (size_t i = (j * domain.thread_size); i < ((j + 1) * domain.thread_size); i += 2) {
-            uint32_t next_index_1 = (uint32_t)reverse_bits((uint32_t)i + 2, (uint32_t)domain.log2_size);
-            uint32_t next_index_2 = (uint32_t)reverse_bits((uint32_t)i + 3, (uint32_t)domain.log2_size);
-            __builtin_prefetch(&coeffs[next_index_1]);
-            __builtin_prefetch(&coeffs[next_index_2]);
-
-            uint32_t swap_index_1 = (uint32_t)reverse_bits((uint32_t)i, (uint32_t)domain.log2_size);
-            uint32_t swap_index_2 = (uint32_t)reverse_bits((uint32_t)i + 1, (uint32_t)domain.log2_size);
-
-            Fr::__copy(coeffs[swap_index_1], temp_1);
-            Fr::__copy(coeffs[swap_index_2], temp_2);
-            target[i + 1] = temp_1 - temp_2;
-            target[i] = temp_1 + temp_2;
+        const size_t thread_start = j * thread_size;
+        for (size_t block_start = thread_start; block_start < thread_start + thread_size; block_start += block_size) {
+            if (final_m == 1) {
+                fft_first_round<Fr>(block_start, block_start + block_size, domain.log2_size, load, emit_final);
+            } else {
+                fft_first_round<Fr>(block_start, block_start + block_size, domain.log2_size, load, write_back);
+            }
+            fft_rounds(work, block_start, 0, block_size >> 1, 2, block_size, final_m, root_table, emit_final);
         }
+        fft_rounds(work, thread_start, 0, thread_size >> 1, block_size, thread_size, final_m, root_table, emit_final);
     });
 
-    // hard code exception for when the domain size is tiny - we won't execute the next loop, so need to manually
-    // reduce + copy
-    if (domain.size <= 2) {
-        coeffs[0] = target[0];
-        coeffs[1] = target[1];
-    }
-
-    // outer FFT loop
-    for (size_t m = 2; m < (domain.size); m <<= 1) {
+    for (size_t m = thread_size; m < domain.size;) {
+        const size_t m_end = std::min(m << 2, domain.size);
         parallel_for(domain.num_threads, [&](size_t j) {
-            Fr temp;
-
-            // Ok! So, what's going on here? This is the inner loop of the FFT algorithm, and we want to break it
-            // out into multiple independent threads. For `num_threads`, each thread will evaluation `domain.size /
-            // num_threads` of the polynomial. The actual iteration length will be half of this, because we leverage
-            // the fact that \omega^{n/2} = -\omega (where \omega is a root of unity)
-
-            // Here, `start` and `end` are used as our iterator limits, so that we can use our iterator `i` to
-            // directly access the roots of unity lookup table
-            const size_t start = j * (domain.thread_size >> 1);
-            const size_t end = (j + 1) * (domain.thread_size >> 1);
-
-            // For all but the last round of our FFT, the roots of unity that we need, will be a subset of our
-            // lookup table. e.g. for a size 2^n FFT, the 2^n'th roots create a multiplicative subgroup of order 2^n
-            //      the 1st round will use the roots from the multiplicative subgroup of order 2 : the 2'th roots of
-            //      unity the 2nd round will use the roots from the multiplicative subgroup of order 4 : the 4'th
-            //      roots of unity
-            // i.e. each successive FFT round will double the set of roots that we need to index.
-            // We have already laid out the `root_table` container so that each FFT round's roots are linearly
-            // ordered in memory. For all FFT rounds, the number of elements we're iterating over is greater than
-            // the size of our lookup table. We need to access this table in a cyclical fasion - i.e. for a subgroup
-            // of size x, the first x iterations will index the subgroup elements in order, then for the next x
-            // iterations, we loop back to the start.
-
-            // We could implement the algorithm by having 2 nested loops (where the inner loop iterates over the
-            // root table), but we want to flatten this out - as for the first few rounds, the inner loop will be
-            // tiny and we'll have quite a bit of unneccesary branch checks For each iteration of our flattened
-            // loop, indexed by `i`, the element of the root table we need to access will be `i % (current round
-            // subgroup size)` Given that each round subgroup size is `m`, which is a power of 2, we can index the
-            // root table with a very cheap `i & (m - 1)` Which is why we have this odd `block_mask` variable
-            const size_t block_mask = m - 1;
-
-            // The next problem to tackle, is we now need to efficiently index the polynomial element in
-            // `scratch_space` in our flattened loop If we used nested loops, the outer loop (e.g. `y`) iterates
-            // from 0 to 'domain size', in steps of 2 * m, with the inner loop (e.g. `z`) iterating from 0 to m. We
-            // have our inner loop indexer with `i & (m - 1)`. We need to add to this our outer loop indexer, which
-            // is equivalent to taking our indexer `i`, masking out the bits used in the 'inner loop', and doubling
-            // the result. i.e. polynomial indexer = (i & (m - 1)) + ((i & ~(m - 1)) >> 1) To simplify this, we
-            // cache index_mask = ~block_mask, meaning that our indexer is just `((i & index_mask) << 1 + (i &
-            // block_mask)`
-            const size_t index_mask = ~block_mask;
-
-            // `round_roots` fetches the pointer to this round's lookup table. We use `numeric::get_msb(m) - 1` as
-            // our indexer, because we don't store the precomputed root values for the 1st round (because they're
-            // all 1).
-            const Fr* round_roots = root_table[static_cast<size_t>(numeric::get_msb(m)) - 1];
-
-            // Finally, we want to treat the final round differently from the others,
-            // so that we can reduce out of our 'coarse' reduction and store the output in `coeffs` instead of
-            // `scratch_space`
-            for (size_t i = start; i < end; ++i) {
-                size_t k1 = (i & index_mask) << 1;
-                size_t j1 = i & block_mask;
-                temp = round_roots[j1] * target[k1 + j1 + m];
-                target[k1 + j1 + m] = target[k1 + j1] - temp;
-                target[k1 + j1] += temp;
-            }
+            const size_t start = j * (thread_size >> 1);
+            const size_t end = (j + 1) * (thread_size >> 1);
+            fft_rounds(work, 0, start, end, m, m_end, final_m, root_table, emit_final);
         });
+        m = m_end;
     }
 }
 
+/**
+ * @brief FFT of a polynomial split into `coeffs.size()` equal parts, in place, with the result multiplied by `scale`
+ * if `scale_output` is set
+ */
+template <typename Fr, bool scale_output>
+void fft_inner_split(std::vector<Fr*>& coeffs,
+                     const EvaluationDomain<Fr>& domain,
+                     const std::vector<Fr*>& root_table,
+                     const Fr& scale)
+{
+    auto scratch_space_ptr = get_scratch_space<Fr>(domain.size);
+    auto scratch_space = scratch_space_ptr.get();
+
+    const size_t num_polys = coeffs.size();
+    ASSERT(is_power_of_two(num_polys));
+    const size_t poly_size = domain.size / num_polys;
+    ASSERT(is_power_of_two(poly_size));
+    const size_t poly_mask = poly_size - 1;
+    const size_t log2_poly_size = (size_t)numeric::get_msb(poly_size);
+
+    const auto load = [&](const size_t idx) -> const Fr& { return coeffs[idx >> log2_poly_size][idx & poly_mask]; };
+    const auto emit = [&](const size_t idx, const Fr& value) {
+        if constexpr (scale_output) {
+            coeffs[idx >> log2_poly_size][idx & poly_mask] = value * scale;
+        } else {
+            coeffs[idx >> log2_poly_size][idx & poly_mask] = value;
+        }
+    };
+    fft_inner_blocked(scratch_space, domain, root_table, load, emit);
+}
+
+/**
+ * @brief FFT of `coeffs` into `target`, with the result multiplied by `scale` if `scale_output` is set
+ */
+template <typename Fr, bool scale_output>
+void fft_inner_into_target(const Fr* coeffs,
+                           Fr* target,
+                           const EvaluationDomain<Fr>& domain,
+                           const std::vector<Fr*>& root_table,
+                           const Fr& scale)
+{
+    const auto load = [coeffs](const size_t idx) -> const Fr& { return coeffs[idx]; };
+    const auto emit = [&](const size_t idx, const Fr& value) {
+        if constexpr (scale_output) {
+            target[idx] = value * scale;
+        } else {
+            Fr::__copy(value, target[idx]);
+        }
+    };
+    fft_inner_blocked(target, domain, root_table, load, emit);
+}
+
+} // namespace
+
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void fft_inner_parallel(std::vector<Fr*> coeffs,
+                        const EvaluationDomain<Fr>& domain,
+                        const Fr&,
+                        const std::vector<Fr*>& root_table)
+{
+    fft_inner_split<Fr, false>(coeffs, domain, root_table, Fr::one());
+}
+
 template <typename Fr>
     requires SupportsFFT<Fr>
 void partial_fft_serial_inner(Fr* coeffs,
@@ -531,62 +556,45 @@ template <typename Fr>
     requires SupportsFFT<Fr>
 void fft(Fr* coeffs, Fr* target, const EvaluationDomain<Fr>& domain)
 {
-    fft_inner_parallel(coeffs, target, domain, domain.root, domain.get_round_roots());
+    fft_inner_into_target<Fr, false>(coeffs, target, domain, domain.get_round_roots(), Fr::one());
 }
 
 template <typename Fr>
     requires SupportsFFT<Fr>
 void fft(std::vector<Fr*> coeffs, const EvaluationDomain<Fr>& domain)
 {
-    fft_inner_parallel<Fr>(coeffs, domain.size, domain.root, domain.get_round_roots());
+    fft_inner_parallel<Fr>(coeffs, domain, domain.root, domain.get_round_roots());
 }
 
 template <typename Fr>
     requires SupportsFFT<Fr>
 void ifft(Fr* coeffs, const EvaluationDomain<Fr>& domain)
 {
-    fft_inner_parallel({ coeffs }, domain, domain.root_inverse, domain.get_inverse_round_roots());
-    ITERATE_OVER_DOMAIN_START(domain);
-    coeffs[i] *= domain.domain_inverse;
-    ITERATE_OVER_DOMAIN_END;
+    // The division by n is applied as the final round writes its output, rather than in another pass
+    std::vector<Fr*> split_coeffs{ coeffs };
+    fft_inner_split<Fr, true>(split_coeffs, domain, domain.get_inverse_round_roots(), domain.domain_inverse);
 }
 
 template <typename Fr>
     requires SupportsFFT<Fr>
 void ifft(Fr* coeffs, Fr* target, const EvaluationDomain<Fr>& domain)
 {
-    fft_inner_parallel(coeffs, target, domain, domain.root_inverse, domain.get_inverse_round_roots());
-    ITERATE_OVER_DOMAIN_START(domain);
-    target[i] *= domain.domain_inverse;
-    ITERATE_OVER_DOMAIN_END;
+    fft_inner_into_target<Fr, true>(coeffs, target, domain, domain.get_inverse_round_roots(), domain.domain_inverse);
 }
 
 template <typename Fr>
     requires SupportsFFT<Fr>
 void ifft(std::vector<Fr*> coeffs, const EvaluationDomain<Fr>& domain)
 {
-    fft_inner_parallel(coeffs, domain, domain.root_inverse, domain.get_inverse_round_roots());
-
-    const size_t num_polys = coeffs.size();
-    ASSERT(is_power_of_two(num_polys));
-    const size_t poly_size = domain.size / num_polys;
-    ASSERT(is_power_of_two(poly_size));
-    const size_t poly_mask = poly_size - 1;
-    const size_t log2_poly_size = (size_t)numeric::get_msb(poly_size);
-
-    ITERATE_OVER_DOMAIN_START(domain);
-    coeffs[i >> log2_poly_size][i & poly_mask] *= domain.domain_inverse;
-    ITERATE_OVER_DOMAIN_END;
+    fft_inner_split<Fr, true>(coeffs, domain, domain.get_inverse_round_roots(), domain.domain_inverse);
 }
 
 template <typename Fr>
     requires SupportsFFT<Fr>
 void fft_with_constant(Fr* coeffs, const EvaluationDomain<Fr>& domain, const Fr& value)
 {
-    fft_inner_parallel({ coeffs }, domain, domain.root, domain.get_round_roots());
-    ITERATE_OVER_DOMAIN_START(domain);
-    coeffs[i] *= value;
-    ITERATE_OVER_DOMAIN_END;
+    std::vector<Fr*> split_coeffs{ coeffs };
+    fft_inner_split<Fr, true>(split_coeffs, domain, domain.get_round_roots(), value);
 }
 
 template <typename Fr>
@@ -650,11 +658,11 @@ void coset_fft(Fr* coeffs,
     }
 
     for (size_t i = 0; i < domain_extension; ++i) {
-        fft_inner_parallel(coeffs + (i * domain.size),
-                           scratch_space + (i * domain.size),
-                           domain,
-                           domain.root,
-                           domain.get_round_roots());
+        fft_inner_into_target<Fr, false>(coeffs + (i * domain.size),
+                                         scratch_space + (i * domain.size),
+                                         domain,
+                                         domain.get_round_roots(),
+                                         Fr::one());
     }
 
     if (domain_extension == 4) {
@@ -704,32 +712,31 @@ template <typename Fr>
     requires SupportsFFT<Fr>
 void ifft_with_constant(Fr* coeffs, const EvaluationDomain<Fr>& domain, const Fr& value)
 {
-    fft_inner_parallel({ coeffs }, domain, domain.root_inverse, domain.get_inverse_round_roots());
-    Fr T0 = domain.domain_inverse * value;
-    ITERATE_OVER_DOMAIN_START(domain);
-    coeffs[i] *= T0;
-    ITERATE_OVER_DOMAIN_END;
+    std::vector<Fr*> split_coeffs{ coeffs };
+    fft_inner_split<Fr, true>(split_coeffs, domain, domain.get_inverse_round_roots(), domain.domain_inverse * value);
 }
 
 template <typename Fr>
     requires SupportsFFT<Fr>
 void coset_ifft(Fr* coeffs, const EvaluationDomain<Fr>& domain)
 {
-    ifft(coeffs, domain);
-    scale_by_generator(coeffs, coeffs, domain, Fr::one(), domain.generator_inverse, domain.size);
+    // The division by n is folded into the coset scaling
+    fft_inner_parallel({ coeffs }, domain, domain.root_inverse, domain.get_inverse_round_roots());
+    scale_by_generator(coeffs, coeffs, domain, domain.domain_inverse, domain.generator_inverse, domain.size);
 }
 
 template <typename Fr>
     requires SupportsFFT<Fr>
 void coset_ifft(std::vector<Fr*> coeffs, const EvaluationDomain<Fr>& domain)
 {
-    ifft(coeffs, domain);
+    // The division by n is folded into the coset scaling
+    fft_inner_parallel(coeffs, domain, domain.root_inverse, domain.get_inverse_round_roots());
 
     const size_t num_polys = coeffs.size();
     ASSERT(is_power_of_two(num_polys));
     const size_t poly_size = domain.size / num_polys;
     const Fr generator_inv_pow_n = domain.generator_inverse.pow(poly_size);
-    Fr generator_start = 1;
+    Fr generator_start = domain.domain_inverse;
 
     for (size_t i = 0; i < num_polys; i++) {
         scale_by_generator(coeffs[i], coeffs[i], domain, generator_start, domain.generator_inverse, poly_size);
@@ -90,6 +90,59 @@ TEST(polynomials, split_polynomial_fft)
     }
 }
 
+/**
+ * @brief The blocked, radix-4 parallel FFT must match the serial radix-2 FFT for every domain size, including sizes
+ * with an odd number of rounds and sizes spanning several cache blocks
+ */
+TEST(polynomials, fft_matches_serial_fft)
+{
+    for (size_t log2_n = 1; log2_n <= 15; ++log2_n) {
+        const size_t n = 1UL << log2_n;
+        std::vector<fr> poly(n);
+        for (auto& coeff : poly) {
+            coeff = fr::random_element();
+        }
+
+        auto domain = evaluation_domain(n);
+        domain.compute_lookup_table();
+
+        std::vector<fr> expected = poly;
+        polynomial_arithmetic::fft_inner_serial({ expected.data() }, n, domain.get_round_roots());
+
+        std::vector<fr> result = poly;
+        polynomial_arithmetic::fft(result.data(), domain);
+        EXPECT_EQ(result, expected);
+
+        std::vector<fr> target(n);
+        polynomial_arithmetic::fft(poly.data(), target.data(), domain);
+        EXPECT_EQ(target, expected);
+
+        polynomial_arithmetic::ifft(result.data(), domain);
+        EXPECT_EQ(result, poly);
+    }
+}
+
+/**
+ * @brief Domains of the same size share one table of roots of unity
+ */
+TEST(polynomials, evaluation_domains_share_root_tables)
+{
+    constexpr size_t n = 1 << 10;
+    auto domain = evaluation_domain(n);
+    auto other_domain = evaluation_domain(n);
+    auto larger_domain = evaluation_domain(2 * n);
+    domain.compute_lookup_table();
+    other_domain.compute_lookup_table();
+    larger_domain.compute_lookup_table();
+    auto domain_copy = evaluation_domain(domain);
+
+    EXPECT_EQ(domain.get_round_roots()[0], other_domain.get_round_roots()[0]);
+    EXPECT_EQ(domain.get_inverse_round_roots()[0], other_domain.get_inverse_round_roots()[0]);
+    EXPECT_EQ(domain.get_round_roots()[0], domain_copy.get_round_roots()[0]);
+    EXPECT_NE(domain.get_round_roots()[0], larger_domain.get_round_roots()[0]);
+    EXPECT_EQ(domain.get_round_roots()[domain.log2_size - 2][1], domain.root);
+}
+
 TEST(polynomials, split_polynomial_evaluate)
 {
     constexpr size_t n = 256;
@@ -238,6 +238,42 @@ void fft_bench_parallel(State& state) noexcept
 }
 BENCHMARK(fft_bench_parallel)->RangeMultiplier(2)->Range(START * 4, MAX_GATES * 4)->Unit(benchmark::kMicrosecond);
 
+void ifft_bench_parallel(State& state) noexcept
+{
+    for (auto _ : state) {
+        size_t idx = (size_t)numeric::get_msb((uint64_t)state.range(0)) - (size_t)numeric::get_msb(START);
+        bb::polynomial_arithmetic::ifft(globals.data, evaluation_domains[idx]);
+    }
+}
+BENCHMARK(ifft_bench_parallel)->RangeMultiplier(2)->Range(START * 4, MAX_GATES * 4)->Unit(benchmark::kMicrosecond);
+
+void coset_ifft_bench_parallel(State& state) noexcept
+{
+    for (auto _ : state) {
+        size_t idx = (size_t)numeric::get_msb((uint64_t)state.range(0)) - (size_t)numeric::get_msb(START);
+        bb::polynomial_arithmetic::coset_ifft(globals.data, evaluation_domains[idx]);
+    }
+}
+BENCHMARK(coset_ifft_bench_parallel)
+    ->RangeMultiplier(2)
+    ->Range(START * 4, MAX_GATES * 4)
+    ->Unit(benchmark::kMicrosecond);
+
+// Root tables are shared between domains of the same size, so this only measures the table lookup while the global
+// domains are alive
+void evaluation_domain_lookup_table_bench(State& state) noexcept
+{
+    for (auto _ : state) {
+        bb::evaluation_domain domain(static_cast<size_t>(state.range(0)));
+        domain.compute_lookup_table();
+        DoNotOptimize(domain.get_round_roots());
+    }
+}
+BENCHMARK(evaluation_domain_lookup_table_bench)
+    ->RangeMultiplier(2)
+    ->Range(START * 4, MAX_GATES * 4)
+    ->Unit(benchmark::kMicrosecond);
+
 void fft_bench_serial(State& state) noexcept
 {
     for (auto _ : state) {
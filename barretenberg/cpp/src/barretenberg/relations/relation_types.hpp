@@ -89,6 +89,22 @@ consteval std::array<size_t, NUM_SUBRELATIONS> compute_composed_subrelation_part
     return SUBRELATION_PARTIAL_LENGTHS;
 };
 
+/**
+ * @brief Get the subrelation accumulators for evaluating a relation on a batch of sumcheck edges at once.
+ * @details A batch of BATCH_SIZE edges is stored point-major, i.e. entry p * BATCH_SIZE + k holds the value of edge k
+ * at the point p. A subrelation of length x therefore needs x * BATCH_SIZE entries.
+ */
+template <size_t BATCH_SIZE, size_t NUM_SUBRELATIONS>
+consteval std::array<size_t, NUM_SUBRELATIONS> compute_batched_subrelation_partial_lengths(
+    std::array<size_t, NUM_SUBRELATIONS> SUBRELATION_PARTIAL_LENGTHS)
+{
+    std::transform(SUBRELATION_PARTIAL_LENGTHS.begin(),
+                   SUBRELATION_PARTIAL_LENGTHS.end(),
+                   SUBRELATION_PARTIAL_LENGTHS.begin(),
+                   [](const size_t x) { return x * BATCH_SIZE; });
+    return SUBRELATION_PARTIAL_LENGTHS;
+};
+
 /**
  * @brief The templates defined herein facilitate sharing the relation arithmetic between the prover and the
  * verifier.
@@ -126,6 +142,30 @@ concept isSkippable = requires(const AllEntities& input) {
     } -> std::same_as<bool>;
 };
 
+/**
+ * @brief Columns gating a relation whose implementation cannot declare a skip method itself, e.g. because it is
+ * generated code
+ *
+ * @details A specialization for a RelationImpl provides a static skip(in), with the semantics of a relation's own skip
+ * method, which Relation<RelationImpl> then exposes. The primary template declares no gate.
+ */
+template <typename RelationImpl> struct RelationGate {};
+
+/**
+ * @brief Check whether an input to a relation's skip method is zero
+ *
+ * @details Sumcheck passes univariates over an edge, which vanish iff both endpoints of the edge (consecutive rows) are
+ * zero. The circuit checkers pass the field values of a single row.
+ */
+template <typename Entity> inline bool is_zero_on_edge(const Entity& entity)
+{
+    if constexpr (requires { entity.value_at(0); }) {
+        return entity.value_at(0).is_zero() && entity.value_at(1).is_zero();
+    } else {
+        return entity.is_zero();
+    }
+}
+
 /**
  * @brief A wrapper for Relations to expose methods used by the Sumcheck prover or verifier to add the
  * contribution of a given relation to the corresponding accumulator.
@@ -157,8 +197,28 @@ template <typename RelationImpl> class Relation : public RelationImpl {
                                     NUM_INSTANCES - 1>;
     using SumcheckTupleOfUnivariatesOverSubrelations =
         TupleOfUnivariates<FF, RelationImpl::SUBRELATION_PARTIAL_LENGTHS>;
+    template <size_t BATCH_SIZE>
+    using BatchedSumcheckTupleOfUnivariatesOverSubrelations =
+        TupleOfUnivariates<FF,
+                           compute_batched_subrelation_partial_lengths<BATCH_SIZE>(
+                               RelationImpl::SUBRELATION_PARTIAL_LENGTHS)>;
     using SumcheckArrayOfValuesOverSubrelations = ArrayOfValues<FF, RelationImpl::SUBRELATION_PARTIAL_LENGTHS>;
 
+    /**
+     * @brief Returns true if the contribution from all subrelations for the provided inputs is identically zero, using
+     * the skip method of the implementation or else its RelationGate
+     */
+    template <typename AllEntities>
+    static bool skip(const AllEntities& in)
+        requires(isSkippable<RelationImpl, AllEntities> || isSkippable<RelationGate<RelationImpl>, AllEntities>)
+    {
+        if constexpr (isSkippable<RelationImpl, AllEntities>) {
+            return RelationImpl::skip(in);
+        } else {
+            return RelationGate<RelationImpl>::skip(in);
+        }
+    }
+
     // These are commonly needed, most importantly, for explicitly instantiating
     // compute_foo_numerator/denomintor.
     using UnivariateAccumulator0 = std::tuple_element_t<0, SumcheckTupleOfUnivariatesOverSubrelations>;
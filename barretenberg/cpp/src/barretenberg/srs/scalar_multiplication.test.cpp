@@ -12,12 +12,15 @@
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
 #include "barretenberg/common/mem.hpp"
 #include "barretenberg/common/test.hpp"
+#include "barretenberg/ecc/scalar_multiplication/fixed_base_msm.hpp"
 #include "barretenberg/ecc/scalar_multiplication/point_table.hpp"
+#include "barretenberg/ecc/scalar_multiplication/signed_digit_msm.hpp"
 #include "barretenberg/numeric/random/engine.hpp"
 #include "barretenberg/srs/factories/file_crs_factory.hpp"
 #include "barretenberg/srs/io.hpp"
 
 #include <cstddef>
+#include <filesystem>
 #include <vector>
 
 using namespace bb;
@@ -1040,3 +1043,215 @@ TYPED_TEST(ScalarMultiplicationTests, PippengerMulByZero)
 
     EXPECT_EQ(result.is_point_at_infinity(), true);
 }
+
+TYPED_TEST(ScalarMultiplicationTests, SignedDigitPippenger)
+{
+    using Curve = TypeParam;
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+    using Fr = typename Curve::ScalarField;
+
+    constexpr size_t num_points = 1000;
+
+    std::vector<Fr> scalars(num_points);
+    auto point_table = scalar_multiplication::point_table_alloc<AffineElement>(num_points);
+    AffineElement* points = point_table.get();
+
+    for (size_t i = 0; i < num_points; ++i) {
+        scalars[i] = Fr::random_element();
+        points[i] = AffineElement(Element::random_element());
+    }
+    scalars[1] = Fr::zero();
+
+    Element expected;
+    expected.self_set_infinity();
+    for (size_t i = 0; i < num_points; ++i) {
+        Element temp = points[i] * scalars[i];
+        expected += temp;
+    }
+    expected = expected.normalize();
+    scalar_multiplication::generate_pippenger_point_table<Curve>(points, points, num_points);
+
+    // The default configuration, and a range of window widths with the buckets split over several tiles
+    Element result = scalar_multiplication::signed_digit_pippenger<Curve>(scalars.data(), points, num_points);
+    EXPECT_EQ(result.normalize(), expected);
+    for (size_t window_bits : { 2UL, 5UL, 8UL, 11UL }) {
+        const size_t buckets_per_tile = std::max(1UL << (window_bits - 1) >> 2, 1UL);
+        scalar_multiplication::SignedDigitMsmConfig config{ window_bits, buckets_per_tile };
+        result = scalar_multiplication::signed_digit_pippenger<Curve>(scalars.data(), points, num_points, config);
+        EXPECT_EQ(result.normalize(), expected);
+    }
+}
+
+TYPED_TEST(ScalarMultiplicationTests, SignedDigitPippengerEdgeCases)
+{
+    using Curve = TypeParam;
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+    using Fr = typename Curve::ScalarField;
+
+    constexpr size_t num_points = 128;
+
+    std::vector<Fr> scalars(num_points);
+    auto point_table = scalar_multiplication::point_table_alloc<AffineElement>(num_points);
+    AffineElement* points = point_table.get();
+
+    // Repeated points and scalars force bucket doublings, and scalar pairs (s, -s) force cancellations
+    AffineElement point = AffineElement(Element::random_element());
+    for (size_t i = 0; i < num_points; i += 2) {
+        scalars[i] = Fr::random_element();
+        scalars[i + 1] = (i % 4 == 0) ? scalars[i] : -scalars[i];
+        points[i] = point;
+        points[i + 1] = point;
+    }
+
+    Element expected;
+    expected.self_set_infinity();
+    for (size_t i = 0; i < num_points; ++i) {
+        Element temp = points[i] * scalars[i];
+        expected += temp;
+    }
+    scalar_multiplication::generate_pippenger_point_table<Curve>(points, points, num_points);
+
+    Element result = scalar_multiplication::signed_digit_pippenger<Curve>(scalars.data(), points, num_points);
+    EXPECT_EQ(result, expected);
+
+    result = scalar_multiplication::signed_digit_pippenger<Curve>(scalars.data(), points, 0);
+    EXPECT_TRUE(result.is_point_at_infinity());
+}
+
+TYPED_TEST(ScalarMultiplicationTests, FixedBasePippenger)
+{
+    using Curve = TypeParam;
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+    using Fr = typename Curve::ScalarField;
+    using Table = scalar_multiplication::FixedBaseMsmTable<Curve>;
+
+    constexpr size_t num_points = 500;
+    constexpr size_t start_index = 100;
+
+    std::vector<Fr> scalars(num_points);
+    auto point_table = scalar_multiplication::point_table_alloc<AffineElement>(num_points);
+    AffineElement* points = point_table.get();
+
+    for (size_t i = 0; i < num_points; ++i) {
+        scalars[i] = Fr::random_element();
+        points[i] = AffineElement(Element::random_element());
+    }
+    scalars[start_index] = Fr::zero();
+
+    Element expected;
+    expected.self_set_infinity();
+    for (size_t i = start_index; i < num_points; ++i) {
+        Element temp = points[i] * scalars[i];
+        expected += temp;
+    }
+    scalar_multiplication::generate_pippenger_point_table<Curve>(points, points, num_points);
+
+    // MSM over a suffix of the bases covered by the table
+    const Fr* suffix_scalars = &scalars[start_index];
+    for (size_t window_bits : { 3UL, 8UL, Table::get_optimal_window_bits(num_points) }) {
+        Table table(points, num_points, window_bits);
+        Element result = scalar_multiplication::fixed_base_pippenger<Curve>(
+            suffix_scalars, table, start_index, num_points - start_index);
+        EXPECT_EQ(result, expected);
+    }
+
+    // A table written to a cache file is memory-mapped by the next table over the same points
+    const std::string cache_name = "fixed_base_msm_test_" + std::to_string(engine.get_random_uint32());
+    const std::string cache_path = (std::filesystem::temp_directory_path() / cache_name).string();
+    {
+        Table table(points, num_points, 8, cache_path);
+        EXPECT_FALSE(table.is_loaded_from_cache());
+    }
+    {
+        Table table(points, num_points, 8, cache_path);
+        EXPECT_TRUE(table.is_loaded_from_cache());
+        Element result = scalar_multiplication::fixed_base_pippenger<Curve>(
+            suffix_scalars, table, start_index, num_points - start_index);
+        EXPECT_EQ(result, expected);
+    }
+    {
+        // A cache for a different window width is ignored
+        Table table(points, num_points, 9, cache_path);
+        EXPECT_FALSE(table.is_loaded_from_cache());
+    }
+    {
+        // As is a cache for points which only differ from the cached ones away from the ends of the table
+        std::vector<AffineElement> other_points(points, points + 2 * num_points);
+        other_points[num_points] = AffineElement(Element::random_element());
+        Table table(other_points.data(), num_points, 9, cache_path);
+        EXPECT_FALSE(table.is_loaded_from_cache());
+    }
+    std::filesystem::remove(cache_path);
+}
+
+TYPED_TEST(ScalarMultiplicationTests, RuntimeStatePool)
+{
+    using Curve = TypeParam;
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+    using Fr = typename Curve::ScalarField;
+    using Pool = scalar_multiplication::PippengerRuntimeStatePool<Curve>;
+
+    // Size classes are spaced four per octave
+    EXPECT_EQ(Pool::get_size_class(3), 3);
+    EXPECT_EQ(Pool::get_size_class(1024), 1024);
+    EXPECT_EQ(Pool::get_size_class(1025), 1280);
+    EXPECT_EQ(Pool::get_size_class(1280), 1280);
+    EXPECT_EQ(Pool::get_size_class(1281), 1536);
+
+    Pool::clear();
+    const auto initial_stats = Pool::get_stats();
+    const size_t num_points = 1100;
+    {
+        auto state = Pool::acquire(num_points);
+        EXPECT_EQ(state->num_points, 2 * Pool::get_size_class(num_points));
+    }
+    EXPECT_EQ(Pool::get_stats().num_idle_states, 1);
+
+    // A request in the same size class reuses the released state, while concurrently held states are distinct
+    auto state = Pool::acquire(num_points + 100);
+    auto other_state = Pool::acquire(num_points);
+    EXPECT_NE(state.get(), other_state.get());
+    const auto stats = Pool::get_stats();
+    EXPECT_EQ(stats.num_allocations - initial_stats.num_allocations, 2);
+    EXPECT_EQ(stats.num_reuses - initial_stats.num_reuses, 1);
+    EXPECT_EQ(stats.num_idle_states, 0);
+
+    // A pooled state may be larger than the MSM it is used for
+    std::vector<Fr> scalars(num_points);
+    auto point_table = scalar_multiplication::point_table_alloc<AffineElement>(num_points);
+    AffineElement* points = point_table.get();
+    Element expected;
+    expected.self_set_infinity();
+    for (size_t i = 0; i < num_points; ++i) {
+        scalars[i] = Fr::random_element();
+        points[i] = AffineElement(Element::random_element());
+        Element temp = points[i] * scalars[i];
+        expected += temp;
+    }
+    scalar_multiplication::generate_pippenger_point_table<Curve>(points, points, num_points);
+    Element result = scalar_multiplication::pippenger<Curve>(scalars.data(), points, num_points, *state);
+    EXPECT_EQ(result, expected);
+
+    state = nullptr;
+    other_state = nullptr;
+    EXPECT_EQ(Pool::get_stats().num_idle_states, 2);
+    Pool::clear();
+    EXPECT_EQ(Pool::get_stats().num_idle_states, 0);
+
+    // Released states beyond the idle limit of their size class are freed
+    {
+        std::vector<std::shared_ptr<typename Pool::State>> states;
+        for (size_t i = 0; i < Pool::DEFAULT_MAX_IDLE_STATES_PER_SIZE_CLASS + 2; ++i) {
+            states.push_back(Pool::acquire(num_points));
+        }
+    }
+    EXPECT_EQ(Pool::get_stats().num_idle_states, Pool::DEFAULT_MAX_IDLE_STATES_PER_SIZE_CLASS);
+    Pool::set_max_idle_states_per_size_class(1);
+    EXPECT_EQ(Pool::get_stats().num_idle_states, 1);
+    Pool::set_max_idle_states_per_size_class(Pool::DEFAULT_MAX_IDLE_STATES_PER_SIZE_CLASS);
+    Pool::clear();
+}
@@ -7,6 +7,10 @@ using namespace bb;
 template <typename C>
 field_t<C> pedersen_hash<C>::hash(const std::vector<field_ct>& inputs, const GeneratorContext context)
 {
+    if constexpr (IsSimulator<C>) {
+        return hash_simulated(inputs, context);
+    }
+
     using cycle_scalar = typename cycle_group::cycle_scalar;
     using Curve = EmbeddedCurve;
 
@@ -30,6 +34,10 @@ template <typename C>
 field_t<C> pedersen_hash<C>::hash_skip_field_validation(const std::vector<field_ct>& inputs,
                                                         const GeneratorContext context)
 {
+    if constexpr (IsSimulator<C>) {
+        return hash_simulated(inputs, context);
+    }
+
     using cycle_scalar = typename cycle_group::cycle_scalar;
     using Curve = EmbeddedCurve;
 
@@ -50,6 +58,26 @@ field_t<C> pedersen_hash<C>::hash_skip_field_validation(const std::vector<field_
     return result.x;
 }
 
+/**
+ * @brief Compute the hash natively when the builder is a circuit simulator.
+ * @details All inputs are constants under simulation, so there are no constraints to build and we can call straight
+ * into crypto::pedersen_hash.
+ */
+template <typename C>
+field_t<C> pedersen_hash<C>::hash_simulated(const std::vector<field_ct>& inputs, const GeneratorContext context)
+{
+    C* ctx = nullptr;
+    std::vector<bb::fr> native_inputs;
+    native_inputs.reserve(inputs.size());
+    for (const auto& input : inputs) {
+        if (ctx == nullptr) {
+            ctx = input.get_context();
+        }
+        native_inputs.emplace_back(input.get_value());
+    }
+    return field_ct(ctx, crypto::pedersen_hash_base<EmbeddedCurve>::hash(native_inputs, context));
+}
+
 /**
  * @brief Hash a byte_array.
  *
@@ -88,5 +116,6 @@ field_t<C> pedersen_hash<C>::hash_buffer(const stdlib::byte_array<C>& input, Gen
 template class pedersen_hash<bb::StandardCircuitBuilder>;
 template class pedersen_hash<bb::UltraCircuitBuilder>;
 template class pedersen_hash<bb::GoblinUltraCircuitBuilder>;
+template class pedersen_hash<bb::CircuitSimulatorBN254>;
 
 } // namespace bb::stdlib
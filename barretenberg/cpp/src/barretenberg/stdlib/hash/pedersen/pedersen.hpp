@@ -29,6 +29,9 @@ template <typename Builder> class pedersen_hash {
     // TODO health warnings!
     static field_ct hash_skip_field_validation(const std::vector<field_ct>& in, GeneratorContext context = {});
     static field_ct hash_buffer(const stdlib::byte_array<Builder>& input, GeneratorContext context = {});
+
+  private:
+    static field_ct hash_simulated(const std::vector<field_ct>& in, GeneratorContext context);
 };
 
 } // namespace bb::stdlib
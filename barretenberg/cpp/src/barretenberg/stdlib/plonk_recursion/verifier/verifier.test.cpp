@@ -577,6 +577,58 @@ template <typename OuterComposer> class stdlib_verifier : public testing::Test {
         check_pairing(circuit_output);
         check_recursive_verification_circuit(outer_circuit, true);
     }
+
+    /**
+     * @brief Check that the recursive verifier run on a circuit simulator produces the same aggregation state as the
+     * circuit version, so that it can be used to compute recursive verification outputs without building gates.
+     */
+    static void test_recursive_proof_composition_simulated()
+    {
+        using SimulatorCurve = bn254<CircuitSimulatorBN254>;
+        using SimulatorSettings =
+            std::conditional_t<is_ultra_to_ultra,
+                               recursion::recursive_ultra_verifier_settings<SimulatorCurve>,
+                               recursion::recursive_ultra_to_standard_verifier_settings<SimulatorCurve>>;
+
+        InnerBuilder inner_circuit;
+        OuterBuilder outer_circuit;
+        std::vector<inner_scalar_field> inner_public_inputs{ inner_scalar_field::random_element(),
+                                                             inner_scalar_field::random_element(),
+                                                             inner_scalar_field::random_element() };
+        create_inner_circuit(inner_circuit, inner_public_inputs);
+
+        ProverOfInnerCircuit prover;
+        InnerComposer inner_composer;
+        if constexpr (is_ultra_to_ultra) {
+            prover = inner_composer.create_prover(inner_circuit);
+        } else {
+            prover = inner_composer.create_ultra_to_standard_prover(inner_circuit);
+        }
+        const auto verification_key_native = inner_composer.compute_verification_key(inner_circuit);
+        plonk::proof proof_to_recursively_verify = prover.construct_proof();
+        plonk::transcript::Manifest recursive_manifest = InnerComposer::create_manifest(prover.key->num_public_inputs);
+
+        auto circuit_output = recursion::verify_proof<outer_curve, RecursiveSettings>(
+            &outer_circuit,
+            verification_key_pt::from_witness(&outer_circuit, verification_key_native),
+            recursive_manifest,
+            proof_to_recursively_verify);
+
+        CircuitSimulatorBN254 simulator;
+        auto simulated_output = recursion::verify_proof<SimulatorCurve, SimulatorSettings>(
+            &simulator,
+            recursion::verification_key<SimulatorCurve>::from_witness(&simulator, verification_key_native),
+            recursive_manifest,
+            proof_to_recursively_verify);
+
+        EXPECT_FALSE(simulator.failed());
+        EXPECT_EQ(simulated_output.P0.get_value(), circuit_output.P0.get_value());
+        EXPECT_EQ(simulated_output.P1.get_value(), circuit_output.P1.get_value());
+        ASSERT_EQ(simulated_output.public_inputs.size(), circuit_output.public_inputs.size());
+        for (size_t i = 0; i < circuit_output.public_inputs.size(); ++i) {
+            EXPECT_EQ(simulated_output.public_inputs[i].get_value(), circuit_output.public_inputs[i].get_value());
+        }
+    }
 };
 
 typedef testing::Types<plonk::StandardComposer, plonk::UltraComposer> OuterComposerTypes;
@@ -593,6 +645,11 @@ HEAVY_TYPED_TEST(stdlib_verifier, recursive_proof_composition)
     TestFixture::test_recursive_proof_composition();
 };
 
+HEAVY_TYPED_TEST(stdlib_verifier, recursive_proof_composition_simulated)
+{
+    TestFixture::test_recursive_proof_composition_simulated();
+};
+
 HEAVY_TYPED_TEST(stdlib_verifier, recursive_proof_composition_ultra_no_tables)
 {
     if constexpr (std::same_as<TypeParam, plonk::UltraComposer>) {
@@ -181,6 +181,21 @@ template <class Builder, class Fq, class Fr, class NativeGroup> class element {
         return typename NativeGroup::affine_element(x_val.lo, y_val.lo);
     }
 
+    /**
+     * @brief Wrap a native point as an element in the context of a circuit simulator.
+     * @details Under CircuitSimulatorBN254 every element is a constant, so the group operations below compute their
+     * outputs with native arithmetic and return them through this method. No on-curve check is needed since the value
+     * was produced by the native group law.
+     */
+    static element from_simulated_value(Builder* ctx, const typename NativeGroup::affine_element& input)
+        requires IsSimulator<Builder>
+    {
+        return element(Fq(ctx, uint256_t(input.x)), Fq(ctx, uint256_t(input.y)));
+    }
+
+    static element simulated_batch_mul(const std::vector<element>& points, const std::vector<Fr>& scalars)
+        requires IsSimulator<Builder>;
+
     // compute a multi-scalar-multiplication by creating a precomputed lookup table for each point,
     // splitting each scalar multiplier up into a 4-bit sliding window wNAF.
     // more efficient than batch_mul if num_points < 4
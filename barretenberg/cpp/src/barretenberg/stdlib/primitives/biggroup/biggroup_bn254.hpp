@@ -223,6 +223,14 @@ element<C, Fq, Fr, G> element<C, Fq, Fr, G>::bn254_endo_batch_mul(const std::vec
                                                                   const std::vector<Fr>& small_scalars,
                                                                   const size_t max_num_small_bits)
 {
+    if constexpr (IsSimulator<C>) {
+        std::vector<element> points(big_points);
+        std::vector<Fr> scalars(big_scalars);
+        points.insert(points.end(), small_points.begin(), small_points.end());
+        scalars.insert(scalars.end(), small_scalars.begin(), small_scalars.end());
+        return simulated_batch_mul(points, scalars);
+    }
+
     ASSERT(max_num_small_bits >= 128);
     const size_t num_big_points = big_points.size();
     const size_t num_small_points = small_points.size();
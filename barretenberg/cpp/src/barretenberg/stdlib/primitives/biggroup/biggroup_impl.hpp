@@ -56,6 +56,15 @@ element<C, Fq, Fr, G>& element<C, Fq, Fr, G>::operator=(element&& other)
 template <typename C, class Fq, class Fr, class G>
 element<C, Fq, Fr, G> element<C, Fq, Fr, G>::operator+(const element& other) const
 {
+    if constexpr (IsSimulator<C>) {
+        auto context = get_context(other);
+        const typename G::affine_element lhs = get_value();
+        const typename G::affine_element rhs = other.get_value();
+        if (lhs.x == rhs.x) {
+            context->failure("biggroup: x-coordinates of summands are equal in simulated addition");
+        }
+        return from_simulated_value(context, typename G::element(lhs) + typename G::element(rhs));
+    }
     if constexpr (IsGoblinBuilder<C> && std::same_as<G, bb::g1>) {
         // TODO(https://github.com/AztecProtocol/barretenberg/issues/707) Optimize
         // Current gate count: 6398
@@ -74,6 +83,15 @@ element<C, Fq, Fr, G> element<C, Fq, Fr, G>::operator+(const element& other) con
 template <typename C, class Fq, class Fr, class G>
 element<C, Fq, Fr, G> element<C, Fq, Fr, G>::operator-(const element& other) const
 {
+    if constexpr (IsSimulator<C>) {
+        auto context = get_context(other);
+        const typename G::affine_element lhs = get_value();
+        const typename G::affine_element rhs = other.get_value();
+        if (lhs.x == rhs.x) {
+            context->failure("biggroup: x-coordinates of operands are equal in simulated subtraction");
+        }
+        return from_simulated_value(context, typename G::element(lhs) - typename G::element(rhs));
+    }
     if constexpr (IsGoblinBuilder<C> && std::same_as<G, bb::g1>) {
         // TODO(https://github.com/AztecProtocol/barretenberg/issues/707) Optimize
         std::vector<element> points{ *this, other };
@@ -128,6 +146,9 @@ std::array<element<C, Fq, Fr, G>, 2> element<C, Fq, Fr, G>::add_sub(const elemen
 
 template <typename C, class Fq, class Fr, class G> element<C, Fq, Fr, G> element<C, Fq, Fr, G>::dbl() const
 {
+    if constexpr (IsSimulator<C>) {
+        return from_simulated_value(get_context(), typename G::element(get_value()).dbl());
+    }
 
     Fq two_x = x + x;
     if constexpr (G::has_a) {
@@ -610,6 +631,32 @@ std::pair<element<C, Fq, Fr, G>, element<C, Fq, Fr, G>> element<C, Fq, Fr, G>::c
     return std::make_pair<element, element>(offset_generator, offset_generator_end);
 }
 
+/**
+ * @brief Compute a multi-scalar multiplication natively when the builder is a circuit simulator
+ *
+ * @details Every batch mul entry point (batch_mul, wnaf_batch_mul, bn254_endo_batch_mul and scalar multiplication)
+ * dispatches here under simulation. Rather than running the windowed algorithms on constant bigfield limbs, we fetch
+ * the native values and use the native group arithmetic.
+ */
+template <typename C, class Fq, class Fr, class G>
+element<C, Fq, Fr, G> element<C, Fq, Fr, G>::simulated_batch_mul(const std::vector<element>& points,
+                                                                 const std::vector<Fr>& scalars)
+    requires IsSimulator<C>
+{
+    // TODO(https://github.com/AztecProtocol/barretenberg/issues/663)
+    ASSERT(scalars.size() == points.size());
+    C* context = nullptr;
+    typename G::element result = G::one;
+    result.self_set_infinity();
+    for (size_t i = 0; i < points.size(); ++i) {
+        if (context == nullptr) {
+            context = points[i].get_context();
+        }
+        result += typename G::element(points[i].get_value()) * scalars[i].get_value();
+    }
+    return from_simulated_value(context, result);
+}
+
 /**
  * Generic batch multiplication that works for all elliptic curve types.
  *
@@ -622,16 +669,7 @@ element<C, Fq, Fr, G> element<C, Fq, Fr, G>::batch_mul(const std::vector<element
                                                        const size_t max_num_bits)
 {
     if constexpr (IsSimulator<C>) {
-        // TODO(https://github.com/AztecProtocol/barretenberg/issues/663)
-        auto context = points[0].get_context();
-        using element_t = typename G::element;
-        element_t result = G::one;
-        result.self_set_infinity();
-        for (size_t i = 0; i < points.size(); i++) {
-            result += (element_t(points[i].get_value()) * scalars[i].get_value());
-        }
-        result = result.normalize();
-        return from_witness(context, result);
+        return simulated_batch_mul(points, scalars);
     } else {
         // Perform goblinized batched mul if available; supported only for BN254
         if constexpr (IsGoblinBuilder<C> && std::same_as<G, bb::g1>) {
@@ -715,7 +753,9 @@ element<C, Fq, Fr, G> element<C, Fq, Fr, G>::operator*(const Fr& scalar) const
      *
      **/
 
-    if constexpr (IsGoblinBuilder<C> && std::same_as<G, bb::g1>) {
+    if constexpr (IsSimulator<C>) {
+        return simulated_batch_mul({ *this }, { scalar });
+    } else if constexpr (IsGoblinBuilder<C> && std::same_as<G, bb::g1>) {
         std::vector<element> points{ *this };
         std::vector<Fr> scalars{ scalar };
         return goblin_batch_mul(points, scalars);
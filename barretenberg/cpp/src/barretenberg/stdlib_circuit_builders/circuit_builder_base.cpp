@@ -21,19 +21,25 @@ void CircuitBuilderBase<FF>::assert_equal(const uint32_t a_variable_idx,
     if (!values_equal && !failed()) {
         failure(msg);
     }
-    uint32_t a_real_idx = real_variable_index[a_variable_idx];
-    uint32_t b_real_idx = real_variable_index[b_variable_idx];
+    uint32_t a_root = find_variable_class(a_variable_idx);
+    uint32_t b_root = find_variable_class(b_variable_idx);
     // If a==b is already enforced, exit method
-    if (a_real_idx == b_real_idx)
+    if (a_root == b_root)
         return;
-    // Otherwise update the real_idx of b-chain members to that of a
-
-    auto b_start_idx = get_first_variable_in_class(b_variable_idx);
-    update_real_variable_indices(b_start_idx, a_real_idx);
-    // Now merge equivalence classes of a and b by tying last (= real) element of b-chain to first element of a-chain
-    auto a_start_idx = get_first_variable_in_class(a_variable_idx);
-    next_var_index[b_real_idx] = a_start_idx;
-    prev_var_index[a_start_idx] = b_real_idx;
+    uint32_t a_real_idx = variable_class_real_index[a_root];
+    uint32_t b_real_idx = variable_class_real_index[b_root];
+    // Otherwise merge the equivalence classes by hanging the shallower tree below the root of the other one. Whichever
+    // root survives, the real variable of the merged class is that of a.
+    uint32_t new_root = a_root;
+    uint32_t child_root = b_root;
+    if (variable_class_rank[a_root] < variable_class_rank[b_root]) {
+        std::swap(new_root, child_root);
+    } else if (variable_class_rank[a_root] == variable_class_rank[b_root]) {
+        variable_class_rank[a_root]++;
+    }
+    variable_class_parent[child_root] = new_root;
+    variable_class_real_index[new_root] = a_real_idx;
+    public_input_positions_stale = true;
     bool no_tag_clash = (real_variable_tags[a_real_idx] == DUMMY_TAG || real_variable_tags[b_real_idx] == DUMMY_TAG ||
                          real_variable_tags[a_real_idx] == real_variable_tags[b_real_idx]);
     if (!no_tag_clash && !failed()) {
@@ -4,6 +4,7 @@
 #include "barretenberg/plonk_honk_shared/arithmetization/arithmetization.hpp"
 #include "barretenberg/plonk_honk_shared/arithmetization/gate_data.hpp"
 #include "barretenberg/serialize/cbind.hpp"
+#include "forkable_vector.hpp"
 #include <utility>
 
 #include <unordered_map>
@@ -19,16 +20,18 @@ template <typename FF_> class CircuitBuilderBase {
     size_t num_gates = 0;
 
     std::vector<uint32_t> public_inputs;
-    std::vector<FF> variables;
+    // Per-variable data is kept in ForkableVectors, so that builders created by fork() can share it
+    ForkableVector<FF> variables;
     std::unordered_map<uint32_t, std::string> variable_names;
 
-    // index of next variable in equivalence class (=REAL_VARIABLE if you're last)
-    std::vector<uint32_t> next_var_index;
-    // index of  previous variable in equivalence class (=FIRST if you're in a cycle alone)
-    std::vector<uint32_t> prev_var_index;
-    // indices of corresponding real variables
-    std::vector<uint32_t> real_variable_index;
-    std::vector<uint32_t> real_variable_tags;
+    // Equivalence classes of variables (i.e. copy cycles) are kept as a union-find forest. Each variable stores its
+    // parent in the forest; the root of each tree points to itself.
+    ForkableVector<uint32_t> variable_class_parent;
+    // upper bound on the height of the tree below each root (union by rank)
+    ForkableVector<uint8_t> variable_class_rank;
+    // for each root, the index of the real variable of its class. Entries of non-root variables are meaningless.
+    ForkableVector<uint32_t> variable_class_real_index;
+    ForkableVector<uint32_t> real_variable_tags;
     uint32_t current_tag = DUMMY_TAG;
     // The permutation on variable tags. See
     // https://github.com/AztecProtocol/plonk-with-lookups-private/blob/new-stuff/GenPermuations.pdf
@@ -48,16 +51,20 @@ template <typename FF_> class CircuitBuilderBase {
 
     bool _failed = false;
     std::string _err;
-    static constexpr uint32_t REAL_VARIABLE = UINT32_MAX - 1;
-    static constexpr uint32_t FIRST_VARIABLE_IN_CLASS = UINT32_MAX - 2;
+
+    // Lazily built map from the real variable index of each public input to its (first) position in public_inputs
+    std::unordered_map<uint32_t, uint32_t> public_input_positions;
+    size_t num_indexed_public_inputs = 0;
+    // set whenever two classes are merged, since this may change the real variable of an indexed public input
+    bool public_input_positions_stale = false;
 
     CircuitBuilderBase(size_t size_hint = 0)
     {
         variables.reserve(size_hint * 3);
         variable_names.reserve(size_hint * 3);
-        next_var_index.reserve(size_hint * 3);
-        prev_var_index.reserve(size_hint * 3);
-        real_variable_index.reserve(size_hint * 3);
+        variable_class_parent.reserve(size_hint * 3);
+        variable_class_rank.reserve(size_hint * 3);
+        variable_class_real_index.reserve(size_hint * 3);
         real_variable_tags.reserve(size_hint * 3);
     }
 
@@ -83,32 +90,74 @@ template <typename FF_> class CircuitBuilderBase {
     virtual size_t get_num_constant_gates() const = 0;
 
     /**
-     * Get the index of the first variable in class.
+     * Get the root of the equivalence class of a variable, without modifying the forest.
      *
      * @param index The index of the variable you want to look up.
      *
-     * @return The index of the first variable in the same class as the submitted index.
+     * @return The index of the root of the tree containing the variable.
      * */
-    uint32_t get_first_variable_in_class(uint32_t index) const
+    uint32_t get_variable_class_root(uint32_t index) const
     {
-        while (prev_var_index[index] != FIRST_VARIABLE_IN_CLASS) {
-            index = prev_var_index[index];
+        while (variable_class_parent[index] != index) {
+            index = variable_class_parent[index];
         }
         return index;
     }
+
+    /**
+     * Get the root of the equivalence class of a variable, pointing every variable on the path directly at the root
+     * (path compression) so that later lookups are cheaper.
+     *
+     * @param index The index of the variable you want to look up.
+     *
+     * @return The index of the root of the tree containing the variable.
+     * */
+    uint32_t find_variable_class(uint32_t index)
+    {
+        const uint32_t root = get_variable_class_root(index);
+        // Read through a const reference, so that a fork only copies the shared entries it actually changes
+        const auto& parents = std::as_const(variable_class_parent);
+        while (parents[index] != root) {
+            const uint32_t parent = parents[index];
+            variable_class_parent[index] = root;
+            index = parent;
+        }
+        return root;
+    }
+
     /**
-     * Update all variables from index in equivalence class to have real variable new_real_index.
+     * Get the index of the real variable of the equivalence class of v_{index}, i.e. the variable whose value and tag
+     * represent the whole class.
      *
-     * @param index The index of a variable in the class we're updating.
-     * @param new_real_index The index of the real variable to update to.
+     * @param index The index of the variable.
+     * @return The index of the real variable.
+     * */
+    uint32_t get_real_variable_index(const uint32_t index) const
+    {
+        return variable_class_real_index[get_variable_class_root(index)];
+    }
+
+    /**
+     * Get the real variable index of every variable, i.e. the encoding of all copy constraints of the circuit.
+     * */
+    std::vector<uint32_t> get_real_variable_indices() const
+    {
+        std::vector<uint32_t> result(variables.size());
+        for (size_t i = 0; i < variables.size(); ++i) {
+            result[i] = get_real_variable_index(static_cast<uint32_t>(i));
+        }
+        return result;
+    }
+
+    /**
+     * Point every variable directly at the root of its class, so that subsequent real variable lookups (e.g. once per
+     * wire when the copy cycles are constructed) are a single indirection.
      * */
-    void update_real_variable_indices(uint32_t index, uint32_t new_real_index)
+    void compress_variable_classes()
     {
-        auto cur_index = index;
-        do {
-            real_variable_index[cur_index] = new_real_index;
-            cur_index = next_var_index[cur_index];
-        } while (cur_index != REAL_VARIABLE);
+        for (size_t i = 0; i < variable_class_parent.size(); ++i) {
+            find_variable_class(static_cast<uint32_t>(i));
+        }
     }
 
     /**
@@ -121,7 +170,7 @@ template <typename FF_> class CircuitBuilderBase {
     inline FF get_variable(const uint32_t index) const
     {
         ASSERT(variables.size() > index);
-        return variables[real_variable_index[index]];
+        return variables[get_real_variable_index(index)];
     }
 
     /**
@@ -135,20 +184,30 @@ template <typename FF_> class CircuitBuilderBase {
     inline const FF& get_variable_reference(const uint32_t index) const
     {
         ASSERT(variables.size() > index);
-        return variables[real_variable_index[index]];
+        return variables[get_real_variable_index(index)];
     }
 
-    uint32_t get_public_input_index(const uint32_t witness_index) const
+    /**
+     * Get the position in public_inputs of the (first) public input which is equal to v_{witness_index} by copy
+     * constraint.
+     *
+     * @details Looks the witness up in a hash index of the public inputs keyed by real variable index. The index is
+     * extended with any public inputs added since the last call, and rebuilt if equivalence classes have been merged.
+     * */
+    uint32_t get_public_input_index(const uint32_t witness_index)
     {
-        uint32_t result = static_cast<uint32_t>(-1);
-        for (size_t i = 0; i < public_inputs.size(); ++i) {
-            if (real_variable_index[public_inputs[i]] == real_variable_index[witness_index]) {
-                result = static_cast<uint32_t>(i);
-                break;
-            }
+        if (public_input_positions_stale || num_indexed_public_inputs > public_inputs.size()) {
+            public_input_positions.clear();
+            num_indexed_public_inputs = 0;
+            public_input_positions_stale = false;
         }
-        ASSERT(result != static_cast<uint32_t>(-1));
-        return result;
+        for (; num_indexed_public_inputs < public_inputs.size(); ++num_indexed_public_inputs) {
+            public_input_positions.try_emplace(get_real_variable_index(public_inputs[num_indexed_public_inputs]),
+                                               static_cast<uint32_t>(num_indexed_public_inputs));
+        }
+        auto it = public_input_positions.find(get_real_variable_index(witness_index));
+        ASSERT(it != public_input_positions.end());
+        return it->second;
     }
 
     FF get_public_input(const uint32_t index) const { return get_variable(public_inputs[index]); }
@@ -175,9 +234,9 @@ template <typename FF_> class CircuitBuilderBase {
         // By default, we assume each new variable belongs in its own copy-cycle. These defaults can be modified later
         // by `assert_equal`.
         const uint32_t index = static_cast<uint32_t>(variables.size()) - 1U;
-        real_variable_index.emplace_back(index);
-        next_var_index.emplace_back(REAL_VARIABLE);
-        prev_var_index.emplace_back(FIRST_VARIABLE_IN_CLASS);
+        variable_class_parent.emplace_back(index);
+        variable_class_rank.emplace_back(0);
+        variable_class_real_index.emplace_back(index);
         real_variable_tags.emplace_back(DUMMY_TAG);
         return index;
     }
@@ -192,42 +251,43 @@ template <typename FF_> class CircuitBuilderBase {
     virtual void set_variable_name(uint32_t index, const std::string& name)
     {
         ASSERT(variables.size() > index);
-        uint32_t first_idx = get_first_variable_in_class(index);
+        uint32_t real_idx = get_real_variable_index(index);
 
-        if (variable_names.contains(first_idx)) {
+        if (variable_names.contains(real_idx)) {
             failure("Attempted to assign a name to a variable that already has a name");
             return;
         }
-        variable_names.insert({ first_idx, name });
+        variable_names.insert({ real_idx, name });
     }
 
     /**
      * After assert_equal() merge two class names if present.
-     * Preserves the first name in class.
+     * Preserves the name of the real variable of the class.
      *
      * @param index Index of the variable you have previously named and used in assert_equal.
      *
      */
     virtual void update_variable_names(uint32_t index)
     {
-        uint32_t first_idx = get_first_variable_in_class(index);
+        uint32_t real_idx = get_real_variable_index(index);
 
-        uint32_t cur_idx = next_var_index[first_idx];
-        while (cur_idx != REAL_VARIABLE && !variable_names.contains(cur_idx)) {
-            cur_idx = next_var_index[cur_idx];
-        }
+        // Names are keyed by the real variable of the class at the time they were assigned, so look for a name given
+        // to another member of the class
+        auto other = std::find_if(variable_names.begin(), variable_names.end(), [&](const auto& entry) {
+            return entry.first != real_idx && get_real_variable_index(entry.first) == real_idx;
+        });
 
-        if (variable_names.contains(first_idx)) {
-            if (cur_idx != REAL_VARIABLE) {
-                variable_names.extract(cur_idx);
+        if (variable_names.contains(real_idx)) {
+            if (other != variable_names.end()) {
+                variable_names.erase(other);
             }
             return;
         }
 
-        if (cur_idx != REAL_VARIABLE) {
-            std::string var_name = variable_names.find(cur_idx)->second;
-            variable_names.erase(cur_idx);
-            variable_names.insert({ first_idx, var_name });
+        if (other != variable_names.end()) {
+            std::string var_name = other->second;
+            variable_names.erase(other);
+            variable_names.insert({ real_idx, var_name });
             return;
         }
         failure("No previously assigned names found");
@@ -245,7 +305,7 @@ template <typename FF_> class CircuitBuilderBase {
 
         for (auto& tup : variable_names) {
             keys.push_back(tup.first);
-            firsts.push_back(get_first_variable_in_class(tup.first));
+            firsts.push_back(get_real_variable_index(tup.first));
         }
 
         for (size_t i = 0; i < keys.size() - 1; i++) {
@@ -376,7 +436,7 @@ template <typename FF_> class CircuitBuilderBase {
         contains_recursive_proof = true;
         for (size_t i = 0; i < proof_output_witness_indices.size(); ++i) {
             recursive_proof_public_input_indices.push_back(
-                get_public_input_index(real_variable_index[proof_output_witness_indices[i]]));
+                get_public_input_index(get_real_variable_index(proof_output_witness_indices[i])));
         }
     }
 
@@ -532,24 +592,20 @@ template <typename FF_> class CircuitBuilderBase {
  * These vectors imply copy-cycles between variables. ("copy-cycle" meaning "a set of variables which must always be
  * equal"). The indices of these vectors correspond to those of the `variables` vector. Each index contains
  * information about the corresponding variable.
- *   - next_var_index = [ -1,  -1,  -1,  -1,  -1,  -1,  -1,   6]
- *   - prev_var_index = [ -2,  -2,  -2,  -2,  -2,  -2,   7,  -2]
- *   - real_var_index = [  0,   1,   2,   3,   4,   5,   6,   6] <-- Notice this repeated 6.
+ *   - variable_class_parent     = [  0,   1,   2,   3,   4,   5,   6,   6] <-- Notice this repeated 6.
+ *   - variable_class_rank       = [  0,   0,   0,   0,   0,   0,   1,   0]
+ *   - variable_class_real_index = [  0,   1,   2,   3,   4,   5,   6,   -]
  *
- *   `-1` = "The variable at this index is considered the last in its cycle (no next variable exists)"
- *          Note: we (arbitrarily) consider the "last" variable in a cycle to be the true representative of its
- *          cycle, and so dub it the "real" variable of the cycle.
- *   `-2` = "The variable at this index is considered the first in its cycle (no previous variable exists)"
- *   Any other number denotes the index of another variable in the cycle = "The variable at this index is equal to
- *   the variable at this other index".
+ * The copy-cycles are stored as a union-find forest: each variable points at its parent, and the root of each tree
+ * (a variable which is its own parent) stands for the whole cycle. The root records the "real" variable of the cycle,
+ * i.e. the variable whose value (and tag) is the value of every variable in the cycle.
  *
  * By default, when a variable is added to the composer, we assume the variable is in a copy-cycle of its own. So
- * we set `next_var_index = -1`, `prev_var_index = -2`, `real_var_index` = the index of the variable in `variables`.
- * You can see in our example that all but the last two indices of each *_index vector contain the default values.
- * In our example, we have `variables[6].assert_equal(variables[7])`. The `assert_equal` function modifies the above
- * vectors' entries for variables 6 & 7 to imply a copy-cycle between them. Arbitrarily, variables[7] is deemed the
- * "first" in the cycle and variables[6] is considered the last (and hence the "real" variable which represents the
- * cycle).
+ * we set `variable_class_parent` and `variable_class_real_index` to the index of the variable in `variables`, and
+ * `variable_class_rank = 0`. In our example, we have `variables[6].assert_equal(variables[7])`. The `assert_equal`
+ * function hangs the tree of lower rank below the root of the other (here the ranks are equal, so 7 is hung below 6
+ * and the rank of 6 goes up), and keeps the real variable of the first argument, 6, as the real variable of the
+ * merged cycle. Lookups compress the paths they walk, so the trees stay very shallow.
  *
  * By the time we get to computing wire copy-cycles, we need to allow for public_inputs, which in the plonk protocol
  * are positioned to be the first witness values. `variables` doesn't include these public inputs (they're stored
@@ -0,0 +1,137 @@
+#pragma once
+#include "barretenberg/common/assert.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace bb {
+
+/**
+ * @brief A vector whose first entries may be shared, read-only, with another vector, so that a builder created by
+ * fork() does not have to copy the (per-variable) data of the builder it was forked from
+ *
+ * @details An ordinary ForkableVector stores all of its entries itself. A vector created by fork_of() or
+ * fork_with_defaults() instead starts with a prefix of shared entries, which read as the corresponding entries of
+ * another ForkableVector or as default values. Writing to a shared entry stores a copy of it (copy-on-write), which
+ * written_shared_entries() exposes, e.g. so that the writes can be carried over to the vector forked from. Entries
+ * appended to a fork are stored contiguously, as in an ordinary vector.
+ *
+ * A vector forked from another one reads the entries of the latter at their current values, so it must not outlive
+ * it; the other vector may grow in the meantime.
+ */
+template <typename T> class ForkableVector {
+  public:
+    // Small entries (e.g. indices) are returned by value, so that default shared entries need no storage
+    using const_reference = std::conditional_t<(sizeof(T) <= sizeof(uint64_t)), T, const T&>;
+
+    ForkableVector() = default;
+
+    static ForkableVector fork_of(const ForkableVector& other)
+    {
+        ForkableVector result;
+        result.shared = &other;
+        result.shared_size = other.size();
+        return result;
+    }
+
+    /**
+     * @brief A vector of size shared_size whose entries read as their own index if identity is set, and as T{}
+     * otherwise
+     */
+    static ForkableVector fork_with_defaults(const size_t shared_size, const bool identity)
+        requires std::is_integral_v<T>
+    {
+        ForkableVector result;
+        result.shared_size = shared_size;
+        result.identity = identity;
+        return result;
+    }
+
+    size_t size() const { return shared_size + local.size(); }
+    size_t num_shared() const { return shared_size; }
+    void reserve(const size_t new_capacity)
+    {
+        if (new_capacity > shared_size) {
+            local.reserve(new_capacity - shared_size);
+        }
+    }
+    template <typename... Args> T& emplace_back(Args&&... args) { return local.emplace_back(std::forward<Args>(args)...); }
+    void push_back(const T& value) { local.push_back(value); }
+
+    const_reference operator[](const size_t index) const
+    {
+        if (index >= shared_size) {
+            return local[index - shared_size];
+        }
+        if (auto written = written_shared.find(index); written != written_shared.end()) {
+            return written->second;
+        }
+        return read_shared(index);
+    }
+
+    T& operator[](const size_t index)
+    {
+        if (index >= shared_size) {
+            return local[index - shared_size];
+        }
+        if (auto written = written_shared.find(index); written != written_shared.end()) {
+            return written->second;
+        }
+        return written_shared.emplace(index, read_shared(index)).first->second;
+    }
+
+    // The shared entries which have been written to (or accessed through a non-const reference)
+    const std::unordered_map<size_t, T>& written_shared_entries() const { return written_shared; }
+
+    // Iteration is only supported by vectors which store all of their entries
+    auto begin() const
+    {
+        ASSERT(shared_size == 0);
+        return local.begin();
+    }
+    auto end() const
+    {
+        ASSERT(shared_size == 0);
+        return local.end();
+    }
+
+    bool operator==(const ForkableVector& other) const
+    {
+        if (size() != other.size()) {
+            return false;
+        }
+        if (shared_size == 0 && other.shared_size == 0) {
+            return local == other.local;
+        }
+        for (size_t i = 0; i < size(); ++i) {
+            if ((*this)[i] != other[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+  private:
+    const_reference read_shared(const size_t index) const
+    {
+        if (shared != nullptr) {
+            return (*shared)[index];
+        }
+        if constexpr (std::is_integral_v<T>) {
+            return identity ? static_cast<T>(index) : T{};
+        } else {
+            ASSERT(false);
+            return local[0];
+        }
+    }
+
+    std::vector<T> local;
+    const ForkableVector* shared = nullptr;
+    size_t shared_size = 0;
+    bool identity = false;
+    std::unordered_map<size_t, T> written_shared;
+};
+
+} // namespace bb
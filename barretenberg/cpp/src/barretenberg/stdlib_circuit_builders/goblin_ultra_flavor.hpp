@@ -77,6 +77,8 @@ class GoblinUltraFlavor {
     static constexpr size_t BATCHED_RELATION_PARTIAL_LENGTH = MAX_PARTIAL_RELATION_LENGTH + 1;
     static constexpr size_t BATCHED_RELATION_TOTAL_LENGTH = MAX_TOTAL_RELATION_LENGTH + 1;
     static constexpr size_t NUM_RELATIONS = std::tuple_size_v<Relations>;
+    // Number of edges the sumcheck prover evaluates the relations on at once (see SumcheckProverRound)
+    static constexpr size_t SUMCHECK_EDGE_BATCH_SIZE = 4;
 
     // For instances of this flavour, used in folding, we need a unique sumcheck batching challenges for each
     // subrelation. This
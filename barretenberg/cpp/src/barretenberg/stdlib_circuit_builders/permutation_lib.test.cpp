@@ -1,5 +1,6 @@
 #include "barretenberg/plonk_honk_shared/composer/permutation_lib.hpp"
 #include "barretenberg/plonk_honk_shared/composer/composer_lib.hpp"
+#include "barretenberg/numeric/random/engine.hpp"
 #include "barretenberg/plonk_honk_shared/types/circuit_type.hpp"
 #include "barretenberg/srs/global_crs.hpp"
 #include "barretenberg/stdlib_circuit_builders/ultra_flavor.hpp"
@@ -79,8 +80,69 @@ TEST_F(PermutationHelperTests, ComputeHonkStyleSigmaLagrangePolynomialsFromMappi
         proving_key->polynomials.get_sigmas(), mapping.sigmas, proving_key.get());
 }
 
+TEST_F(PermutationHelperTests, CopyCyclesAreSortedByVariableThenPosition)
+{
+    // Nodes of variables 0, 2 and 3 (variables 1 and 4 have none), not in trace order
+    std::vector<uint64_t> nodes{ CopyCycles::make_node(2, 5, 1), CopyCycles::make_node(0, 3, 0),
+                                 CopyCycles::make_node(2, 1, 3), CopyCycles::make_node(3, 0, 2),
+                                 CopyCycles::make_node(2, 4, 0), CopyCycles::make_node(0, 1, 2) };
+    CopyCycles copy_cycles(nodes, 5);
+
+    EXPECT_EQ(copy_cycles.num_cycles(), 5);
+    EXPECT_EQ(copy_cycles.offsets, (std::vector<uint32_t>{ 0, 2, 2, 5, 6, 6 }));
+    const std::vector<std::pair<uint32_t, uint32_t>> expected_positions{ { 1, 2 }, { 3, 0 }, { 1, 3 },
+                                                                         { 4, 0 }, { 5, 1 }, { 0, 2 } };
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        EXPECT_EQ(CopyCycles::get_row(copy_cycles.nodes[i]), expected_positions[i].first);
+        EXPECT_EQ(CopyCycles::get_column(copy_cycles.nodes[i]), expected_positions[i].second);
+    }
+
+    // Every cycle points each node to the next one in trace order, and the last one back to the first
+    auto mapping = compute_permutation_mapping<Flavor, /*generalized=*/false>(
+        circuit_constructor, proving_key.get(), copy_cycles);
+    EXPECT_EQ(mapping.sigmas[2][1], (permutation_subgroup_element{ 3, 0 }));
+    EXPECT_EQ(mapping.sigmas[0][3], (permutation_subgroup_element{ 1, 2 }));
+    EXPECT_EQ(mapping.sigmas[3][1], (permutation_subgroup_element{ 4, 0 }));
+    EXPECT_EQ(mapping.sigmas[0][4], (permutation_subgroup_element{ 5, 1 }));
+    EXPECT_EQ(mapping.sigmas[1][5], (permutation_subgroup_element{ 1, 3 }));
+    EXPECT_EQ(mapping.sigmas[2][0], (permutation_subgroup_element{ 0, 2 }));
+    EXPECT_EQ(mapping.sigmas[3][7], (permutation_subgroup_element{ 7, 3 }));
+}
+
 TEST_F(PermutationHelperTests, ComputeStandardAuxPolynomials)
 {
     // TODO(#425) Flesh out these tests
     compute_first_and_last_lagrange_polynomials<FF>(1024);
 }
+
+/**
+ * @brief Test that the nodes end up sorted however many chunks they are sorted in, in particular when there are fewer
+ * nodes than threads (as for a small circuit on a host with many cores), so that the number of chunks is not a power of
+ * 2
+ *
+ */
+TEST_F(PermutationHelperTests, CopyCyclesAreSortedForAnyNumberOfChunks)
+{
+    auto& engine = numeric::get_debug_randomness();
+    const uint32_t num_variables = 16;
+    const std::vector<size_t> max_num_chunks_values{ 1, 3, 8, 64, 128 };
+    const std::vector<size_t> num_nodes_values{ 0, 1, 5, 60, 80, 100, 127, 128, 129, 300 };
+    for (const size_t max_num_chunks : max_num_chunks_values) {
+        for (const size_t num_nodes : num_nodes_values) {
+            std::vector<uint64_t> nodes(num_nodes);
+            for (auto& node : nodes) {
+                node = CopyCycles::make_node(engine.get_random_uint32() % num_variables,
+                                             engine.get_random_uint32() % (1U << 20),
+                                             engine.get_random_uint32() % 4);
+            }
+            CopyCycles copy_cycles(nodes, num_variables, max_num_chunks);
+
+            std::sort(nodes.begin(), nodes.end());
+            EXPECT_EQ(copy_cycles.nodes, nodes) << num_nodes << " nodes in " << max_num_chunks << " chunks";
+            for (size_t variable = 0; variable <= num_variables; ++variable) {
+                const auto first_node = std::lower_bound(nodes.begin(), nodes.end(), uint64_t(variable) << 32);
+                EXPECT_EQ(copy_cycles.offsets[variable], static_cast<uint32_t>(first_node - nodes.begin()));
+            }
+        }
+    }
+}
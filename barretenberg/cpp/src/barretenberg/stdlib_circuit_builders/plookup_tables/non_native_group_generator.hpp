@@ -23,8 +23,8 @@ template <typename G1> class ecc_generator_table {
     inline static std::array<std::pair<fr, fr>, 256> generator_yhi_table;
     inline static std::array<std::pair<fr, fr>, 256> generator_xyprime_table;
     inline static std::array<std::pair<fr, fr>, 256> generator_endo_xyprime_table;
-    inline static bool init = false;
 
+    // Computes the tables on first use; thread-safe, e.g. for circuits built in parallel
     static void init_generator_tables();
 
     static size_t convert_position_to_shifted_naf(const size_t position);
@@ -53,6 +53,9 @@ template <typename G1> class ecc_generator_table {
     static MultiTable get_yhi_table(const MultiTableId id, const BasicTableId basic_id);
     static MultiTable get_xyprime_table(const MultiTableId id, const BasicTableId basic_id);
     static MultiTable get_xyprime_endo_table(const MultiTableId id, const BasicTableId basic_id);
+
+  private:
+    static void compute_generator_tables();
 };
 
 } // namespace bb::plookup::ecc_generator_tables
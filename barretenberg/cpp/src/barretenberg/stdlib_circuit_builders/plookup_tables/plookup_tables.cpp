@@ -1,6 +1,8 @@
 #include "plookup_tables.hpp"
 #include "barretenberg/common/constexpr_utils.hpp"
+#include <atomic>
 #include <mutex>
+#include <optional>
 namespace bb::plookup {
 
 using namespace bb;
@@ -9,8 +11,9 @@ namespace {
 // TODO(@zac-williamson) convert these into static const members of a struct
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 std::array<MultiTable, MultiTableId::NUM_MULTI_TABLES> MULTI_TABLES;
+// Atomic since it is read without the lock below, e.g. by circuits being built concurrently
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
-bool initialised = false;
+std::atomic<bool> initialised = false;
 #ifndef NO_MULTITHREADING
 
 // The multitables initialisation procedure is not thread-sage, so we need to make sure only 1 thread gets to initialize
@@ -109,7 +112,40 @@ void init_multi_tables()
     MULTI_TABLES[MultiTableId::HONK_DUMMY_MULTI] = dummy_tables::get_honk_dummy_multitable();
     initialised = true;
 }
+
+// The contents of every basic table that has been generated so far, see `create_basic_table`
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+std::array<std::optional<BasicTable>, BasicTableId::NUM_BASIC_TABLES> BASIC_TABLES;
+#ifndef NO_MULTITHREADING
+// One flag per table, so that circuits being built concurrently can generate different tables at the same time
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+std::array<std::once_flag, BasicTableId::NUM_BASIC_TABLES> basic_table_flags;
+#endif
 } // namespace
+
+BasicTable create_basic_table(const BasicTableId id, const size_t index)
+{
+    if (static_cast<size_t>(id) >= BASIC_TABLES.size()) {
+        throw_or_abort("table id does not exist");
+    }
+    auto& cached_table = BASIC_TABLES[id];
+#ifndef NO_MULTITHREADING
+    std::call_once(basic_table_flags[id], [&]() {
+        cached_table = generate_basic_table(id, 0);
+        cached_table->index_keys();
+    });
+#else
+    if (!cached_table.has_value()) {
+        cached_table = generate_basic_table(id, 0);
+        cached_table->index_keys();
+    }
+#endif
+    // Copying the table shares its columns and key index with the cached one
+    BasicTable table = *cached_table;
+    table.table_index = index;
+    return table;
+}
+
 const MultiTable& create_table(const MultiTableId id)
 {
     if (!initialised) {
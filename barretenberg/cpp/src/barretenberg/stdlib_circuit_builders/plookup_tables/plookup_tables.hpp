@@ -25,7 +25,18 @@ ReadData<bb::fr> get_lookup_accumulators(MultiTableId id,
                                          const bb::fr& key_b = 0,
                                          bool is_2_to_1_lookup = false);
 
-inline BasicTable create_basic_table(const BasicTableId id, const size_t index)
+/**
+ * @brief Get the basic table with the given id, positioned at `index` in a circuit's list of lookup tables
+ *
+ * @details The table contents are generated once per process and shared by every table returned for the same id; only
+ * the `table_index` and the (initially empty) record of lookup gates belong to the returned copy.
+ */
+BasicTable create_basic_table(BasicTableId id, size_t index);
+
+/**
+ * @brief Compute the contents of the basic table with the given id. Prefer `create_basic_table`, which caches them.
+ */
+inline BasicTable generate_basic_table(const BasicTableId id, const size_t index)
 {
     // we have >50 basic fixed base tables so we match with some logic instead of a switch statement
     auto id_var = static_cast<size_t>(id);
@@ -1,6 +1,9 @@
 #pragma once
 
+#include <algorithm>
 #include <array>
+#include <memory>
+#include <optional>
 #include <vector>
 
 #include "./fixed_base/fixed_base_params.hpp"
@@ -73,6 +76,7 @@ enum BasicTableId {
     KECCAK_RHO_7,
     KECCAK_RHO_8,
     KECCAK_RHO_9,
+    NUM_BASIC_TABLES,
 };
 
 enum MultiTableId {
@@ -254,6 +258,43 @@ struct MultiTable {
 
 // }
 
+/**
+ * @brief A column of a basic table, whose storage is shared between all copies of the table
+ *
+ * @details Basic tables are generated once per process (see `create_basic_table`) and then copied into every circuit
+ * that uses them. Copies share the underlying vector; it is only duplicated if a copy is modified, which only happens
+ * while a table is being generated.
+ */
+class BasicTableColumn {
+  public:
+    void emplace_back(const bb::fr& value) { get_mutable_values().emplace_back(value); }
+    void reserve(const size_t new_capacity) { get_mutable_values().reserve(new_capacity); }
+
+    size_t size() const { return values ? values->size() : 0; }
+    const bb::fr& operator[](const size_t idx) const { return (*values)[idx]; }
+    const bb::fr* data() const { return values ? values->data() : nullptr; }
+    const bb::fr* begin() const { return data(); }
+    const bb::fr* end() const { return data() + size(); }
+
+    bool operator==(const BasicTableColumn& other) const
+    {
+        return values == other.values || (size() == other.size() && std::equal(begin(), end(), other.begin()));
+    }
+
+  private:
+    std::vector<bb::fr>& get_mutable_values()
+    {
+        if (!values) {
+            values = std::make_shared<std::vector<bb::fr>>();
+        } else if (values.use_count() > 1) {
+            values = std::make_shared<std::vector<bb::fr>>(*values);
+        }
+        return *values;
+    }
+
+    std::shared_ptr<std::vector<bb::fr>> values;
+};
+
 /**
  * @brief The structure contains the most basic table serving one function (for, example an xor table)
  *
@@ -293,14 +334,129 @@ struct BasicTable {
     bb::fr column_1_step_size = bb::fr(0);
     bb::fr column_2_step_size = bb::fr(0);
     bb::fr column_3_step_size = bb::fr(0);
-    std::vector<bb::fr> column_1;
-    std::vector<bb::fr> column_3;
-    std::vector<bb::fr> column_2;
-    std::vector<KeyEntry> lookup_gates;
+    BasicTableColumn column_1;
+    BasicTableColumn column_3;
+    BasicTableColumn column_2;
+
+    /**
+     * @brief The keys of the table in sorted order, used to find the row read by a lookup
+     *
+     * @details A key is the first column, and for tables with twin keys also the second one, as 64-bit integers. The
+     * index is shared between all copies of a table, like the columns.
+     */
+    struct KeyIndex {
+        std::vector<std::array<uint64_t, 2>> sorted_keys;
+        // rows[i] is the row whose key is sorted_keys[i]
+        std::vector<uint32_t> rows;
+    };
+    std::shared_ptr<const KeyIndex> key_index;
+
+    // The lookup gates reading from this table, recorded as the number of gates reading each row (empty until the
+    // first lookup)
+    size_t num_lookup_gates = 0;
+    std::vector<uint32_t> lookup_read_counts;
+    // Lookup gates whose entry is not a row of the table, which can only occur in unsatisfiable circuits
+    std::vector<KeyEntry> unmatched_lookup_gates;
 
     std::array<bb::fr, 2> (*get_values_from_key)(const std::array<uint64_t, 2>);
 
     bool operator==(const BasicTable& other) const = default;
+
+    /**
+     * @brief The entry of a row of the table, in the form of the entries recorded by lookup gates
+     */
+    KeyEntry get_row_entry(const size_t row) const
+    {
+        if (use_twin_keys) {
+            return { { column_1[row].from_montgomery_form().data[0], column_2[row].from_montgomery_form().data[0] },
+                     { column_3[row], 0 } };
+        }
+        return { { column_1[row].from_montgomery_form().data[0], 0 }, { column_2[row], column_3[row] } };
+    }
+
+    /**
+     * @brief Construct the key index of the table, once its columns are complete
+     */
+    void index_keys()
+    {
+        std::vector<std::pair<std::array<uint64_t, 2>, uint32_t>> keyed_rows(size);
+        for (size_t row = 0; row < size; ++row) {
+            const auto entry = get_row_entry(row);
+            keyed_rows[row] = { { entry.key[0].data[0], entry.key[1].data[0] }, static_cast<uint32_t>(row) };
+        }
+        std::sort(keyed_rows.begin(), keyed_rows.end());
+
+        auto index = std::make_shared<KeyIndex>();
+        index->sorted_keys.reserve(size);
+        index->rows.reserve(size);
+        for (const auto& [key, row] : keyed_rows) {
+            index->sorted_keys.emplace_back(key);
+            index->rows.emplace_back(row);
+        }
+        key_index = std::move(index);
+    }
+
+    /**
+     * @brief Find the row of the table whose entry is `entry`, if any
+     */
+    std::optional<uint32_t> find_row(const KeyEntry& entry) const
+    {
+        const auto fits_in_64_bits = [](const uint256_t& value) {
+            return (value.data[1] | value.data[2] | value.data[3]) == 0;
+        };
+        if (!key_index || !fits_in_64_bits(entry.key[0]) || (use_twin_keys && !fits_in_64_bits(entry.key[1]))) {
+            return std::nullopt;
+        }
+        // The second key of a lookup into a table with a single key is ignored, as in the sorted list
+        const std::array<uint64_t, 2> key{ entry.key[0].data[0], use_twin_keys ? entry.key[1].data[0] : 0 };
+        const auto& sorted_keys = key_index->sorted_keys;
+        const auto it = std::lower_bound(sorted_keys.begin(), sorted_keys.end(), key);
+        if (it == sorted_keys.end() || *it != key) {
+            return std::nullopt;
+        }
+        const uint32_t row = key_index->rows[static_cast<size_t>(it - sorted_keys.begin())];
+        // Only the values that appear in the sorted list need to match
+        const auto row_entry = get_row_entry(row);
+        if (row_entry.value[0] != entry.value[0] || (!use_twin_keys && row_entry.value[1] != entry.value[1])) {
+            return std::nullopt;
+        }
+        return row;
+    }
+
+    /**
+     * @brief Record a lookup gate reading `entry` from the table
+     */
+    void record_lookup(const KeyEntry& entry)
+    {
+        ++num_lookup_gates;
+        const auto row = find_row(entry);
+        if (!row.has_value()) {
+            unmatched_lookup_gates.emplace_back(entry);
+            return;
+        }
+        if (lookup_read_counts.empty()) {
+            lookup_read_counts.resize(size);
+        }
+        ++lookup_read_counts[*row];
+    }
+
+    /**
+     * @brief Add the lookup gates recorded by another copy of the same table
+     */
+    void merge_lookups(const BasicTable& other)
+    {
+        num_lookup_gates += other.num_lookup_gates;
+        if (!other.lookup_read_counts.empty()) {
+            if (lookup_read_counts.empty()) {
+                lookup_read_counts.resize(size);
+            }
+            for (size_t row = 0; row < size; ++row) {
+                lookup_read_counts[row] += other.lookup_read_counts[row];
+            }
+        }
+        unmatched_lookup_gates.insert(
+            unmatched_lookup_gates.end(), other.unmatched_lookup_gates.begin(), other.unmatched_lookup_gates.end());
+    }
 };
 
 enum ColumnIdx { C1, C2, C3 };
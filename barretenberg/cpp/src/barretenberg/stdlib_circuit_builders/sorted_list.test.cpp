@@ -0,0 +1,68 @@
+#include "barretenberg/numeric/random/engine.hpp"
+#include "barretenberg/plonk_honk_shared/composer/composer_lib.hpp"
+#include "barretenberg/stdlib_circuit_builders/ultra_flavor.hpp"
+#include <gtest/gtest.h>
+#include <map>
+
+using namespace bb;
+
+namespace {
+auto& engine = numeric::get_debug_randomness();
+}
+
+/**
+ * @brief The sorted list polynomials are the lookup gate entries and the table entries, sorted table by table
+ * @details Lookups of valid entries are recorded as read counts, so the sorted list is produced by counting; a table
+ * with an entry that is not in it falls back to sorting. Both must agree with sorting all the entries directly.
+ */
+TEST(SortedListTests, MatchesSortedLookupEntries)
+{
+    using Flavor = UltraFlavor;
+    using FF = Flavor::FF;
+    using KeyEntry = plookup::BasicTable::KeyEntry;
+    Flavor::CircuitBuilder circuit_constructor;
+    std::map<plookup::BasicTableId, std::vector<KeyEntry>> lookup_entries;
+
+    const auto& multi_table = plookup::create_table(plookup::MultiTableId::UINT32_XOR);
+    for (size_t i = 0; i < 10; ++i) {
+        const FF left = engine.get_random_uint32();
+        const FF right = engine.get_random_uint32();
+        const auto accumulators =
+            plookup::get_lookup_accumulators(plookup::MultiTableId::UINT32_XOR, left, right, /*is_2_to_1_lookup=*/true);
+        circuit_constructor.create_gates_from_plookup_accumulators(plookup::MultiTableId::UINT32_XOR,
+                                                                   accumulators,
+                                                                   circuit_constructor.add_variable(left),
+                                                                   circuit_constructor.add_variable(right));
+        for (size_t j = 0; j < accumulators.key_entries.size(); ++j) {
+            lookup_entries[multi_table.lookup_ids[j]].emplace_back(accumulators.key_entries[j]);
+        }
+    }
+    // An entry that is not in the first table
+    auto& unmatched_table = circuit_constructor.lookup_tables[0];
+    const KeyEntry unmatched_entry{ { 1, 2 }, { 5, 0 } };
+    unmatched_table.record_lookup(unmatched_entry);
+    lookup_entries[unmatched_table.id].emplace_back(unmatched_entry);
+    EXPECT_EQ(unmatched_table.unmatched_lookup_gates.size(), 1);
+
+    const size_t num_entries = circuit_constructor.get_tables_size() + circuit_constructor.get_lookups_size();
+    const size_t dyadic_circuit_size = circuit_constructor.get_circuit_subgroup_size(num_entries + 1);
+    auto sorted_polynomials = construct_sorted_list_polynomials<Flavor>(circuit_constructor, dyadic_circuit_size);
+
+    size_t s_index = dyadic_circuit_size - num_entries;
+    for (const auto& table : circuit_constructor.lookup_tables) {
+        auto entries = lookup_entries[table.id];
+        for (size_t i = 0; i < table.size; ++i) {
+            entries.emplace_back(table.get_row_entry(i));
+        }
+        std::sort(entries.begin(), entries.end());
+        for (const auto& entry : entries) {
+            const auto components = entry.to_sorted_list_components(table.use_twin_keys);
+            EXPECT_EQ(sorted_polynomials[0][s_index], components[0]);
+            EXPECT_EQ(sorted_polynomials[1][s_index], components[1]);
+            EXPECT_EQ(sorted_polynomials[2][s_index], components[2]);
+            EXPECT_EQ(sorted_polynomials[3][s_index], FF(table.table_index));
+            ++s_index;
+        }
+    }
+    EXPECT_EQ(s_index, dyadic_circuit_size);
+}
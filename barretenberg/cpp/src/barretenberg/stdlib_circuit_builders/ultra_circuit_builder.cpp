@@ -6,7 +6,9 @@
  *
  */
 #include "ultra_circuit_builder.hpp"
+#include "barretenberg/common/zip_view.hpp"
 #include <barretenberg/plonk/proof_system/constants.hpp>
+#include <numeric>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -48,6 +50,293 @@ template <typename Arithmetization> void UltraCircuitBuilder_<Arithmetization>::
     }
 }
 
+/**
+ * @brief Create a builder which shares the variables of this one, to which constraints can be added independently of
+ * (e.g. concurrently with) this builder before being moved into it with merge()
+ *
+ * @details The fork shares the variables existing at the time of the fork with this builder rather than copying them:
+ * it reads their values from this builder, and keeps copies of only those (values or union-find entries) it modifies.
+ * Each shared variable starts in its own equivalence class, and the fork knows the constant variables of this builder.
+ * Variables created by the fork are local to it until it is merged. This builder must outlive the fork and must not be
+ * modified while the fork is in use, other than by merging forks.
+ */
+template <typename Arithmetization>
+UltraCircuitBuilder_<Arithmetization> UltraCircuitBuilder_<Arithmetization>::fork(const size_t size_hint) const
+{
+    ASSERT(!circuit_finalized);
+    UltraCircuitBuilder_ result(EmptyBuilderTag{}, size_hint);
+    const size_t num_variables = this->variables.size();
+    result.variables = ForkableVector<FF>::fork_of(this->variables);
+    result.variable_class_parent = ForkableVector<uint32_t>::fork_with_defaults(num_variables, /*identity=*/true);
+    result.variable_class_rank = ForkableVector<uint8_t>::fork_with_defaults(num_variables, /*identity=*/false);
+    result.variable_class_real_index = ForkableVector<uint32_t>::fork_with_defaults(num_variables, /*identity=*/true);
+    result.real_variable_tags = ForkableVector<uint32_t>::fork_with_defaults(num_variables, /*identity=*/false);
+    result.variables.reserve(num_variables + size_hint * 3);
+    result.variable_class_parent.reserve(num_variables + size_hint * 3);
+    result.variable_class_rank.reserve(num_variables + size_hint * 3);
+    result.variable_class_real_index.reserve(num_variables + size_hint * 3);
+    result.real_variable_tags.reserve(num_variables + size_hint * 3);
+    result.zero_idx = this->zero_idx;
+    result.one_idx = this->one_idx;
+    result.constant_variable_indices = constant_variable_indices;
+    result.tau.insert({ DUMMY_TAG, DUMMY_TAG });
+    result.is_recursive_circuit = this->is_recursive_circuit;
+    result.num_forked_variables = num_variables;
+    return result;
+}
+
+/**
+ * @brief Move the constraints of a builder created by fork() into this builder
+ *
+ * @details Variables the fork shares with this builder keep their indices, and every other variable of the fork is
+ * appended to the variables of this builder (constants are identified with the constants of this builder). The gates of
+ * each block of the fork are appended to the corresponding block, with the wires remapped accordingly, except for the
+ * dummy gates of the fork's range lists and the gates fixing constants which this builder already has. Copy
+ * constraints, range constraints, lookup table usage, ROM/RAM transcripts and pending non-native field multiplications
+ * are carried over. Forks must be merged before the circuit is finalized; state specific to Goblin builders (op queue,
+ * databus) is not supported.
+ */
+template <typename Arithmetization> void UltraCircuitBuilder_<Arithmetization>::merge(UltraCircuitBuilder_&& other)
+{
+    ASSERT(!circuit_finalized && !other.circuit_finalized);
+    ASSERT(other.num_forked_variables <= this->variables.size());
+    ASSERT(other.public_inputs.empty() && !other.contains_recursive_proof);
+    ASSERT(other.memory_read_records.empty() && other.memory_write_records.empty());
+    if (other.failed() && !this->failed()) {
+        this->failure(other.err());
+    }
+
+    // Only the variables local to the fork and the shared entries it has written are visited, so that merging takes
+    // time proportional to the size of the fork rather than to that of this builder.
+    const size_t num_shared = other.num_forked_variables;
+    const size_t num_local = other.variables.size() - num_shared;
+
+    // The variables created by create_range_list are only referenced by their range list, which is rebuilt below, and
+    // by its dummy gates
+    std::vector<bool> is_range_list_step(num_local, false);
+    for (const auto& [target_range, list] : other.range_lists) {
+        const size_t num_steps = target_range / DEFAULT_PLOOKUP_RANGE_STEP_SIZE + 2;
+        for (size_t i = 0; i < num_steps; ++i) {
+            is_range_list_step[list.variable_indices[i] - num_shared] = true;
+        }
+    }
+    std::unordered_map<uint32_t, FF> other_constants;
+    for (const auto& [value, index] : other.constant_variable_indices) {
+        if (index >= num_shared) {
+            other_constants.emplace(index, value);
+        }
+    }
+
+    // Values assigned directly to shared variables by the fork (e.g. dummy witnesses) are carried over
+    for (const auto& [index, value] : other.variables.written_shared_entries()) {
+        if (value != this->variables[index]) {
+            this->variables[index] = value;
+        }
+    }
+    // Shared variables keep their indices
+    std::vector<uint32_t> local_variable_map(num_local);
+    // Constants of the fork which this builder already has, and has already fixed to their value
+    std::unordered_map<uint32_t, FF> duplicate_constants;
+    const auto map_variable = [&](const uint32_t index) {
+        return index < num_shared ? index : local_variable_map[index - num_shared];
+    };
+    for (size_t i = num_shared; i < other.variables.size(); ++i) {
+        const auto index = static_cast<uint32_t>(i);
+        if (is_range_list_step[i - num_shared]) {
+            continue;
+        }
+        uint32_t& mapped = local_variable_map[i - num_shared];
+        if (auto constant = other_constants.find(index); constant != other_constants.end()) {
+            auto [it, inserted] = constant_variable_indices.try_emplace(constant->second, 0);
+            if (inserted) {
+                it->second = this->add_variable(constant->second);
+            } else {
+                duplicate_constants.emplace(index, constant->second);
+            }
+            mapped = it->second;
+        } else {
+            mapped = this->add_variable(other.get_variable(index));
+        }
+    }
+
+    // The dummy gates of the fork's range lists (see create_range_list) and the gates fixing duplicate constants (see
+    // fix_witness) are redundant. They are dropped unless the preceding gate reads the wires of the next one (i.e. has
+    // q_arith > 1).
+    auto& other_arithmetic = other.blocks.arithmetic;
+    const auto is_redundant_arithmetic_gate = [&](const size_t row) {
+        if (row > 0 && other_arithmetic.q_arith()[row - 1] != 0 && other_arithmetic.q_arith()[row - 1] != 1) {
+            return false;
+        }
+        const uint32_t w_l = other_arithmetic.w_l()[row];
+        if (w_l >= num_shared && is_range_list_step[w_l - num_shared]) {
+            return true;
+        }
+        auto constant = duplicate_constants.find(w_l);
+        if (constant == duplicate_constants.end()) {
+            return false;
+        }
+        if (other_arithmetic.w_r()[row] != other.zero_idx || other_arithmetic.w_o()[row] != other.zero_idx ||
+            other_arithmetic.w_4()[row] != other.zero_idx) {
+            return false;
+        }
+        for (auto& selector : other_arithmetic.selectors) {
+            FF expected = 0;
+            if (&selector == &other_arithmetic.q_1() || &selector == &other_arithmetic.q_arith()) {
+                expected = 1;
+            } else if (&selector == &other_arithmetic.q_c()) {
+                expected = -constant->second;
+            }
+            if (selector[row] != expected) {
+                return false;
+            }
+        }
+        return true;
+    };
+    std::vector<bool> keep_arithmetic_gate(other_arithmetic.size(), true);
+    size_t num_redundant_gates = 0;
+    for (size_t row = 0; row < other_arithmetic.size(); ++row) {
+        if (is_redundant_arithmetic_gate(row)) {
+            keep_arithmetic_gate[row] = false;
+            ++num_redundant_gates;
+        }
+    }
+
+    // The range list steps of a dummy gate which is kept for its predecessor get variables of their own. They need no
+    // tag, since the rebuilt range list has steps of its own.
+    for (size_t row = 0; row < other_arithmetic.size(); ++row) {
+        if (!keep_arithmetic_gate[row]) {
+            continue;
+        }
+        for (auto& wire : other_arithmetic.wires) {
+            const uint32_t index = wire[row];
+            if (index >= num_shared && is_range_list_step[index - num_shared]) {
+                is_range_list_step[index - num_shared] = false;
+                local_variable_map[index - num_shared] = this->add_variable(other.get_variable(index));
+            }
+        }
+    }
+
+    // A shared variable is in a class of its own in the fork unless the fork has written its union-find entries
+    const auto copy_equivalence = [&](const uint32_t index) {
+        const uint32_t real_index = other.get_real_variable_index(index);
+        if (real_index != index) {
+            this->assert_equal(map_variable(real_index), map_variable(index), "merge");
+        }
+    };
+    for (const auto& entry : other.variable_class_parent.written_shared_entries()) {
+        copy_equivalence(static_cast<uint32_t>(entry.first));
+    }
+    for (const auto& entry : other.variable_class_real_index.written_shared_entries()) {
+        copy_equivalence(static_cast<uint32_t>(entry.first));
+    }
+    for (size_t i = num_shared; i < other.variables.size(); ++i) {
+        copy_equivalence(static_cast<uint32_t>(i));
+    }
+
+    // Lookup gates record the index of their table in q_3, which may differ between the builders
+    std::vector<FF> table_index_map(other.lookup_tables.size());
+    for (auto& table : other.lookup_tables) {
+        auto existing = std::find_if(lookup_tables.begin(), lookup_tables.end(), [&](const auto& existing_table) {
+            return existing_table.id == table.id;
+        });
+        if (existing != lookup_tables.end()) {
+            existing->merge_lookups(table);
+            table_index_map[table.table_index] = FF(existing->table_index);
+        } else {
+            table_index_map[table.table_index] = FF(lookup_tables.size());
+            table.table_index = lookup_tables.size();
+            lookup_tables.emplace_back(std::move(table));
+        }
+    }
+    for (auto& multi_table : other.lookup_multi_tables) {
+        if (std::none_of(lookup_multi_tables.begin(), lookup_multi_tables.end(), [&](const auto& existing_table) {
+                return existing_table.id == multi_table.id;
+            })) {
+            lookup_multi_tables.emplace_back(std::move(multi_table));
+        }
+    }
+
+    const size_t lookup_offset = blocks.lookup.size();
+    const size_t aux_offset = blocks.aux.size();
+    for (auto [block, other_block] : zip_view(blocks.get(), other.blocks.get())) {
+        const bool is_arithmetic = &other_block == &other_arithmetic;
+        const auto keep = [&](const size_t row) { return !is_arithmetic || keep_arithmetic_gate[row]; };
+        for (auto [wire, other_wire] : zip_view(block.wires, other_block.wires)) {
+            wire.reserve(wire.size() + other_wire.size());
+            for (size_t row = 0; row < other_wire.size(); ++row) {
+                if (keep(row)) {
+                    wire.emplace_back(map_variable(other_wire[row]));
+                }
+            }
+        }
+        for (auto [selector, other_selector] : zip_view(block.selectors, other_block.selectors)) {
+            for (size_t row = 0; row < other_selector.size(); ++row) {
+                if (keep(row)) {
+                    selector.emplace_back(other_selector[row]);
+                }
+            }
+        }
+        block.has_ram_rom = block.has_ram_rom || other_block.has_ram_rom;
+    }
+    for (size_t i = lookup_offset; i < blocks.lookup.size(); ++i) {
+        auto& table_index = blocks.lookup.q_3()[i];
+        table_index = table_index_map[static_cast<size_t>(table_index)];
+    }
+    this->num_gates += other.num_gates - num_redundant_gates;
+
+    const auto map_memory_record = [&](uint32_t& index) {
+        if (index != UNINITIALIZED_MEMORY_RECORD) {
+            index = map_variable(index);
+        }
+    };
+    for (auto& rom_array : other.rom_arrays) {
+        for (auto& entry : rom_array.state) {
+            map_memory_record(entry[0]);
+            map_memory_record(entry[1]);
+        }
+        for (auto& record : rom_array.records) {
+            record.index_witness = map_variable(record.index_witness);
+            record.value_column1_witness = map_variable(record.value_column1_witness);
+            record.value_column2_witness = map_variable(record.value_column2_witness);
+            record.record_witness = map_variable(record.record_witness);
+            record.gate_index += aux_offset;
+        }
+        rom_arrays.emplace_back(std::move(rom_array));
+    }
+    for (auto& ram_array : other.ram_arrays) {
+        for (auto& entry : ram_array.state) {
+            map_memory_record(entry);
+        }
+        for (auto& record : ram_array.records) {
+            record.index_witness = map_variable(record.index_witness);
+            record.timestamp_witness = map_variable(record.timestamp_witness);
+            record.value_witness = map_variable(record.value_witness);
+            record.record_witness = map_variable(record.record_witness);
+            record.gate_index += aux_offset;
+        }
+        ram_arrays.emplace_back(std::move(ram_array));
+    }
+
+    for (auto multiplication : other.cached_partial_non_native_field_multiplications) {
+        for (size_t i = 0; i < 5; ++i) {
+            multiplication.a[i] = map_variable(multiplication.a[i]);
+            multiplication.b[i] = map_variable(multiplication.b[i]);
+        }
+        multiplication.lo_0 = map_variable(static_cast<uint32_t>(multiplication.lo_0));
+        multiplication.hi_0 = map_variable(static_cast<uint32_t>(multiplication.hi_0));
+        multiplication.hi_1 = map_variable(static_cast<uint32_t>(multiplication.hi_1));
+        cached_partial_non_native_field_multiplications.emplace_back(multiplication);
+    }
+
+    // Range constraints are re-applied rather than copied, since tags are local to each builder
+    for (const auto& [target_range, list] : other.range_lists) {
+        const size_t num_steps = target_range / DEFAULT_PLOOKUP_RANGE_STEP_SIZE + 2;
+        for (size_t i = num_steps; i < list.variable_indices.size(); ++i) {
+            create_new_range_constraint(map_variable(list.variable_indices[i]), target_range);
+        }
+    }
+}
+
 /**
  * @brief Ensure all polynomials have at least one non-zero coefficient to avoid commiting to the zero-polynomial
  *
@@ -636,7 +925,7 @@ plookup::ReadData<uint32_t> UltraCircuitBuilder_<Arithmetization>::create_gates_
     for (size_t i = 0; i < num_lookups; ++i) {
         auto& table = get_table(multi_table.lookup_ids[i]);
 
-        table.lookup_gates.emplace_back(read_values.key_entries[i]);
+        table.record_lookup(read_values.key_entries[i]);
 
         const auto first_idx = (i == 0) ? key_a_index : this->add_variable(read_values[plookup::ColumnIdx::C1][i]);
         const auto second_idx = (i == 0 && (key_b_index.has_value()))
@@ -834,7 +1123,7 @@ void UltraCircuitBuilder_<Arithmetization>::create_new_range_constraint(const ui
         range_lists.insert({ target_range, create_range_list(target_range) });
     }
 
-    const auto existing_tag = this->real_variable_tags[this->real_variable_index[variable_index]];
+    const auto existing_tag = this->real_variable_tags[this->get_real_variable_index(variable_index)];
     auto& list = range_lists[target_range];
 
     // If the variable's tag matches the target range list's tag, do nothing.
@@ -884,7 +1173,7 @@ template <typename Arithmetization> void UltraCircuitBuilder_<Arithmetization>::
     // applied on a variable after it was range constrained, this makes sure the indices in list point to the updated
     // index in the range list so the set equivalence does not fail
     for (uint32_t& x : list.variable_indices) {
-        x = this->real_variable_index[x];
+        x = this->get_real_variable_index(x);
     }
     // remove duplicate witness indices to prevent the sorted list set size being wrong!
     std::sort(list.variable_indices.begin(), list.variable_indices.end());
@@ -1714,8 +2003,8 @@ void UltraCircuitBuilder_<Arithmetization>::process_non_native_field_multiplicat
     for (size_t i = 0; i < cached_partial_non_native_field_multiplications.size(); ++i) {
         auto& c = cached_partial_non_native_field_multiplications[i];
         for (size_t j = 0; j < 5; ++j) {
-            c.a[j] = this->real_variable_index[c.a[j]];
-            c.b[j] = this->real_variable_index[c.b[j]];
+            c.a[j] = this->get_real_variable_index(c.a[j]);
+            c.b[j] = this->get_real_variable_index(c.b[j]);
         }
     }
     cached_partial_non_native_field_multiplication::deduplicate(cached_partial_non_native_field_multiplications);
@@ -2694,7 +2983,7 @@ template <typename Arithmetization> uint256_t UltraCircuitBuilder_<Arithmetizati
 
     size_t num_bytes_in_selectors = sizeof(FF) * Arithmetization::NUM_SELECTORS * sum_of_block_sizes;
     size_t num_bytes_in_wires_and_copy_constraints =
-        sizeof(uint32_t) * (Arithmetization::NUM_WIRES * sum_of_block_sizes + this->real_variable_index.size());
+        sizeof(uint32_t) * (Arithmetization::NUM_WIRES * sum_of_block_sizes + this->variables.size());
     size_t num_bytes_to_hash = num_bytes_in_selectors + num_bytes_in_wires_and_copy_constraints;
 
     std::vector<uint8_t> to_hash(num_bytes_to_hash);
@@ -2708,7 +2997,8 @@ template <typename Arithmetization> uint256_t UltraCircuitBuilder_<Arithmetizati
         std::for_each(block.selectors.begin(), block.selectors.end(), convert_and_insert);
         std::for_each(block.wires.begin(), block.wires.end(), convert_and_insert);
     }
-    convert_and_insert(this->real_variable_index);
+    const auto real_variable_indices = this->get_real_variable_indices();
+    convert_and_insert(real_variable_indices);
 
     return from_buffer<uint256_t>(crypto::sha256(to_hash));
 }
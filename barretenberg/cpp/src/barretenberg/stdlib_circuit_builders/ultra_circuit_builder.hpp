@@ -310,6 +310,9 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename Arithmetization_
 
     bool circuit_finalized = false;
 
+    // For a builder created by fork(), the number of variables it shares with the builder it was forked from
+    size_t num_forked_variables = 0;
+
     void process_non_native_field_multiplications();
     UltraCircuitBuilder_(const size_t size_hint = 0)
         : CircuitBuilderBase<FF>(size_hint)
@@ -374,6 +377,7 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename Arithmetization_
         memory_write_records = other.memory_write_records;
         cached_partial_non_native_field_multiplications = other.cached_partial_non_native_field_multiplications;
         circuit_finalized = other.circuit_finalized;
+        num_forked_variables = other.num_forked_variables;
     };
     UltraCircuitBuilder_& operator=(const UltraCircuitBuilder_& other) = default;
     UltraCircuitBuilder_& operator=(UltraCircuitBuilder_&& other)
@@ -391,6 +395,7 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename Arithmetization_
         memory_write_records = other.memory_write_records;
         cached_partial_non_native_field_multiplications = other.cached_partial_non_native_field_multiplications;
         circuit_finalized = other.circuit_finalized;
+        num_forked_variables = other.num_forked_variables;
         return *this;
     };
     ~UltraCircuitBuilder_() override = default;
@@ -420,6 +425,9 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename Arithmetization_
 
     void finalize_circuit();
 
+    UltraCircuitBuilder_ fork(const size_t size_hint = 0) const;
+    void merge(UltraCircuitBuilder_&& other);
+
     void add_gates_to_ensure_all_polys_are_non_zero();
 
     void create_add_gate(const add_triple_<FF>& in) override;
@@ -627,7 +635,7 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename Arithmetization_
     {
         size_t lookups_size = 0;
         for (const auto& table : lookup_tables) {
-            lookups_size += table.lookup_gates.size();
+            lookups_size += table.num_lookup_gates;
         }
         return lookups_size;
     }
@@ -713,11 +721,11 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename Arithmetization_
     {
         ASSERT(tag <= this->current_tag);
         // If we've already assigned this tag to this variable, return (can happen due to copy constraints)
-        if (this->real_variable_tags[this->real_variable_index[variable_index]] == tag) {
+        if (this->real_variable_tags[this->get_real_variable_index(variable_index)] == tag) {
             return;
         }
-        ASSERT(this->real_variable_tags[this->real_variable_index[variable_index]] == DUMMY_TAG);
-        this->real_variable_tags[this->real_variable_index[variable_index]] = tag;
+        ASSERT(this->real_variable_tags[this->get_real_variable_index(variable_index)] == DUMMY_TAG);
+        this->real_variable_tags[this->get_real_variable_index(variable_index)] = tag;
     }
 
     uint32_t create_tag(const uint32_t tag_index, const uint32_t tau_index)
@@ -797,6 +805,13 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename Arithmetization_
     void process_RAM_arrays();
 
     uint256_t hash_circuit();
+
+  private:
+    struct EmptyBuilderTag {};
+    // Constructs a builder without any variables, used by fork()
+    UltraCircuitBuilder_(EmptyBuilderTag /*unused*/, const size_t size_hint)
+        : CircuitBuilderBase<FF>(size_hint)
+    {}
 };
 using UltraCircuitBuilder = UltraCircuitBuilder_<UltraArith<bb::fr>>;
 } // namespace bb
@@ -1,4 +1,5 @@
 #pragma once
+#include "barretenberg/common/throw_or_abort.hpp"
 #include "barretenberg/execution_trace/execution_trace.hpp"
 #include "barretenberg/flavor/flavor.hpp"
 #include "barretenberg/plonk_honk_shared/composer/composer_lib.hpp"
@@ -41,15 +42,31 @@ template <class Flavor> class ProverInstance_ {
     std::vector<FF> gate_challenges;
     FF target_sum;
 
+    /**
+     * @brief Construct an instance with a conventional trace or, if is_structured, a structured trace in which every
+     * block has the default fixed size
+     */
     ProverInstance_(Circuit& circuit, bool is_structured = false)
+        : ProverInstance_(circuit,
+                          is_structured ? TraceStructure(circuit.blocks.get().size(), circuit.FIXED_BLOCK_SIZE)
+                                        : TraceStructure{})
+    {}
+
+    /**
+     * @brief Construct an instance whose execution trace has the given structure (or a conventional trace if the
+     * structure is empty)
+     */
+    ProverInstance_(Circuit& circuit, const TraceStructure& trace_structure)
     {
         BB_OP_COUNT_TIME_NAME("ProverInstance(Circuit&)");
         circuit.add_gates_to_ensure_all_polys_are_non_zero();
         circuit.finalize_circuit();
-        // If using a structured trace, ensure that no block exceeds the fixed size
-        if (is_structured) {
-            for (auto& block : circuit.blocks.get()) {
-                ASSERT(block.size() <= circuit.FIXED_BLOCK_SIZE);
+        // If using a structured trace, ensure that every block fits within its allotted space
+        if (trace_structure.is_structured()) {
+            auto block_sizes = Trace::get_block_sizes(circuit);
+            if (!trace_structure.fits(block_sizes)) {
+                trace_structure.print_fill_ratios(block_sizes);
+                throw_or_abort("ProverInstance: circuit does not fit within the structured trace.");
             }
         }
 
@@ -60,8 +77,8 @@ template <class Flavor> class ProverInstance_ {
             circuit.op_queue->append_nonzero_ops();
         }
 
-        if (is_structured) { // Compute dyadic size based on a structured trace with fixed block size
-            dyadic_circuit_size = compute_structured_dyadic_size(circuit);
+        if (trace_structure.is_structured()) { // Compute dyadic size based on the structured trace
+            dyadic_circuit_size = compute_structured_dyadic_size(circuit, trace_structure);
         } else { // Otherwise, compute conventional dyadic circuit size
             dyadic_circuit_size = compute_dyadic_size(circuit);
         }
@@ -69,7 +86,7 @@ template <class Flavor> class ProverInstance_ {
         proving_key = ProvingKey(dyadic_circuit_size, circuit.public_inputs.size());
 
         // Construct and add to proving key the wire, selector and copy constraint polynomials
-        Trace::populate(circuit, proving_key, is_structured);
+        Trace::populate(circuit, proving_key, trace_structure);
 
         // If Goblin, construct the databus polynomials
         if constexpr (IsGoblinFlavor<Flavor>) {
@@ -104,13 +121,13 @@ template <class Flavor> class ProverInstance_ {
     size_t compute_dyadic_size(Circuit&);
 
     /**
-     * @brief Compute dyadic size based on a structured trace with fixed block size
+     * @brief Compute dyadic size based on a structured trace, which must still accommodate the lookup argument
      *
      */
-    size_t compute_structured_dyadic_size(Circuit& builder)
+    size_t compute_structured_dyadic_size(Circuit& builder, const TraceStructure& trace_structure)
     {
-        size_t num_blocks = builder.blocks.get().size();
-        size_t minimum_size = num_blocks * builder.FIXED_BLOCK_SIZE;
+        const size_t min_size_due_to_lookups = builder.get_tables_size() + builder.get_lookups_size();
+        size_t minimum_size = num_zero_rows + std::max(trace_structure.num_rows(), min_size_due_to_lookups);
         return builder.get_circuit_subgroup_size(minimum_size);
     }
 
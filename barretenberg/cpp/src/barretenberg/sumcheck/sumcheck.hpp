@@ -101,17 +101,33 @@ template <typename Flavor> class SumcheckProver {
         transcript->send_to_verifier("Sumcheck:univariate_0", round_univariate);
         FF round_challenge = transcript->template get_challenge<FF>("Sumcheck:u_0");
         multivariate_challenge.emplace_back(round_challenge);
-        partially_evaluate(full_polynomials, multivariate_n, round_challenge);
         pow_univariate.partially_evaluate(round_challenge);
         round.round_size = round.round_size >> 1; // TODO(#224)(Cody): Maybe partially_evaluate should do this and
-                                                  // release memory?        // All but final round
-                                                  // We operate on partially_evaluated_polynomials in place.
+                                                  // release memory?
+        // The partial evaluation of the full polynomials at u_0 is fused into the second round (see
+        // partially_evaluate_rows), unless there is no second round
+        if (multivariate_d == 1) {
+            partially_evaluate(full_polynomials, multivariate_n, round_challenge);
+        }
+        // All but final round
+        // We operate on partially_evaluated_polynomials in place.
         for (size_t round_idx = 1; round_idx < multivariate_d; round_idx++) {
             // Write the round univariate to the transcript
-            round_univariate =
-                round.compute_univariate(partially_evaluated_polynomials, relation_parameters, pow_univariate, alpha);
+            if (round_idx == 1) {
+                round_univariate = round.compute_univariate(
+                    partially_evaluated_polynomials,
+                    relation_parameters,
+                    pow_univariate,
+                    alpha,
+                    [&, u_0 = round_challenge](size_t start, size_t end) {
+                        partially_evaluate_rows(full_polynomials, start, end, u_0);
+                    });
+            } else {
+                round_univariate = round.compute_univariate(
+                    partially_evaluated_polynomials, relation_parameters, pow_univariate, alpha);
+            }
             transcript->send_to_verifier("Sumcheck:univariate_" + std::to_string(round_idx), round_univariate);
-            FF round_challenge = transcript->template get_challenge<FF>("Sumcheck:u_" + std::to_string(round_idx));
+            round_challenge = transcript->template get_challenge<FF>("Sumcheck:u_" + std::to_string(round_idx));
             multivariate_challenge.emplace_back(round_challenge);
             partially_evaluate(partially_evaluated_polynomials, round.round_size, round_challenge);
             pow_univariate.partially_evaluate(round_challenge);
@@ -155,6 +171,20 @@ template <typename Flavor> class SumcheckProver {
             }
         });
     };
+    /**
+     * @brief Partially evaluate the rows [start, end) of partially_evaluated_polynomials from the full polynomials.
+     * @details Called from within the threads of the second round's compute_univariate, so it must not spawn threads
+     * of its own. The full polynomials are only read, hence the threads never race; later rounds fold
+     * partially_evaluated_polynomials in place, which is why they keep a separate pass.
+     */
+    void partially_evaluate_rows(ProverPolynomials& polynomials, size_t start, size_t end, FF round_challenge)
+    {
+        for (auto [pep, poly] : zip_view(partially_evaluated_polynomials.get_all(), polynomials.get_all())) {
+            for (size_t i = start; i < end; ++i) {
+                pep[i] = poly[2 * i] + round_challenge * (poly[2 * i + 1] - poly[2 * i]);
+            }
+        }
+    };
     /**
      * @brief Evaluate at the round challenge and prepare class for next round.
      * Specialization for array, see generic version above.
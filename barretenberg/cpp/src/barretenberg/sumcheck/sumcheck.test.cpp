@@ -121,6 +121,41 @@ TEST_F(SumcheckTests, PolynomialNormalization)
     }
 }
 
+/**
+ * @brief Check the claimed evaluations for a single round and for enough rounds that the partial evaluation fused into
+ * the second round is split over several blocks of rows
+ */
+TEST_F(SumcheckTests, ClaimedEvaluationsMatchMultilinearExtensions)
+{
+    for (size_t multivariate_d : std::array<size_t, 2>{ 1, 10 }) {
+        const size_t multivariate_n(1 << multivariate_d);
+
+        std::array<Polynomial<FF>, NUM_POLYNOMIALS> random_polynomials;
+        for (auto& poly : random_polynomials) {
+            poly = random_poly(multivariate_n);
+        }
+        auto full_polynomials = construct_ultra_full_polynomials(random_polynomials);
+
+        auto transcript = Flavor::Transcript::prover_init_empty();
+        auto sumcheck = SumcheckProver<Flavor>(multivariate_n, transcript);
+        RelationSeparator alpha;
+        for (auto& challenge : alpha) {
+            challenge = FF::random_element();
+        }
+        std::vector<FF> gate_challenges(multivariate_d);
+        for (auto& challenge : gate_challenges) {
+            challenge = FF::random_element();
+        }
+        auto output = sumcheck.prove(full_polynomials, {}, alpha, gate_challenges);
+
+        for (auto [full_poly, claimed_eval] :
+             zip_view(full_polynomials.get_all(), output.claimed_evaluations.get_all())) {
+            Polynomial<FF> poly(full_poly);
+            EXPECT_EQ(poly.evaluate_mle(output.challenge), claimed_eval);
+        }
+    }
+}
+
 TEST_F(SumcheckTests, Prover)
 {
     const size_t multivariate_d(2);
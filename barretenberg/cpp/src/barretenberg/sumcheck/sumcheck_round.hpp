@@ -1,4 +1,5 @@
 #pragma once
+#include "barretenberg/common/op_count.hpp"
 #include "barretenberg/common/thread.hpp"
 #include "barretenberg/flavor/flavor.hpp"
 #include "barretenberg/polynomials/pow.hpp"
@@ -49,7 +50,12 @@ namespace bb {
 
  */
 
-template <typename Flavor> class SumcheckProverRound {
+/**
+ * @tparam EdgeBatchSize The number of edges the relations are evaluated on at once; defaults to the flavor's choice
+ * (see get_sumcheck_edge_batch_size). A batch size of 1 evaluates the relations one edge at a time.
+ */
+template <typename Flavor, size_t EdgeBatchSize = get_sumcheck_edge_batch_size<Flavor>()>
+class SumcheckProverRound {
 
     using Utils = bb::RelationUtils<Flavor>;
     using Relations = typename Flavor::Relations;
@@ -66,6 +72,38 @@ template <typename Flavor> class SumcheckProverRound {
     static constexpr size_t MAX_PARTIAL_RELATION_LENGTH = Flavor::MAX_PARTIAL_RELATION_LENGTH;
     static constexpr size_t BATCHED_RELATION_PARTIAL_LENGTH = Flavor::BATCHED_RELATION_PARTIAL_LENGTH;
 
+    // Relations are evaluated on this many edges at once; see accumulate_edge_batches
+    static constexpr size_t EDGE_BATCH_SIZE = EdgeBatchSize;
+    static_assert(EDGE_BATCH_SIZE > 0);
+    using EdgePairs = typename Flavor::template ProverUnivariates<2>;
+    using BatchedExtendedEdges =
+        typename Flavor::template ProverUnivariates<MAX_PARTIAL_RELATION_LENGTH * EDGE_BATCH_SIZE>;
+    using BatchedTupleOfTuplesOfUnivariates =
+        decltype(create_batched_sumcheck_tuple_of_tuples_of_univariates<Relations, EDGE_BATCH_SIZE>());
+
+    // Number of rows each thread processes at a time in compute_univariate; a multiple of the rows in a batch
+    static constexpr size_t EDGE_BLOCK_SIZE = 1 << 7;
+    static_assert(EDGE_BLOCK_SIZE % (2 * EDGE_BATCH_SIZE) == 0);
+
+    // The default for compute_univariate's prepare_rows, for polynomials which are read as they are
+    struct NoRowPreparation {
+        void operator()(size_t /*start*/, size_t /*end*/) const {}
+    };
+
+    /**
+     * @brief Per-thread scratch space for evaluating the relations on EDGE_BATCH_SIZE edges at once.
+     * @details The extended edges and the accumulators are stored point-major: entry p * EDGE_BATCH_SIZE + k is the
+     * value of edge k at the point p. Every field operation in a relation is pointwise, so a relation evaluated on
+     * these univariates processes the whole batch with contiguous loads, and truncating to a view of length L * K keeps
+     * the first L points of every edge.
+     */
+    struct EdgeBatch {
+        std::array<EdgePairs, EDGE_BATCH_SIZE> edges; // the unextended edges, used for the skip checks
+        BatchedExtendedEdges extended_edges;
+        BatchedTupleOfTuplesOfUnivariates accumulators;
+        std::array<FF, EDGE_BATCH_SIZE> scaling_factors;
+    };
+
     SumcheckTupleOfTuplesOfUnivariates univariate_accumulators;
 
     // Prover constructor
@@ -94,17 +132,57 @@ template <typename Flavor> class SumcheckProverRound {
         }
     }
 
+    /**
+     * @brief Extend EDGE_BATCH_SIZE consecutive edges starting at edge_idx into the batched layout of EdgeBatch.
+     */
+    template <typename ProverPolynomialsOrPartiallyEvaluatedMultivariates>
+    void extend_edge_batch(EdgeBatch& batch,
+                           const ProverPolynomialsOrPartiallyEvaluatedMultivariates& multivariates,
+                           size_t edge_idx)
+    {
+        constexpr size_t K = EDGE_BATCH_SIZE;
+        auto polynomials = multivariates.get_all();
+        auto extended_edges = batch.extended_edges.get_all();
+        for (size_t k = 0; k < K; ++k) {
+            auto edges = batch.edges[k].get_all();
+            for (size_t i = 0; i < polynomials.size(); ++i) {
+                const FF& value_0 = polynomials[i][edge_idx + 2 * k];
+                const FF& value_1 = polynomials[i][edge_idx + 2 * k + 1];
+                edges[i] = bb::Univariate<FF, 2>({ value_0, value_1 });
+                extended_edges[i].value_at(k) = value_0;
+                extended_edges[i].value_at(K + k) = value_1;
+            }
+        }
+        // Each edge is linear, so every further point is the previous one plus the edge's delta
+        for (auto& extended_edge : extended_edges) {
+            std::array<FF, K> deltas;
+            for (size_t k = 0; k < K; ++k) {
+                deltas[k] = extended_edge.value_at(K + k) - extended_edge.value_at(k);
+            }
+            for (size_t point = 2; point < MAX_PARTIAL_RELATION_LENGTH; ++point) {
+                for (size_t k = 0; k < K; ++k) {
+                    extended_edge.value_at(point * K + k) = extended_edge.value_at((point - 1) * K + k) + deltas[k];
+                }
+            }
+        }
+    }
+
     /**
      * @brief Return the evaluations of the univariate restriction (S_l(X_l) in the thesis) at num_multivariates-many
      * values. Most likely this will end up being S_l(0), ... , S_l(t-1) where t is around 12. At the end, reset all
      * univariate accumulators to be zero.
+     *
+     * @details Each thread walks its edges in blocks of EDGE_BLOCK_SIZE rows and calls prepare_rows(start, end) on a
+     * block before reading it. The sumcheck prover uses this to fuse the previous round's partial evaluation into
+     * this pass, so that the folded rows are still in cache when the relations read them.
      */
-    template <typename ProverPolynomialsOrPartiallyEvaluatedMultivariates>
+    template <typename ProverPolynomialsOrPartiallyEvaluatedMultivariates, typename PrepareRows = NoRowPreparation>
     bb::Univariate<FF, BATCHED_RELATION_PARTIAL_LENGTH> compute_univariate(
         ProverPolynomialsOrPartiallyEvaluatedMultivariates& polynomials,
         const bb::RelationParameters<FF>& relation_parameters,
         const bb::PowPolynomial<FF>& pow_polynomial,
-        const RelationSeparator alpha)
+        const RelationSeparator alpha,
+        const PrepareRows& prepare_rows = {})
     {
         BB_OP_COUNT_TIME();
 
@@ -125,22 +203,43 @@ template <typename Flavor> class SumcheckProverRound {
         // Construct extended edge containers; one per thread
         std::vector<ExtendedEdges> extended_edges;
         extended_edges.resize(num_threads);
+        std::vector<EdgeBatch> edge_batches;
+        if constexpr (EDGE_BATCH_SIZE > 1) {
+            edge_batches.resize(num_threads);
+        }
 
         // Accumulate the contribution from each sub-relation accross each edge of the hyper-cube
         parallel_for(num_threads, [&](size_t thread_idx) {
-            size_t start = thread_idx * iterations_per_thread;
-            size_t end = (thread_idx + 1) * iterations_per_thread;
-
-            for (size_t edge_idx = start; edge_idx < end; edge_idx += 2) {
-                extend_edges(extended_edges[thread_idx], polynomials, edge_idx);
-
-                // Compute the i-th edge's univariate contribution,
-                // scale it by the corresponding pow contribution and add it to the accumulators for Sˡ(Xₗ). The pow
-                // contribution represents the elements of pow(\vec{β}) not containing β_0,..., β_l
-                accumulate_relation_univariates(thread_univariate_accumulators[thread_idx],
-                                                extended_edges[thread_idx],
-                                                relation_parameters,
-                                                pow_polynomial[(edge_idx >> 1) * pow_polynomial.periodicity]);
+            const size_t thread_start = thread_idx * iterations_per_thread;
+            const size_t thread_end = (thread_idx + 1) * iterations_per_thread;
+
+            for (size_t block_start = thread_start; block_start < thread_end; block_start += EDGE_BLOCK_SIZE) {
+                const size_t block_end = std::min(block_start + EDGE_BLOCK_SIZE, thread_end);
+                prepare_rows(block_start, block_end);
+
+                size_t start = block_start;
+                if constexpr (EDGE_BATCH_SIZE > 1) {
+                    start = accumulate_edge_batches(thread_univariate_accumulators[thread_idx],
+                                                    edge_batches[thread_idx],
+                                                    polynomials,
+                                                    relation_parameters,
+                                                    pow_polynomial,
+                                                    start,
+                                                    block_end);
+                }
+
+                // Any edges that do not fill a batch are handled one at a time
+                for (size_t edge_idx = start; edge_idx < block_end; edge_idx += 2) {
+                    extend_edges(extended_edges[thread_idx], polynomials, edge_idx);
+
+                    // Compute the i-th edge's univariate contribution,
+                    // scale it by the corresponding pow contribution and add it to the accumulators for Sˡ(Xₗ). The
+                    // pow contribution represents the elements of pow(\vec{β}) not containing β_0,..., β_l
+                    accumulate_relation_univariates(thread_univariate_accumulators[thread_idx],
+                                                    extended_edges[thread_idx],
+                                                    relation_parameters,
+                                                    pow_polynomial[(edge_idx >> 1) * pow_polynomial.periodicity]);
+                }
             }
         });
 
@@ -250,6 +349,8 @@ template <typename Flavor> class SumcheckProverRound {
                                      extended_edges,
                                      relation_parameters,
                                      scaling_factor);
+            } else {
+                BB_OP_COUNT_TRACK_NAME("SumcheckProverRound::skipped_relation_evaluation");
             }
         }
 
@@ -259,6 +360,94 @@ template <typename Flavor> class SumcheckProverRound {
                 univariate_accumulators, extended_edges, relation_parameters, scaling_factor);
         }
     }
+
+    /**
+     * @brief Accumulate the contributions of the edges in [start, end) in batches of EDGE_BATCH_SIZE.
+     * @return The index of the first edge that did not fit in a full batch
+     */
+    template <typename ProverPolynomialsOrPartiallyEvaluatedMultivariates>
+    size_t accumulate_edge_batches(SumcheckTupleOfTuplesOfUnivariates& univariate_accumulators,
+                                   EdgeBatch& batch,
+                                   const ProverPolynomialsOrPartiallyEvaluatedMultivariates& polynomials,
+                                   const bb::RelationParameters<FF>& relation_parameters,
+                                   const bb::PowPolynomial<FF>& pow_polynomial,
+                                   size_t start,
+                                   size_t end)
+    {
+        size_t edge_idx = start;
+        for (; edge_idx + 2 * EDGE_BATCH_SIZE <= end; edge_idx += 2 * EDGE_BATCH_SIZE) {
+            extend_edge_batch(batch, polynomials, edge_idx);
+            for (size_t k = 0; k < EDGE_BATCH_SIZE; ++k) {
+                batch.scaling_factors[k] = pow_polynomial[((edge_idx >> 1) + k) * pow_polynomial.periodicity];
+            }
+            accumulate_batched_relation_univariates(univariate_accumulators, batch, relation_parameters);
+        }
+        return edge_idx;
+    }
+
+    /**
+     * @brief Batched counterpart of accumulate_relation_univariates.
+     *
+     * @details Each relation is evaluated once on the whole batch with a unit scaling factor, then the batched result
+     * is folded into the accumulators with each edge's pow contribution. This is equivalent to evaluating the edges one
+     * by one since the relations are linear in the scaling factor; subrelations that are not linearly independent
+     * ignore the scaling factor and are summed as is. A relation is skipped only when it can be skipped on every edge
+     * of the batch.
+     */
+    template <size_t relation_idx = 0>
+    void accumulate_batched_relation_univariates(SumcheckTupleOfTuplesOfUnivariates& univariate_accumulators,
+                                                 EdgeBatch& batch,
+                                                 const bb::RelationParameters<FF>& relation_parameters)
+    {
+        using Relation = std::tuple_element_t<relation_idx, Relations>;
+
+        bool skip = false;
+        if constexpr (isSkippable<Relation, EdgePairs>) {
+            skip = std::all_of(batch.edges.begin(), batch.edges.end(), [](const EdgePairs& edges) {
+                return Relation::skip(edges);
+            });
+        }
+        if (!skip) {
+            auto& batched_accumulators = std::get<relation_idx>(batch.accumulators);
+            std::apply([](auto&... accumulator) { ((accumulator = accumulator.zero()), ...); }, batched_accumulators);
+            Relation::accumulate(batched_accumulators, batch.extended_edges, relation_parameters, FF(1));
+            fold_edge_batch<Relation>(
+                std::get<relation_idx>(univariate_accumulators), batched_accumulators, batch.scaling_factors);
+        } else {
+            BB_OP_COUNT_TRACK_NAME("SumcheckProverRound::skipped_relation_evaluation");
+        }
+
+        // Repeat for the next relation.
+        if constexpr (relation_idx + 1 < NUM_RELATIONS) {
+            accumulate_batched_relation_univariates<relation_idx + 1>(
+                univariate_accumulators, batch, relation_parameters);
+        }
+    }
+
+    /**
+     * @brief Add the per-edge contributions held in the batched accumulators of a relation to its accumulators.
+     */
+    template <typename Relation, size_t subrelation_idx = 0>
+    static void fold_edge_batch(auto& accumulators,
+                                const auto& batched_accumulators,
+                                const std::array<FF, EDGE_BATCH_SIZE>& scaling_factors)
+    {
+        auto& accumulator = std::get<subrelation_idx>(accumulators);
+        const auto& batched_accumulator = std::get<subrelation_idx>(batched_accumulators);
+        for (size_t point = 0; point < accumulator.LENGTH; ++point) {
+            for (size_t k = 0; k < EDGE_BATCH_SIZE; ++k) {
+                if constexpr (bb::subrelation_is_linearly_independent<Relation, subrelation_idx>()) {
+                    accumulator.value_at(point) +=
+                        batched_accumulator.value_at(point * EDGE_BATCH_SIZE + k) * scaling_factors[k];
+                } else {
+                    accumulator.value_at(point) += batched_accumulator.value_at(point * EDGE_BATCH_SIZE + k);
+                }
+            }
+        }
+        if constexpr (subrelation_idx + 1 < std::tuple_size_v<std::decay_t<decltype(accumulators)>>) {
+            fold_edge_batch<Relation, subrelation_idx + 1>(accumulators, batched_accumulators, scaling_factors);
+        }
+    }
 };
 
 template <typename Flavor> class SumcheckVerifierRound {
@@ -1,5 +1,6 @@
 #include "sumcheck_round.hpp"
 #include "barretenberg/relations/utils.hpp"
+#include "barretenberg/stdlib_circuit_builders/goblin_ultra_flavor.hpp"
 #include "barretenberg/stdlib_circuit_builders/ultra_flavor.hpp"
 
 #include <gtest/gtest.h>
@@ -131,3 +132,69 @@ TEST(SumcheckRound, AddTuplesOfTuplesOfUnivariates)
     EXPECT_EQ(std::get<0>(std::get<1>(tuple_of_tuples_1)), expected_sum_2);
     EXPECT_EQ(std::get<1>(std::get<1>(tuple_of_tuples_1)), expected_sum_3);
 }
+
+namespace {
+/**
+ * @brief Check that evaluating the relations on batches of edges produces the same round univariate as evaluating them
+ * one edge at a time, including round sizes that do not fill a batch and selectors that let relations be skipped
+ *
+ */
+template <typename Flavor> void check_batched_edges_match_single_edges()
+{
+    using FF = typename Flavor::FF;
+    using BatchedRound = SumcheckProverRound<Flavor>;
+    using SingleEdgeRound = SumcheckProverRound<Flavor, /*EdgeBatchSize=*/1>;
+    static_assert(BatchedRound::EDGE_BATCH_SIZE > 1);
+    static_assert(SingleEdgeRound::EDGE_BATCH_SIZE == 1);
+
+    for (size_t log_size = 1; log_size <= 6; ++log_size) {
+        const size_t size = 1 << log_size;
+        typename Flavor::ProverPolynomials polynomials(size);
+        for (auto& polynomial : polynomials.get_unshifted()) {
+            // Leave the first row zero so the polynomials can be shifted
+            for (size_t i = 1; i < size; ++i) {
+                polynomial[i] = FF::random_element();
+            }
+        }
+        // Turn the gates off on some blocks of rows so that relations are skipped on some edges and batches
+        for (auto& selector : polynomials.get_selectors()) {
+            for (size_t i = 0; i < size; ++i) {
+                if (((i >> 2) & 1) != 0) {
+                    selector[i] = 0;
+                }
+            }
+        }
+        polynomials.set_shifted();
+
+        auto relation_parameters = RelationParameters<FF>::get_random();
+        typename Flavor::RelationSeparator alpha;
+        for (auto& challenge : alpha) {
+            challenge = FF::random_element();
+        }
+        std::vector<FF> betas(log_size);
+        for (auto& beta : betas) {
+            beta = FF::random_element();
+        }
+        PowPolynomial<FF> pow_polynomial(betas);
+        pow_polynomial.compute_values();
+
+        BatchedRound batched_round(size);
+        SingleEdgeRound single_edge_round(size);
+        auto batched = batched_round.compute_univariate(polynomials, relation_parameters, pow_polynomial, alpha);
+        auto single_edge =
+            single_edge_round.compute_univariate(polynomials, relation_parameters, pow_polynomial, alpha);
+        EXPECT_EQ(batched, single_edge);
+    }
+}
+} // namespace
+
+TEST(SumcheckRound, BatchedEdgesMatchSingleEdges)
+{
+    check_batched_edges_match_single_edges<UltraFlavor>();
+}
+
+// The databus lookup relation has linearly dependent subrelations, which are accumulated without the pow scaling
+TEST(SumcheckRound, BatchedEdgesMatchSingleEdgesGoblin)
+{
+    check_batched_edges_match_single_edges<GoblinUltraFlavor>();
+}
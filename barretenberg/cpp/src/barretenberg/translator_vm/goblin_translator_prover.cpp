@@ -42,6 +42,9 @@ void GoblinTranslatorProver::compute_witness(CircuitBuilder& circuit_builder)
 
     // We construct concatenated versions of range constraint polynomials, where several polynomials are concatenated
     // into one. These polynomials are not commited to.
+    // TODO(#756): They only repeat the values of their groups, so they could be virtual views over the groups instead
+    // of copies. This needs ProverPolynomials to hold non-owning entities, since sumcheck, the permutation grand
+    // product and Zeromorph all read the concatenated polynomials through get_all() as plain Polynomials.
     bb::compute_concatenated_polynomials<Flavor>(key->polynomials);
 
     // We also contruct ordered polynomials, which have the same values as concatenated ones + enough values to bridge
@@ -155,6 +155,87 @@ TEST_F(GoblinTranslatorRelationCorrectnessTests, Permutation)
     check_relation<Flavor, std::tuple_element_t<0, Relations>>(full_circuit_size, prover_polynomials, params);
 }
 
+/**
+ * @brief Check that the (counting sort based) ordered range constraint polynomials match the ones obtained by
+ * comparison-sorting the concatenated values, as they were computed previously
+ *
+ */
+TEST_F(GoblinTranslatorRelationCorrectnessTests, OrderedRangeConstraintsMatchComparisonSort)
+{
+    using Flavor = GoblinTranslatorFlavor;
+    using FF = typename Flavor::FF;
+    using ProverPolynomials = typename Flavor::ProverPolynomials;
+    using Polynomial = bb::Polynomial<FF>;
+    auto& engine = numeric::get_debug_randomness();
+    const size_t mini_circuit_size = 2048;
+    const size_t full_circuit_size = mini_circuit_size * Flavor::CONCATENATION_GROUP_SIZE;
+    constexpr size_t max_value = (1 << Flavor::MICRO_LIMB_BITS) - 1;
+    constexpr size_t sorted_elements_count =
+        (max_value / Flavor::SORT_STEP) + 1 + (max_value % Flavor::SORT_STEP == 0 ? 0 : 1);
+
+    // Both uniformly random values and values concentrated at the ends of the range (so that the steps and the
+    // overflowing tails interleave with many equal values)
+    for (const bool skewed : { false, true }) {
+        ProverPolynomials prover_polynomials;
+        for (Polynomial& prover_poly : prover_polynomials.get_all()) {
+            prover_poly = Polynomial{ full_circuit_size };
+        }
+        auto concatenation_groups = prover_polynomials.get_concatenation_groups();
+        for (auto& group : concatenation_groups) {
+            for (auto& polynomial : group) {
+                for (size_t i = 0; i < mini_circuit_size; i++) {
+                    const size_t value = engine.get_random_uint16() & max_value;
+                    polynomial[i] = skewed ? (value % 4 == 0 ? max_value : value % 3) : value;
+                }
+            }
+        }
+
+        compute_goblin_translator_range_constraint_ordered_polynomials<Flavor>(prover_polynomials, mini_circuit_size);
+
+        // The steps 0, 3, 6, ..., max_value that each ordered polynomial contains once
+        std::vector<size_t> steps(sorted_elements_count);
+        steps[0] = max_value;
+        for (size_t i = 1; i < sorted_elements_count; i++) {
+            steps[i] = (sorted_elements_count - 1 - i) * Flavor::SORT_STEP;
+        }
+        const size_t free_space_before_runway = full_circuit_size - sorted_elements_count;
+        std::vector<size_t> expected_extra_denominator(full_circuit_size, 0);
+        size_t extra_denominator_offset = 0;
+        const auto ordered_polynomials = std::vector{ &prover_polynomials.ordered_range_constraints_0,
+                                                      &prover_polynomials.ordered_range_constraints_1,
+                                                      &prover_polynomials.ordered_range_constraints_2,
+                                                      &prover_polynomials.ordered_range_constraints_3 };
+        for (size_t i = 0; i < Flavor::NUM_CONCATENATED_WIRES; i++) {
+            std::vector<size_t> expected(full_circuit_size);
+            for (size_t j = 0; j < Flavor::CONCATENATION_GROUP_SIZE; j++) {
+                for (size_t k = 0; k < mini_circuit_size; k++) {
+                    const auto value = static_cast<size_t>(uint256_t(concatenation_groups[i][j][k]).data[0]);
+                    const size_t position = j * mini_circuit_size + k;
+                    if (position < free_space_before_runway) {
+                        expected[position] = value;
+                    } else {
+                        expected_extra_denominator[extra_denominator_offset++] = value;
+                    }
+                }
+            }
+            std::copy(
+                steps.begin(), steps.end(), expected.begin() + static_cast<std::ptrdiff_t>(free_space_before_runway));
+            std::sort(expected.begin(), expected.end());
+            for (size_t row = 0; row < full_circuit_size; row++) {
+                ASSERT_EQ((*ordered_polynomials[i])[row], FF(expected[row]));
+            }
+        }
+        std::copy(steps.begin(),
+                  steps.end(),
+                  expected_extra_denominator.begin() +
+                      static_cast<std::ptrdiff_t>(Flavor::NUM_CONCATENATED_WIRES * sorted_elements_count));
+        std::sort(expected_extra_denominator.begin(), expected_extra_denominator.end());
+        for (size_t row = 0; row < full_circuit_size; row++) {
+            ASSERT_EQ(prover_polynomials.ordered_range_constraints_4[row], FF(expected_extra_denominator[row]));
+        }
+    }
+}
+
 TEST_F(GoblinTranslatorRelationCorrectnessTests, DeltaRangeConstraint)
 {
     using Flavor = GoblinTranslatorFlavor;
@@ -96,6 +96,84 @@ TEST_F(GoblinUltraHonkComposerTests, BasicStructured)
     EXPECT_TRUE(verifier.verify_proof(proof));
 }
 
+/**
+ * @brief Test that overlapping the tasks of the Oink rounds, including the DataBus commitments and log derivative
+ * inverses, does not change the proof
+ *
+ */
+TEST_F(GoblinUltraHonkComposerTests, OverlappedRoundsMatchSequentialRounds)
+{
+    GoblinUltraCircuitBuilder builder;
+    GoblinMockCircuits::construct_simple_circuit(builder);
+
+    // Constructing an instance adds a random ECC op to the circuit, so the second instance takes a copy of the
+    // polynomials of the first
+    using Instance = ProverInstance_<GoblinUltraFlavor>;
+    GoblinUltraCircuitBuilder builder_copy = builder;
+    auto instance = std::make_shared<Instance>(builder);
+    auto instance_copy = std::make_shared<Instance>(builder_copy);
+    for (auto [poly, poly_copy] : zip_view(instance->proving_key.polynomials.get_unshifted(),
+                                           instance_copy->proving_key.polynomials.get_unshifted())) {
+        poly_copy = GoblinUltraFlavor::Polynomial(poly);
+    }
+    instance_copy->proving_key.polynomials.set_shifted();
+
+    auto construct_proof = [](const std::shared_ptr<Instance>& instance, bool overlap_rounds) {
+        GoblinUltraProver prover(instance);
+        prover.overlap_rounds = overlap_rounds;
+        auto proof = prover.construct_proof();
+
+        auto verification_key = std::make_shared<GoblinUltraFlavor::VerificationKey>(instance->proving_key);
+        GoblinUltraVerifier verifier(verification_key);
+        EXPECT_TRUE(verifier.verify_proof(proof));
+        return proof;
+    };
+
+    EXPECT_EQ(construct_proof(instance, /*overlap_rounds=*/true),
+              construct_proof(instance_copy, /*overlap_rounds=*/false));
+}
+
+/**
+ * @brief Test proof construction/verification for a structured execution trace whose block capacities are fitted to
+ * the block sizes observed for the circuit in a conventional trace
+ *
+ */
+TEST_F(GoblinUltraHonkComposerTests, BasicStructuredFitted)
+{
+    using Trace = ExecutionTrace_<GoblinUltraFlavor>;
+
+    TraceStructure trace_structure;
+    {
+        GoblinUltraCircuitBuilder builder;
+        GoblinMockCircuits::construct_simple_circuit(builder);
+        ProverInstance_<GoblinUltraFlavor> instance(builder);
+        std::vector<size_t> block_sizes;
+        for (auto [start, end] : instance.proving_key.active_block_ranges) {
+            block_sizes.emplace_back(end - start);
+        }
+        trace_structure.fit(block_sizes);
+    }
+
+    GoblinUltraCircuitBuilder builder;
+    GoblinMockCircuits::construct_simple_circuit(builder);
+    auto instance = std::make_shared<ProverInstance_<GoblinUltraFlavor>>(builder, trace_structure);
+    auto block_sizes = Trace::get_block_sizes(builder);
+    EXPECT_TRUE(trace_structure.fits(block_sizes));
+    // The structure was fitted to this very circuit, so every block it uses is exactly full
+    auto fill_ratios = trace_structure.fill_ratios(block_sizes);
+    ASSERT_EQ(fill_ratios.size(), block_sizes.size());
+    for (size_t i = 0; i < block_sizes.size(); ++i) {
+        EXPECT_EQ(fill_ratios[i], block_sizes[i] > 0 ? 1.0 : 0.0);
+    }
+    EXPECT_EQ(instance->proving_key.active_block_ranges.size(), block_sizes.size());
+
+    GoblinUltraProver prover(instance);
+    auto verification_key = std::make_shared<GoblinUltraFlavor::VerificationKey>(instance->proving_key);
+    GoblinUltraVerifier verifier(verification_key);
+    auto proof = prover.construct_proof();
+    EXPECT_TRUE(verifier.verify_proof(proof));
+}
+
 /**
  * @brief Test proof construction/verification for a circuit with ECC op gates, public inputs, and basic arithmetic
  * gates
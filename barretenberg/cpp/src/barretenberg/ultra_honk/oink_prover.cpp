@@ -20,10 +20,8 @@ template <IsUltraFlavor Flavor> OinkProverOutput<Flavor> OinkProver<Flavor>::pro
     execute_sorted_list_accumulator_round();
 
     // Fiat-Shamir: beta & gamma
-    execute_log_derivative_inverse_round();
-
-    // Compute grand product(s) and commitments.
-    execute_grand_product_computation_round();
+    // Compute log derivative inverse(s), grand product(s) and their commitments
+    execute_log_derivative_inverse_and_grand_product_computation_rounds();
 
     // Generate relation separators alphas for sumcheck/combiner computation
     RelationSeparator alphas = generate_alphas_round();
@@ -56,6 +54,46 @@ template <IsUltraFlavor Flavor> void OinkProver<Flavor>::execute_preamble_round(
     }
 }
 
+/**
+ * @brief Commit to a wire polynomial
+ * @details The wires vanish outside of the rows occupied by the blocks of the execution trace (which, for a structured
+ * trace, may be much less than the full circuit size), so the MSM is restricted to those rows when they are known.
+ */
+template <IsUltraFlavor Flavor>
+typename Flavor::Commitment OinkProver<Flavor>::commit_to_wire(CommitmentKey& key, std::span<const FF> wire)
+{
+    if (proving_key.active_block_ranges.empty()) {
+        return key.commit(wire);
+    }
+    return key.commit_structured(wire, proving_key.active_block_ranges);
+}
+
+/**
+ * @brief Add a task computing the commitment to a polynomial once the given tasks have completed
+ *
+ * @param is_wire whether the polynomial vanishes outside of the blocks of the execution trace, see commit_to_wire
+ */
+template <IsUltraFlavor Flavor>
+size_t OinkProver<Flavor>::add_commitment_task(TaskGraph& graph,
+                                               Commitment& commitment,
+                                               const typename Flavor::Polynomial& polynomial,
+                                               const std::vector<size_t>& dependencies,
+                                               bool is_wire)
+{
+    return graph.add(
+        [this, &graph, &commitment, &polynomial, is_wire] {
+            // The MSM runtime state is scratch space, so commitments computed concurrently need a key each
+            auto key = graph.runs_concurrently() ? commitment_key->fork(polynomial.size()) : commitment_key;
+            commitment = is_wire ? commit_to_wire(*key, polynomial) : key->commit(polynomial);
+        },
+        dependencies);
+}
+
+template <IsUltraFlavor Flavor> void OinkProver<Flavor>::run_stage(TaskGraph& graph)
+{
+    stage_stats.push_back(graph.run());
+}
+
 /**
  * @brief Commit to the wire polynomials (part of the witness), with the exception of the fourth wire, which is
  * only commited to after adding memory records. In the Goblin Flavor, we also commit to the ECC OP wires and the
@@ -63,11 +101,29 @@ template <IsUltraFlavor Flavor> void OinkProver<Flavor>::execute_preamble_round(
  */
 template <IsUltraFlavor Flavor> void OinkProver<Flavor>::execute_wire_commitments_round()
 {
+    TaskGraph graph(domain_separator + "wire_commitments", overlap_rounds);
     // Commit to the first three wire polynomials of the instance
     // We only commit to the fourth wire polynomial after adding memory recordss
-    witness_commitments.w_l = commitment_key->commit(proving_key.polynomials.w_l);
-    witness_commitments.w_r = commitment_key->commit(proving_key.polynomials.w_r);
-    witness_commitments.w_o = commitment_key->commit(proving_key.polynomials.w_o);
+    add_commitment_task(graph, witness_commitments.w_l, proving_key.polynomials.w_l, {}, /*is_wire=*/true);
+    add_commitment_task(graph, witness_commitments.w_r, proving_key.polynomials.w_r, {}, /*is_wire=*/true);
+    add_commitment_task(graph, witness_commitments.w_o, proving_key.polynomials.w_o, {}, /*is_wire=*/true);
+
+    if constexpr (IsGoblinFlavor<Flavor>) {
+        // Commit to Goblin ECC op wires
+        add_commitment_task(graph, witness_commitments.ecc_op_wire_1, proving_key.polynomials.ecc_op_wire_1);
+        add_commitment_task(graph, witness_commitments.ecc_op_wire_2, proving_key.polynomials.ecc_op_wire_2);
+        add_commitment_task(graph, witness_commitments.ecc_op_wire_3, proving_key.polynomials.ecc_op_wire_3);
+        add_commitment_task(graph, witness_commitments.ecc_op_wire_4, proving_key.polynomials.ecc_op_wire_4);
+
+        // Commit to DataBus columns and corresponding read counts
+        add_commitment_task(graph, witness_commitments.calldata, proving_key.polynomials.calldata);
+        add_commitment_task(
+            graph, witness_commitments.calldata_read_counts, proving_key.polynomials.calldata_read_counts);
+        add_commitment_task(graph, witness_commitments.return_data, proving_key.polynomials.return_data);
+        add_commitment_task(
+            graph, witness_commitments.return_data_read_counts, proving_key.polynomials.return_data_read_counts);
+    }
+    run_stage(graph);
 
     auto wire_comms = witness_commitments.get_wires();
     auto wire_labels = commitment_labels.get_wires();
@@ -76,27 +132,15 @@ template <IsUltraFlavor Flavor> void OinkProver<Flavor>::execute_wire_commitment
     }
 
     if constexpr (IsGoblinFlavor<Flavor>) {
-        // Commit to Goblin ECC op wires
-        witness_commitments.ecc_op_wire_1 = commitment_key->commit(proving_key.polynomials.ecc_op_wire_1);
-        witness_commitments.ecc_op_wire_2 = commitment_key->commit(proving_key.polynomials.ecc_op_wire_2);
-        witness_commitments.ecc_op_wire_3 = commitment_key->commit(proving_key.polynomials.ecc_op_wire_3);
-        witness_commitments.ecc_op_wire_4 = commitment_key->commit(proving_key.polynomials.ecc_op_wire_4);
-
         auto op_wire_comms = witness_commitments.get_ecc_op_wires();
         auto labels = commitment_labels.get_ecc_op_wires();
         for (size_t idx = 0; idx < Flavor::NUM_WIRES; ++idx) {
             transcript->send_to_verifier(domain_separator + labels[idx], op_wire_comms[idx]);
         }
 
-        // Commit to DataBus columns and corresponding read counts
-        witness_commitments.calldata = commitment_key->commit(proving_key.polynomials.calldata);
-        witness_commitments.calldata_read_counts = commitment_key->commit(proving_key.polynomials.calldata_read_counts);
         transcript->send_to_verifier(domain_separator + commitment_labels.calldata, witness_commitments.calldata);
         transcript->send_to_verifier(domain_separator + commitment_labels.calldata_read_counts,
                                      witness_commitments.calldata_read_counts);
-        witness_commitments.return_data = commitment_key->commit(proving_key.polynomials.return_data);
-        witness_commitments.return_data_read_counts =
-            commitment_key->commit(proving_key.polynomials.return_data_read_counts);
         transcript->send_to_verifier(domain_separator + commitment_labels.return_data, witness_commitments.return_data);
         transcript->send_to_verifier(domain_separator + commitment_labels.return_data_read_counts,
                                      witness_commitments.return_data_read_counts);
@@ -116,12 +160,21 @@ template <IsUltraFlavor Flavor> void OinkProver<Flavor>::execute_sorted_list_acc
     relation_parameters.eta_two = eta_two;
     relation_parameters.eta_three = eta_three;
 
-    proving_key.compute_sorted_accumulator_polynomials(
-        relation_parameters.eta, relation_parameters.eta_two, relation_parameters.eta_three);
-    // Commit to the sorted witness-table accumulator and the finalized (i.e. with memory records) fourth wire
-    // polynomial
-    witness_commitments.sorted_accum = commitment_key->commit(proving_key.polynomials.sorted_accum);
-    witness_commitments.w_4 = commitment_key->commit(proving_key.polynomials.w_4);
+    TaskGraph graph(domain_separator + "sorted_list_accumulator", overlap_rounds);
+    // Compute the sorted witness-table accumulator and finalize the fourth wire polynomial by adding memory records.
+    // These write to, and read from, disjoint polynomials, so each commitment only waits for its own computation.
+    const size_t sorted_accum = graph.add([&] {
+        proving_key.compute_sorted_list_accumulator(
+            relation_parameters.eta, relation_parameters.eta_two, relation_parameters.eta_three);
+    });
+    const size_t w_4 = graph.add([&] {
+        proving_key.add_plookup_memory_records_to_wire_4(
+            relation_parameters.eta, relation_parameters.eta_two, relation_parameters.eta_three);
+    });
+    add_commitment_task(
+        graph, witness_commitments.sorted_accum, proving_key.polynomials.sorted_accum, { sorted_accum });
+    add_commitment_task(graph, witness_commitments.w_4, proving_key.polynomials.w_4, { w_4 }, /*is_wire=*/true);
+    run_stage(graph);
 
     transcript->send_to_verifier(domain_separator + commitment_labels.sorted_accum, witness_commitments.sorted_accum);
     transcript->send_to_verifier(domain_separator + commitment_labels.w_4, witness_commitments.w_4);
@@ -132,16 +185,80 @@ template <IsUltraFlavor Flavor> void OinkProver<Flavor>::execute_sorted_list_acc
  *
  */
 template <IsUltraFlavor Flavor> void OinkProver<Flavor>::execute_log_derivative_inverse_round()
+{
+    draw_beta_and_gamma();
+    if constexpr (IsGoblinFlavor<Flavor>) {
+        TaskGraph graph(domain_separator + "log_derivative_inverse", overlap_rounds);
+        add_log_derivative_inverse_tasks(graph);
+        run_stage(graph);
+        send_log_derivative_inverse_commitments();
+    }
+}
+
+/**
+ * @brief Compute permutation and lookup grand product polynomials and their commitments
+ *
+ */
+template <IsUltraFlavor Flavor> void OinkProver<Flavor>::execute_grand_product_computation_round()
+{
+    TaskGraph graph(domain_separator + "grand_product_computation", overlap_rounds);
+    add_grand_product_computation_tasks(graph);
+    run_stage(graph);
+    send_grand_product_commitments();
+}
+
+/**
+ * @brief Execute the log derivative inverse and grand product computation rounds as a single stage
+ * @details Both rounds only depend on beta and gamma, so the commitments of each can overlap with the computations of
+ * the other. The transcript is the same as that of running the rounds one after the other.
+ */
+template <IsUltraFlavor Flavor>
+void OinkProver<Flavor>::execute_log_derivative_inverse_and_grand_product_computation_rounds()
+{
+    draw_beta_and_gamma();
+
+    TaskGraph graph(domain_separator + "log_derivative_inverse_and_grand_product_computation", overlap_rounds);
+    [[maybe_unused]] const size_t grand_products = add_grand_product_computation_tasks(graph);
+    if constexpr (IsGoblinFlavor<Flavor>) {
+        // The grand product and log derivative inverse computations both read entire rows of the polynomials, so
+        // neither may run while the other writes. Computing the inverses after the grand products lets them overlap
+        // with the commitments to z_perm and z_lookup.
+        add_log_derivative_inverse_tasks(graph, { grand_products });
+    }
+    run_stage(graph);
+
+    send_log_derivative_inverse_commitments();
+    send_grand_product_commitments();
+}
+
+template <IsUltraFlavor Flavor> void OinkProver<Flavor>::draw_beta_and_gamma()
 {
     auto [beta, gamma] = transcript->template get_challenges<FF>(domain_separator + "beta", domain_separator + "gamma");
     relation_parameters.beta = beta;
     relation_parameters.gamma = gamma;
+}
+
+/**
+ * @brief Add the tasks computing the DataBus log derivative inverses and their commitments, if required
+ */
+template <IsUltraFlavor Flavor>
+void OinkProver<Flavor>::add_log_derivative_inverse_tasks(TaskGraph& graph, const std::vector<size_t>& dependencies)
+{
     if constexpr (IsGoblinFlavor<Flavor>) {
-        // Compute and commit to the logderivative inverse used in DataBus
-        proving_key.compute_logderivative_inverse(relation_parameters);
+        const size_t inverses =
+            graph.add([&] { proving_key.compute_logderivative_inverse(relation_parameters); }, dependencies);
+        add_commitment_task(
+            graph, witness_commitments.calldata_inverses, proving_key.polynomials.calldata_inverses, { inverses });
+        add_commitment_task(graph,
+                            witness_commitments.return_data_inverses,
+                            proving_key.polynomials.return_data_inverses,
+                            { inverses });
+    }
+}
 
-        witness_commitments.calldata_inverses = commitment_key->commit(proving_key.polynomials.calldata_inverses);
-        witness_commitments.return_data_inverses = commitment_key->commit(proving_key.polynomials.return_data_inverses);
+template <IsUltraFlavor Flavor> void OinkProver<Flavor>::send_log_derivative_inverse_commitments()
+{
+    if constexpr (IsGoblinFlavor<Flavor>) {
         transcript->send_to_verifier(domain_separator + commitment_labels.calldata_inverses,
                                      witness_commitments.calldata_inverses);
         transcript->send_to_verifier(domain_separator + commitment_labels.return_data_inverses,
@@ -150,16 +267,21 @@ template <IsUltraFlavor Flavor> void OinkProver<Flavor>::execute_log_derivative_
 }
 
 /**
- * @brief Compute permutation and lookup grand product polynomials and their commitments
+ * @brief Add the tasks computing the grand product polynomials and their commitments
  *
+ * @return size_t the index of the task computing the grand products
  */
-template <IsUltraFlavor Flavor> void OinkProver<Flavor>::execute_grand_product_computation_round()
+template <IsUltraFlavor Flavor> size_t OinkProver<Flavor>::add_grand_product_computation_tasks(TaskGraph& graph)
 {
-    proving_key.compute_grand_product_polynomials(relation_parameters);
-
-    witness_commitments.z_perm = commitment_key->commit(proving_key.polynomials.z_perm);
-    witness_commitments.z_lookup = commitment_key->commit(proving_key.polynomials.z_lookup);
+    const size_t grand_products =
+        graph.add([&] { proving_key.compute_grand_product_polynomials(relation_parameters); });
+    add_commitment_task(graph, witness_commitments.z_perm, proving_key.polynomials.z_perm, { grand_products });
+    add_commitment_task(graph, witness_commitments.z_lookup, proving_key.polynomials.z_lookup, { grand_products });
+    return grand_products;
+}
 
+template <IsUltraFlavor Flavor> void OinkProver<Flavor>::send_grand_product_commitments()
+{
     transcript->send_to_verifier(domain_separator + commitment_labels.z_perm, witness_commitments.z_perm);
     transcript->send_to_verifier(domain_separator + commitment_labels.z_lookup, witness_commitments.z_lookup);
 }
@@ -19,6 +19,7 @@
 // clang-format on
 #include <utility>
 
+#include "barretenberg/common/task_graph.hpp"
 #include "barretenberg/stdlib_circuit_builders/goblin_ultra_flavor.hpp"
 #include "barretenberg/stdlib_circuit_builders/ultra_flavor.hpp"
 #include "barretenberg/transcript/transcript.hpp"
@@ -36,6 +37,11 @@ template <IsUltraFlavor Flavor> struct OinkProverOutput {
  * execute_sorted_list_accumulator_round(), execute_log_derivative_inverse_round(), and
  * execute_grand_product_computation_round().
  *
+ * Each round is run as a TaskGraph, so that its commitments (MSM bound) overlap with each other and with its witness
+ * computations (field op bound) once their inputs are ready. The commitments are sent to the transcript after the
+ * graph completes, in a fixed order, so the proof does not depend on the schedule. prove() runs the log derivative
+ * inverse and grand product rounds as a single stage, since both only depend on beta and gamma.
+ *
  * @tparam Flavor
  */
 template <IsUltraFlavor Flavor> class OinkProver {
@@ -55,6 +61,11 @@ template <IsUltraFlavor Flavor> class OinkProver {
 
     bb::RelationParameters<typename Flavor::FF> relation_parameters;
 
+    // If unset, the tasks of each round run one at a time
+    bool overlap_rounds = true;
+    // The overlap achieved by each stage run so far
+    std::vector<TaskGraph::Stats> stage_stats;
+
     OinkProver(ProvingKey& proving_key,
                const std::shared_ptr<typename Flavor::Transcript>& transcript,
                std::string domain_separator = "")
@@ -70,6 +81,24 @@ template <IsUltraFlavor Flavor> class OinkProver {
     void execute_sorted_list_accumulator_round();
     void execute_log_derivative_inverse_round();
     void execute_grand_product_computation_round();
+    void execute_log_derivative_inverse_and_grand_product_computation_rounds();
     RelationSeparator generate_alphas_round();
+
+  private:
+    using Commitment = typename Flavor::Commitment;
+
+    void draw_beta_and_gamma();
+    void add_log_derivative_inverse_tasks(TaskGraph& graph, const std::vector<size_t>& dependencies = {});
+    void send_log_derivative_inverse_commitments();
+    size_t add_grand_product_computation_tasks(TaskGraph& graph);
+    void send_grand_product_commitments();
+
+    size_t add_commitment_task(TaskGraph& graph,
+                               Commitment& commitment,
+                               const typename Flavor::Polynomial& polynomial,
+                               const std::vector<size_t>& dependencies = {},
+                               bool is_wire = false);
+    Commitment commit_to_wire(CommitmentKey& key, std::span<const FF> wire);
+    void run_stage(TaskGraph& graph);
 };
 } // namespace bb
\ No newline at end of file
@@ -109,6 +109,32 @@ TEST_F(UltraHonkComposerTests, StructuredTrace)
     EXPECT_TRUE(verifier.verify_proof(proof));
 }
 
+/**
+ * @brief Test that overlapping the tasks of the Oink rounds does not change the proof
+ *
+ */
+TEST_F(UltraHonkComposerTests, OverlappedRoundsMatchSequentialRounds)
+{
+    auto builder = UltraCircuitBuilder();
+    MockCircuits::add_arithmetic_gates_with_public_inputs(builder, /*num_gates=*/10);
+
+    auto construct_proof = [](UltraCircuitBuilder builder, bool overlap_rounds) {
+        auto instance = std::make_shared<ProverInstance>(builder);
+        UltraProver prover(instance);
+        prover.overlap_rounds = overlap_rounds;
+        auto proof = prover.construct_proof();
+        // The wire commitment, sorted list accumulator, and combined log derivative inverse and grand product stages
+        EXPECT_EQ(prover.stage_stats.size(), 3);
+
+        auto verification_key = std::make_shared<VerificationKey>(instance->proving_key);
+        UltraVerifier verifier(verification_key);
+        EXPECT_TRUE(verifier.verify_proof(proof));
+        return proof;
+    };
+
+    EXPECT_EQ(construct_proof(builder, /*overlap_rounds=*/true), construct_proof(builder, /*overlap_rounds=*/false));
+}
+
 /**
  * @brief Test simple circuit with public inputs
  *
@@ -124,6 +150,39 @@ TEST_F(UltraHonkComposerTests, PublicInputs)
     prove_and_verify(builder, /*expected_result=*/true);
 }
 
+/**
+ * @brief Test that a batch of proofs of different circuits verifies with a single pairing check, and that a single bad
+ * KZG opening makes the whole batch fail
+ *
+ */
+TEST_F(UltraHonkComposerTests, BatchVerify)
+{
+    constexpr size_t num_proofs = 3;
+    std::vector<HonkProof> proofs;
+    std::vector<std::shared_ptr<VerificationKey>> verification_keys;
+    for (size_t i = 0; i < num_proofs; ++i) {
+        auto builder = UltraCircuitBuilder();
+        MockCircuits::add_arithmetic_gates_with_public_inputs(builder, 10 << i);
+        auto instance = std::make_shared<ProverInstance>(builder);
+        UltraProver prover(instance);
+        verification_keys.emplace_back(std::make_shared<VerificationKey>(instance->proving_key));
+        proofs.emplace_back(prover.construct_proof());
+    }
+    EXPECT_TRUE(UltraVerifier::batch_verify(proofs, verification_keys));
+
+    // Replace the KZG opening of the last proof. Its transcript, Sumcheck and ZeroMorph rounds still go through, so
+    // only the batched pairing check can reject it
+    auto transcript = std::make_shared<UltraFlavor::Transcript>(proofs.back());
+    transcript->deserialize_full_transcript();
+    transcript->kzg_w_comm = UltraFlavor::Commitment::one() * fr::random_element();
+    transcript->serialize_full_transcript();
+    proofs.back() = transcript->proof_data;
+
+    UltraVerifier verifier(verification_keys.back());
+    EXPECT_TRUE(verifier.reduce_to_pairing_check(proofs.back()).has_value());
+    EXPECT_FALSE(UltraVerifier::batch_verify(proofs, verification_keys));
+}
+
 TEST_F(UltraHonkComposerTests, XorConstraint)
 {
     auto circuit_builder = UltraCircuitBuilder();
@@ -75,7 +75,9 @@ template <IsUltraFlavor Flavor> HonkProof& UltraProver_<Flavor>::export_proof()
 template <IsUltraFlavor Flavor> HonkProof& UltraProver_<Flavor>::construct_proof()
 {
     OinkProver<Flavor> oink_prover(instance->proving_key, transcript);
+    oink_prover.overlap_rounds = overlap_rounds;
     auto [proving_key, relation_params, alphas] = oink_prover.prove();
+    stage_stats = std::move(oink_prover.stage_stats);
     instance->proving_key = std::move(proving_key);
     instance->relation_parameters = std::move(relation_params);
     instance->alphas = alphas;
@@ -1,5 +1,6 @@
 #include "./ultra_verifier.hpp"
 #include "barretenberg/commitment_schemes/zeromorph/zeromorph.hpp"
+#include "barretenberg/common/task_graph.hpp"
 #include "barretenberg/numeric/bitop/get_msb.hpp"
 #include "barretenberg/transcript/transcript.hpp"
 #include "barretenberg/ultra_honk/oink_verifier.hpp"
@@ -40,6 +41,23 @@ template <typename Flavor> UltraVerifier_<Flavor>& UltraVerifier_<Flavor>::opera
  *
  */
 template <typename Flavor> bool UltraVerifier_<Flavor>::verify_proof(const HonkProof& proof)
+{
+    auto pairing_points = reduce_to_pairing_check(proof);
+    if (!pairing_points.has_value()) {
+        return false;
+    }
+    return key->pcs_verification_key->pairing_check(pairing_points.value()[0], pairing_points.value()[1]);
+}
+
+/**
+ * @brief Run every step of proof verification except the final pairing check
+ *
+ * @return The pairing points (P₀, P₁) for which e(P₀,[1]₂)⋅e(P₁,[x]₂) ≡ [1]ₜ must hold, or std::nullopt if Sumcheck
+ * already rejected the proof
+ */
+template <typename Flavor>
+std::optional<typename UltraVerifier_<Flavor>::PairingPoints> UltraVerifier_<Flavor>::reduce_to_pairing_check(
+    const HonkProof& proof)
 {
     using FF = typename Flavor::FF;
     using PCS = typename Flavor::PCS;
@@ -68,20 +86,61 @@ template <typename Flavor> bool UltraVerifier_<Flavor>::verify_proof(const HonkP
         sumcheck.verify(relation_parameters, alphas, gate_challenges);
 
     // If Sumcheck did not verify, return false
-    if (sumcheck_verified.has_value() && !sumcheck_verified.value()) {
-        return false;
+    if (!sumcheck_verified.has_value() || !sumcheck_verified.value()) {
+        return std::nullopt;
     }
 
     // Execute ZeroMorph rounds and check the pcs verifier accumulator returned. See
     // https://hackmd.io/dlf9xEwhTQyE3hiGbq4FsA?view for a complete description of the unrolled protocol.
-    auto pairing_points = ZeroMorph::verify(commitments.get_unshifted(),
-                                            commitments.get_to_be_shifted(),
-                                            claimed_evaluations.get_unshifted(),
-                                            claimed_evaluations.get_shifted(),
-                                            multivariate_challenge,
-                                            transcript);
-    auto pcs_verified = key->pcs_verification_key->pairing_check(pairing_points[0], pairing_points[1]);
-    return sumcheck_verified.value() && pcs_verified;
+    return ZeroMorph::verify(commitments.get_unshifted(),
+                             commitments.get_to_be_shifted(),
+                             claimed_evaluations.get_unshifted(),
+                             claimed_evaluations.get_shifted(),
+                             multivariate_challenge,
+                             transcript);
+}
+
+/**
+ * @brief Verify a batch of proofs, each against its own verification key, with a single pairing check
+ *
+ * @details The transcript, Sumcheck and ZeroMorph work of each proof is independent, and the proofs are reduced as
+ * concurrent tasks of a TaskGraph, each with a verifier (and hence a transcript) of its own. The resulting pairing
+ * points are then combined with random weights into one pairing check, see VerifierCommitmentKey::batch_pairing_check.
+ * All keys must share the same verifier SRS.
+ *
+ * @return true iff every proof verifies
+ */
+template <typename Flavor>
+bool UltraVerifier_<Flavor>::batch_verify(std::span<const HonkProof> proofs,
+                                          std::span<const std::shared_ptr<VerificationKey>> verification_keys)
+{
+    ASSERT(proofs.size() == verification_keys.size());
+    if (proofs.empty()) {
+        return true;
+    }
+
+    const auto& pcs_verification_key = verification_keys[0]->pcs_verification_key;
+    std::vector<std::optional<PairingPoints>> reduced(proofs.size());
+    TaskGraph graph("ultra_honk_batch_verify");
+    for (size_t i = 0; i < proofs.size(); ++i) {
+        ASSERT(verification_keys[i]->pcs_verification_key->srs->get_g2x() == pcs_verification_key->srs->get_g2x());
+        graph.add([&, i] {
+            UltraVerifier_ verifier{ verification_keys[i] };
+            reduced[i] = verifier.reduce_to_pairing_check(proofs[i]);
+        });
+    }
+    graph.run();
+
+    std::vector<PairingPoints> pairing_points;
+    pairing_points.reserve(proofs.size());
+    for (const auto& points : reduced) {
+        if (!points.has_value()) {
+            return false;
+        }
+        pairing_points.push_back(points.value());
+    }
+
+    return pcs_verification_key->batch_pairing_check(pairing_points);
 }
 
 template class UltraVerifier_<UltraFlavor>;
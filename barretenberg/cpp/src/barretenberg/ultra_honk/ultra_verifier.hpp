@@ -5,6 +5,9 @@
 #include "barretenberg/stdlib_circuit_builders/ultra_flavor.hpp"
 #include "barretenberg/sumcheck/sumcheck.hpp"
 
+#include <optional>
+#include <span>
+
 namespace bb {
 template <typename Flavor> class UltraVerifier_ {
     using FF = typename Flavor::FF;
@@ -12,6 +15,7 @@ template <typename Flavor> class UltraVerifier_ {
     using VerificationKey = typename Flavor::VerificationKey;
     using VerifierCommitmentKey = typename Flavor::VerifierCommitmentKey;
     using Transcript = typename Flavor::Transcript;
+    using PairingPoints = std::array<typename Flavor::GroupElement, 2>;
 
   public:
     explicit UltraVerifier_(const std::shared_ptr<Transcript>& transcript,
@@ -24,6 +28,10 @@ template <typename Flavor> class UltraVerifier_ {
     UltraVerifier_& operator=(UltraVerifier_&& other);
 
     bool verify_proof(const HonkProof& proof);
+    std::optional<PairingPoints> reduce_to_pairing_check(const HonkProof& proof);
+
+    static bool batch_verify(std::span<const HonkProof> proofs,
+                             std::span<const std::shared_ptr<VerificationKey>> verification_keys);
 
     std::shared_ptr<VerificationKey> key;
     std::shared_ptr<Transcript> transcript;
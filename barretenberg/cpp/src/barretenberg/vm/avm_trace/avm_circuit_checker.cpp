@@ -0,0 +1,304 @@
+#include "avm_circuit_checker.hpp"
+#include "avm_relation_gates.hpp"
+#include "barretenberg/common/constexpr_utils.hpp"
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
+#include "barretenberg/common/zip_view.hpp"
+#include "barretenberg/honk/proof_system/logderivative_library.hpp"
+#include "barretenberg/numeric/random/engine.hpp"
+
+#include <algorithm>
+#include <array>
+#include <numeric>
+#include <string_view>
+
+namespace bb::avm_trace {
+
+namespace {
+
+// The flavor lists its relations first, followed by its lookups and permutations (its grand product relations)
+using Relations = Flavor::Relations;
+using LookupRelations = Flavor::GrandProductRelations;
+constexpr size_t NUM_LOOKUPS = std::tuple_size_v<LookupRelations>;
+constexpr size_t NUM_RELATIONS = std::tuple_size_v<Relations> - NUM_LOOKUPS;
+
+// Names as used in the failure messages of AvmCircuitBuilder::check_circuit. They are keyed by relation type rather
+// than by position in the flavor, so a regenerated relation set cannot shift a name onto the wrong relation, and a
+// relation without a name fails the static_asserts below.
+template <typename Relation> constexpr std::string_view relation_name{};
+using RelationLabel = std::string (*)(int);
+template <typename Relation> constexpr RelationLabel relation_label = nullptr;
+template <> constexpr std::string_view relation_name<Avm_vm::avm_alu<FF>> = "avm_alu";
+template <> constexpr std::string_view relation_name<Avm_vm::avm_binary<FF>> = "avm_binary";
+template <> constexpr std::string_view relation_name<Avm_vm::avm_main<FF>> = "avm_main";
+template <> constexpr std::string_view relation_name<Avm_vm::avm_mem<FF>> = "avm_mem";
+template <> constexpr RelationLabel relation_label<Avm_vm::avm_alu<FF>> = Avm_vm::get_relation_label_avm_alu;
+template <> constexpr RelationLabel relation_label<Avm_vm::avm_binary<FF>> = Avm_vm::get_relation_label_avm_binary;
+template <> constexpr RelationLabel relation_label<Avm_vm::avm_main<FF>> = Avm_vm::get_relation_label_avm_main;
+template <> constexpr RelationLabel relation_label<Avm_vm::avm_mem<FF>> = Avm_vm::get_relation_label_avm_mem;
+template <> constexpr std::string_view relation_name<perm_main_alu_relation<FF>> = "PERM_MAIN_ALU";
+template <> constexpr std::string_view relation_name<perm_main_bin_relation<FF>> = "PERM_MAIN_BIN";
+template <> constexpr std::string_view relation_name<perm_main_mem_a_relation<FF>> = "PERM_MAIN_MEM_A";
+template <> constexpr std::string_view relation_name<perm_main_mem_b_relation<FF>> = "PERM_MAIN_MEM_B";
+template <> constexpr std::string_view relation_name<perm_main_mem_c_relation<FF>> = "PERM_MAIN_MEM_C";
+template <> constexpr std::string_view relation_name<perm_main_mem_d_relation<FF>> = "PERM_MAIN_MEM_D";
+template <> constexpr std::string_view relation_name<perm_main_mem_ind_a_relation<FF>> = "PERM_MAIN_MEM_IND_A";
+template <> constexpr std::string_view relation_name<perm_main_mem_ind_b_relation<FF>> = "PERM_MAIN_MEM_IND_B";
+template <> constexpr std::string_view relation_name<perm_main_mem_ind_c_relation<FF>> = "PERM_MAIN_MEM_IND_C";
+template <> constexpr std::string_view relation_name<perm_main_mem_ind_d_relation<FF>> = "PERM_MAIN_MEM_IND_D";
+template <> constexpr std::string_view relation_name<lookup_byte_lengths_relation<FF>> = "LOOKUP_BYTE_LENGTHS";
+template <> constexpr std::string_view relation_name<lookup_byte_operations_relation<FF>> = "LOOKUP_BYTE_OPERATIONS";
+template <> constexpr std::string_view relation_name<incl_main_tag_err_relation<FF>> = "INCL_MAIN_TAG_ERR";
+template <> constexpr std::string_view relation_name<incl_mem_tag_err_relation<FF>> = "INCL_MEM_TAG_ERR";
+template <> constexpr std::string_view relation_name<lookup_mem_rng_chk_lo_relation<FF>> = "LOOKUP_MEM_RNG_CHK_LO";
+template <> constexpr std::string_view relation_name<lookup_mem_rng_chk_hi_relation<FF>> = "LOOKUP_MEM_RNG_CHK_HI";
+template <> constexpr std::string_view relation_name<lookup_pow_2_0_relation<FF>> = "LOOKUP_POW_2_0";
+template <> constexpr std::string_view relation_name<lookup_pow_2_1_relation<FF>> = "LOOKUP_POW_2_1";
+template <> constexpr std::string_view relation_name<lookup_u8_0_relation<FF>> = "LOOKUP_U8_0";
+template <> constexpr std::string_view relation_name<lookup_u8_1_relation<FF>> = "LOOKUP_U8_1";
+template <> constexpr std::string_view relation_name<lookup_u16_0_relation<FF>> = "LOOKUP_U16_0";
+template <> constexpr std::string_view relation_name<lookup_u16_1_relation<FF>> = "LOOKUP_U16_1";
+template <> constexpr std::string_view relation_name<lookup_u16_2_relation<FF>> = "LOOKUP_U16_2";
+template <> constexpr std::string_view relation_name<lookup_u16_3_relation<FF>> = "LOOKUP_U16_3";
+template <> constexpr std::string_view relation_name<lookup_u16_4_relation<FF>> = "LOOKUP_U16_4";
+template <> constexpr std::string_view relation_name<lookup_u16_5_relation<FF>> = "LOOKUP_U16_5";
+template <> constexpr std::string_view relation_name<lookup_u16_6_relation<FF>> = "LOOKUP_U16_6";
+template <> constexpr std::string_view relation_name<lookup_u16_7_relation<FF>> = "LOOKUP_U16_7";
+template <> constexpr std::string_view relation_name<lookup_u16_8_relation<FF>> = "LOOKUP_U16_8";
+template <> constexpr std::string_view relation_name<lookup_u16_9_relation<FF>> = "LOOKUP_U16_9";
+template <> constexpr std::string_view relation_name<lookup_u16_10_relation<FF>> = "LOOKUP_U16_10";
+template <> constexpr std::string_view relation_name<lookup_u16_11_relation<FF>> = "LOOKUP_U16_11";
+template <> constexpr std::string_view relation_name<lookup_u16_12_relation<FF>> = "LOOKUP_U16_12";
+template <> constexpr std::string_view relation_name<lookup_u16_13_relation<FF>> = "LOOKUP_U16_13";
+template <> constexpr std::string_view relation_name<lookup_u16_14_relation<FF>> = "LOOKUP_U16_14";
+
+template <size_t... Is> constexpr bool lookups_are_listed_last(std::index_sequence<Is...> /*unused*/)
+{
+    return (std::is_same_v<std::tuple_element_t<NUM_RELATIONS + Is, Relations>,
+                           std::tuple_element_t<Is, LookupRelations>> &&
+            ...);
+}
+template <size_t... Is> constexpr bool relations_are_named(std::index_sequence<Is...> /*unused*/)
+{
+    return ((!relation_name<std::tuple_element_t<Is, Relations>>.empty() &&
+             (Is >= NUM_RELATIONS || relation_label<std::tuple_element_t<Is, Relations>> != nullptr)) &&
+            ...);
+}
+// Fail to compile, rather than misreport, if the generated flavor no longer lists its relations as expected
+static_assert(lookups_are_listed_last(std::make_index_sequence<NUM_LOOKUPS>{}));
+static_assert(relations_are_named(std::make_index_sequence<std::tuple_size_v<Relations>>{}));
+
+template <size_t Offset, size_t... Is>
+constexpr std::array<std::string_view, sizeof...(Is)> relation_names_from(std::index_sequence<Is...> /*unused*/)
+{
+    return { relation_name<std::tuple_element_t<Offset + Is, Relations>>... };
+}
+constexpr auto relation_names = relation_names_from<0>(std::make_index_sequence<NUM_RELATIONS>{});
+constexpr auto lookup_names = relation_names_from<NUM_RELATIONS>(std::make_index_sequence<NUM_LOOKUPS>{});
+template <size_t... Is>
+constexpr std::array<RelationLabel, sizeof...(Is)> relation_labels_from(std::index_sequence<Is...> /*unused*/)
+{
+    return { relation_label<std::tuple_element_t<Is, Relations>>... };
+}
+constexpr auto relation_labels = relation_labels_from(std::make_index_sequence<NUM_RELATIONS>{});
+
+} // namespace
+
+std::string AvmCircuitChecker::Failure::message() const
+{
+    if (!row.has_value()) {
+        return format("Lookup ", relation_name, " failed.");
+    }
+    return format("Relation ", relation_name, ", subrelation index ", subrelation_label, " failed at row ", *row);
+}
+
+bool AvmCircuitChecker::check(AvmCircuitBuilder& builder)
+{
+    const auto report = check_report(builder);
+    if (!report.passed()) {
+        throw_or_abort(report.failure->message());
+        return false;
+    }
+    return true;
+}
+
+AvmCircuitChecker::Report AvmCircuitChecker::check_report(AvmCircuitBuilder& builder, const Options& options)
+{
+    using Polynomial = Flavor::Polynomial;
+
+    const FF gamma = FF::random_element();
+    const FF beta = FF::random_element();
+    bb::RelationParameters<FF> params{
+        .eta = 0,
+        .beta = beta,
+        .gamma = gamma,
+        .public_input_delta = 0,
+        .lookup_grand_product_delta = 0,
+        .beta_sqr = 0,
+        .beta_cube = 0,
+        .eccvm_set_permutation_delta = 0,
+    };
+
+    auto polys = builder.compute_polynomials();
+    const size_t num_rows = polys.get_polynomial_size();
+
+    Report report;
+
+    std::vector<size_t> rows_to_check(num_rows);
+    std::iota(rows_to_check.begin(), rows_to_check.end(), 0);
+    if (options.num_sampled_rows != 0 && options.num_sampled_rows < num_rows) {
+        // Partial Fisher-Yates shuffle
+        auto& engine = numeric::get_randomness();
+        for (size_t i = 0; i < options.num_sampled_rows; ++i) {
+            const size_t j = i + static_cast<size_t>(engine.get_random_uint64() % (num_rows - i));
+            std::swap(rows_to_check[i], rows_to_check[j]);
+        }
+        rows_to_check.resize(options.num_sampled_rows);
+        std::sort(rows_to_check.begin(), rows_to_check.end());
+    }
+    report.num_rows_checked = rows_to_check.size();
+
+    // Rows are checked in increasing order within a thread, so the first failure of a relation in a thread is the
+    // first failure of that relation in the thread's range of rows
+    struct RelationFailure {
+        size_t row;
+        size_t subrelation;
+    };
+    const size_t num_threads = calculate_num_threads(rows_to_check.size());
+    const size_t rows_per_thread = (rows_to_check.size() + num_threads - 1) / num_threads;
+    std::vector<std::array<std::optional<RelationFailure>, NUM_RELATIONS>> failures(num_threads);
+    std::vector<size_t> num_skipped(num_threads, 0);
+    parallel_for(num_threads, [&](size_t thread_idx) {
+        const size_t start = thread_idx * rows_per_thread;
+        const size_t end = std::min(start + rows_per_thread, rows_to_check.size());
+        auto& thread_failures = failures[thread_idx];
+        for (size_t k = start; k < end; ++k) {
+            const size_t i = rows_to_check[k];
+            const auto row = polys.get_row(i);
+            bb::constexpr_for<0, NUM_RELATIONS, 1>([&]<size_t relation_idx>() {
+                using Relation = std::tuple_element_t<relation_idx, Relations>;
+                if (thread_failures[relation_idx].has_value()) {
+                    return;
+                }
+                if constexpr (isSkippable<Relation, decltype(row)>) {
+                    // Rows on which the relation's gating columns vanish cannot contribute
+                    if (Relation::skip(row)) {
+                        num_skipped[thread_idx]++;
+                        return;
+                    }
+                }
+                typename Relation::SumcheckArrayOfValuesOverSubrelations result;
+                for (auto& r : result) {
+                    r = 0;
+                }
+                Relation::accumulate(result, row, {}, 1);
+                for (size_t j = 0; j < result.size(); ++j) {
+                    if (result[j] != 0) {
+                        thread_failures[relation_idx] = RelationFailure{ i, j };
+                        break;
+                    }
+                }
+            });
+        }
+    });
+    report.num_skipped_evaluations = std::accumulate(num_skipped.begin(), num_skipped.end(), size_t(0));
+
+    for (size_t relation_idx = 0; relation_idx < NUM_RELATIONS; ++relation_idx) {
+        std::optional<RelationFailure> first_failure;
+        for (const auto& thread_failures : failures) {
+            const auto& failure = thread_failures[relation_idx];
+            if (failure.has_value() && (!first_failure.has_value() || failure->row < first_failure->row)) {
+                first_failure = failure;
+            }
+        }
+        if (first_failure.has_value()) {
+            Failure failure{
+                .relation_name = std::string(relation_names[relation_idx]),
+                .subrelation_label = relation_labels[relation_idx](static_cast<int>(first_failure->subrelation)),
+                .row = first_failure->row,
+                .row_values = {},
+            };
+            const auto row = polys.get_row(first_failure->row);
+            const auto labels = row.get_labels();
+            for (auto [label, value] : zip_view(labels, row.get_all())) {
+                if (!value.is_zero()) {
+                    failure.row_values.emplace_back(label, value);
+                }
+            }
+            report.failure = std::move(failure);
+            return report;
+        }
+    }
+
+    if (!options.check_lookups) {
+        return report;
+    }
+
+    std::array<Polynomial*, NUM_LOOKUPS> inverse_polynomials;
+    bb::constexpr_for<0, NUM_LOOKUPS, 1>([&]<size_t lookup_idx>() {
+        using LookupRelation = std::tuple_element_t<lookup_idx, LookupRelations>;
+        inverse_polynomials[lookup_idx] = &LookupRelation::get_inverse_polynomial(polys);
+    });
+
+    // Compute the denominators of all inverses in one pass over the rows...
+    run_loop_in_parallel(num_rows, [&](size_t start, size_t end) {
+        for (size_t i = start; i < end; ++i) {
+            const auto row = polys.get_row(i);
+            bb::constexpr_for<0, NUM_LOOKUPS, 1>([&]<size_t lookup_idx>() {
+                using LookupRelation = std::tuple_element_t<lookup_idx, LookupRelations>;
+                (*inverse_polynomials[lookup_idx])[i] =
+                    LookupRelation::operation_exists_at_row(row)
+                        ? compute_logderivative_inverse_denominator<FF, LookupRelation>(row, params)
+                        : FF(0);
+            });
+        }
+    });
+    // ...then invert each of them with a single batch inversion
+    parallel_for(NUM_LOOKUPS, [&](size_t lookup_idx) { FF::batch_invert(*inverse_polynomials[lookup_idx]); });
+
+    // Accumulate the log-derivative subrelations of every lookup, with one partial sum per thread
+    const size_t num_lookup_threads = calculate_num_threads(num_rows);
+    const size_t lookup_rows_per_thread = (num_rows + num_lookup_threads - 1) / num_lookup_threads;
+    std::vector<std::array<std::array<FF, 2>, NUM_LOOKUPS>> lookup_sums(num_lookup_threads);
+    parallel_for(num_lookup_threads, [&](size_t thread_idx) {
+        auto& sums = lookup_sums[thread_idx];
+        for (auto& sum : sums) {
+            sum = { 0, 0 };
+        }
+        const size_t start = thread_idx * lookup_rows_per_thread;
+        const size_t end = std::min(start + lookup_rows_per_thread, num_rows);
+        for (size_t i = start; i < end; ++i) {
+            const auto row = polys.get_row(i);
+            bb::constexpr_for<0, NUM_LOOKUPS, 1>([&]<size_t lookup_idx>() {
+                using LookupRelation = std::tuple_element_t<lookup_idx, LookupRelations>;
+                typename LookupRelation::SumcheckArrayOfValuesOverSubrelations result;
+                static_assert(result.size() == 2);
+                result = { 0, 0 };
+                LookupRelation::accumulate(result, row, params, 1);
+                sums[lookup_idx][0] += result[0];
+                sums[lookup_idx][1] += result[1];
+            });
+        }
+    });
+
+    for (size_t lookup_idx = 0; lookup_idx < NUM_LOOKUPS; ++lookup_idx) {
+        std::array<FF, 2> sum{ 0, 0 };
+        for (const auto& sums : lookup_sums) {
+            sum[0] += sums[lookup_idx][0];
+            sum[1] += sums[lookup_idx][1];
+        }
+        if (sum[0] != 0 || sum[1] != 0) {
+            report.failure = Failure{
+                .relation_name = std::string(lookup_names[lookup_idx]),
+                .subrelation_label = "",
+                .row = std::nullopt,
+                .row_values = {},
+            };
+            return report;
+        }
+    }
+
+    return report;
+}
+
+} // namespace bb::avm_trace
@@ -0,0 +1,64 @@
+#pragma once
+
+#include "avm_common.hpp"
+
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace bb::avm_trace {
+
+/**
+ * @brief Checks an AVM trace against all relations, lookups and permutations of the AVM flavor
+ *
+ * @details A faster alternative to the (generated) AvmCircuitBuilder::check_circuit, which also reports where the trace
+ * fails. Rows are split across the thread pool and every relation is evaluated on a row before moving on to the next
+ * one, so that each row is materialised once rather than once per relation. The inverses of all lookups and
+ * permutations are computed in a single pass over the rows, followed by one batch inversion per lookup.
+ */
+class AvmCircuitChecker {
+  public:
+    struct Options {
+        // If non-zero, the polynomial relations are only checked on this many randomly sampled rows. Lookups and
+        // permutations are sums over the whole trace, so they are either checked in full or not at all.
+        size_t num_sampled_rows = 0;
+        bool check_lookups = true;
+    };
+
+    /**
+     * @brief The first constraint violated by a trace. Relations are checked before lookups and permutations, each in
+     * the order in which they are listed in the flavor.
+     */
+    struct Failure {
+        std::string relation_name;
+        // Label of the failing subrelation, empty for a lookup or permutation
+        std::string subrelation_label;
+        // Unset for a lookup or permutation, whose log-derivative sum is over all rows
+        std::optional<size_t> row;
+        // Non-zero values of the failing row, by column name
+        std::vector<std::pair<std::string, FF>> row_values;
+
+        // The message with which AvmCircuitBuilder::check_circuit fails on the same constraint
+        std::string message() const;
+    };
+
+    struct Report {
+        std::optional<Failure> failure;
+        size_t num_rows_checked = 0;
+        // Number of (relation, row) pairs whose evaluation was skipped because the relation's gating columns vanish
+        size_t num_skipped_evaluations = 0;
+
+        bool passed() const { return !failure.has_value(); }
+    };
+
+    /**
+     * @brief Check the trace of the builder, failing (with throw_or_abort) as AvmCircuitBuilder::check_circuit does
+     */
+    static bool check(AvmCircuitBuilder& builder);
+
+    static Report check_report(AvmCircuitBuilder& builder) { return check_report(builder, Options{}); }
+    static Report check_report(AvmCircuitBuilder& builder, const Options& options);
+};
+
+} // namespace bb::avm_trace
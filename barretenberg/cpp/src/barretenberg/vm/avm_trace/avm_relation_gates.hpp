@@ -0,0 +1,165 @@
+#pragma once
+
+#include "barretenberg/relations/generated/avm/avm_alu.hpp"
+#include "barretenberg/relations/generated/avm/avm_binary.hpp"
+#include "barretenberg/relations/generated/avm/avm_main.hpp"
+#include "barretenberg/relations/generated/avm/avm_mem.hpp"
+#include "barretenberg/relations/relation_types.hpp"
+
+/**
+ * @file avm_relation_gates.hpp
+ * @brief Gating columns of the generated AVM relations
+ *
+ * @details Every subrelation of a gated relation vanishes identically when all of its gating columns are zero, which
+ * is the case on every row (or sumcheck edge) outside of the relation's sub-trace. Sumcheck and the AVM circuit checker
+ * then skip the relation there, through Relation::skip. The gates are declared here rather than in the generated
+ * relation headers, which codegen overwrites. Since a gate must be visible wherever an AVM relation is evaluated, the vm
+ * module force-includes this header in all of its translation units.
+ */
+namespace bb {
+
+template <typename... Entities> inline bool are_zero_on_edge(const Entities&... entities)
+{
+    return (is_zero_on_edge(entities) && ...);
+}
+
+template <typename FF> struct RelationGate<Avm_vm::avm_aluImpl<FF>> {
+    template <typename AllEntities> static bool skip(const AllEntities& in)
+    {
+        return are_zero_on_edge(in.avm_alu_alu_sel,
+                                in.avm_alu_a_hi,
+                                in.avm_alu_a_lo,
+                                in.avm_alu_cf,
+                                in.avm_alu_cmp_rng_ctr,
+                                in.avm_alu_cmp_sel,
+                                in.avm_alu_cmp_sel_shift,
+                                in.avm_alu_ff_tag,
+                                in.avm_alu_in_tag,
+                                in.avm_alu_op_add,
+                                in.avm_alu_op_add_shift,
+                                in.avm_alu_op_cast,
+                                in.avm_alu_op_cast_prev,
+                                in.avm_alu_op_cast_prev_shift,
+                                in.avm_alu_op_cast_shift,
+                                in.avm_alu_op_eq,
+                                in.avm_alu_op_lt,
+                                in.avm_alu_op_lte,
+                                in.avm_alu_op_mul,
+                                in.avm_alu_op_mul_shift,
+                                in.avm_alu_op_not,
+                                in.avm_alu_op_shl,
+                                in.avm_alu_op_shl_shift,
+                                in.avm_alu_op_shr,
+                                in.avm_alu_op_shr_shift,
+                                in.avm_alu_op_sub,
+                                in.avm_alu_op_sub_shift,
+                                in.avm_alu_p_a_borrow,
+                                in.avm_alu_p_b_borrow,
+                                in.avm_alu_rng_chk_lookup_selector_shift,
+                                in.avm_alu_rng_chk_sel,
+                                in.avm_alu_rng_chk_sel_shift,
+                                in.avm_alu_shift_lt_bit_len,
+                                in.avm_alu_shift_sel,
+                                in.avm_alu_t_sub_s_bits,
+                                in.avm_alu_u128_tag,
+                                in.avm_alu_u16_tag,
+                                in.avm_alu_u32_tag,
+                                in.avm_alu_u64_tag,
+                                in.avm_alu_u8_tag);
+    }
+};
+
+template <typename FF> struct RelationGate<Avm_vm::avm_binaryImpl<FF>> {
+    template <typename AllEntities> static bool skip(const AllEntities& in)
+    {
+        return are_zero_on_edge(in.avm_binary_bin_sel,
+                                in.avm_binary_acc_ia,
+                                in.avm_binary_acc_ib,
+                                in.avm_binary_acc_ic,
+                                in.avm_binary_mem_tag_ctr);
+    }
+};
+
+template <typename FF> struct RelationGate<Avm_vm::avm_mainImpl<FF>> {
+    template <typename AllEntities> static bool skip(const AllEntities& in)
+    {
+        return are_zero_on_edge(in.avm_main_mem_op_a,
+                                in.avm_main_alu_sel,
+                                in.avm_main_bin_op_id,
+                                in.avm_main_bin_sel,
+                                in.avm_main_id_zero,
+                                in.avm_main_ind_op_a,
+                                in.avm_main_ind_op_b,
+                                in.avm_main_ind_op_c,
+                                in.avm_main_ind_op_d,
+                                in.avm_main_internal_return_ptr,
+                                in.avm_main_internal_return_ptr_shift,
+                                in.avm_main_mem_op_b,
+                                in.avm_main_mem_op_c,
+                                in.avm_main_mem_op_d,
+                                in.avm_main_op_err,
+                                in.avm_main_rwa,
+                                in.avm_main_rwb,
+                                in.avm_main_rwc,
+                                in.avm_main_rwd,
+                                in.avm_main_sel_cmov,
+                                in.avm_main_sel_halt,
+                                in.avm_main_sel_internal_call,
+                                in.avm_main_sel_internal_return,
+                                in.avm_main_sel_jump,
+                                in.avm_main_sel_mov,
+                                in.avm_main_sel_mov_a,
+                                in.avm_main_sel_mov_b,
+                                in.avm_main_sel_op_add,
+                                in.avm_main_sel_op_and,
+                                in.avm_main_sel_op_cast,
+                                in.avm_main_sel_op_div,
+                                in.avm_main_sel_op_eq,
+                                in.avm_main_sel_op_fdiv,
+                                in.avm_main_sel_op_lt,
+                                in.avm_main_sel_op_lte,
+                                in.avm_main_sel_op_mul,
+                                in.avm_main_sel_op_not,
+                                in.avm_main_sel_op_or,
+                                in.avm_main_sel_op_shl,
+                                in.avm_main_sel_op_shr,
+                                in.avm_main_sel_op_sub,
+                                in.avm_main_sel_op_xor,
+                                in.avm_main_tag_err);
+    }
+};
+
+template <typename FF> struct RelationGate<Avm_vm::avm_memImpl<FF>> {
+    template <typename AllEntities> static bool skip(const AllEntities& in)
+    {
+        return are_zero_on_edge(in.avm_mem_mem_sel,
+                                in.avm_main_first,
+                                in.avm_mem_addr,
+                                in.avm_mem_addr_shift,
+                                in.avm_mem_clk,
+                                in.avm_mem_ind_op_a,
+                                in.avm_mem_ind_op_b,
+                                in.avm_mem_ind_op_c,
+                                in.avm_mem_ind_op_d,
+                                in.avm_mem_last,
+                                in.avm_mem_lastAccess,
+                                in.avm_mem_mem_sel_shift,
+                                in.avm_mem_one_min_inv,
+                                in.avm_mem_op_a,
+                                in.avm_mem_op_b,
+                                in.avm_mem_op_c,
+                                in.avm_mem_op_d,
+                                in.avm_mem_r_in_tag,
+                                in.avm_mem_rng_chk_sel,
+                                in.avm_mem_rw,
+                                in.avm_mem_skip_check_tag,
+                                in.avm_mem_tag,
+                                in.avm_mem_tag_err,
+                                in.avm_mem_tag_shift,
+                                in.avm_mem_tsp,
+                                in.avm_mem_val,
+                                in.avm_mem_val_shift);
+    }
+};
+
+} // namespace bb
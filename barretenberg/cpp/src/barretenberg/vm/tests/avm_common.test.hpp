@@ -1,5 +1,6 @@
 #pragma once
 
+#include "barretenberg/vm/avm_trace/avm_circuit_checker.hpp"
 #include "barretenberg/vm/avm_trace/avm_helper.hpp"
 #include "barretenberg/vm/generated/avm_composer.hpp"
 #include "barretenberg/vm/generated/avm_prover.hpp"
@@ -306,4 +306,52 @@ TEST_F(AvmMemoryTests, noErrorTagWriteViolation)
     EXPECT_THROW_WITH_MESSAGE(validate_trace_check_circuit(std::move(trace)), "NO_TAG_ERR_WRITE");
 }
 
+// Testing that the circuit check report locates the violated constraint and the values of the failing row
+TEST_F(AvmMemoryTests, checkCircuitReportLocatesViolation)
+{
+    trace_builder.op_set(0, 4, 0, AvmMemoryTag::U8);
+    trace_builder.op_set(0, 9, 1, AvmMemoryTag::U8);
+    trace_builder.op_sub(0, 1, 0, 2, AvmMemoryTag::U8);
+    trace_builder.halt();
+    auto trace = trace_builder.finalize();
+
+    // Find the row for the last memory access to address 1
+    auto row = std::ranges::find_if(trace.begin(), trace.end(), [](Row r) {
+        return r.avm_mem_addr == FF(1) && r.avm_mem_lastAccess == FF(1);
+    });
+    ASSERT_TRUE(row != trace.end());
+    const auto row_index = static_cast<size_t>(std::distance(trace.begin(), row));
+    row->avm_mem_lastAccess = FF(0);
+
+    auto circuit_builder = AvmCircuitBuilder();
+    circuit_builder.set_trace(std::move(trace));
+    const auto report = AvmCircuitChecker::check_report(circuit_builder);
+
+    ASSERT_FALSE(report.passed());
+    EXPECT_EQ(report.failure->relation_name, "avm_mem");
+    EXPECT_EQ(report.failure->subrelation_label, "MEM_LAST_ACCESS_DELIMITER");
+    EXPECT_EQ(report.failure->row, row_index);
+    EXPECT_TRUE(std::ranges::any_of(report.failure->row_values,
+                                    [](const auto& column) { return column.first == "avm_mem_addr"; }));
+    EXPECT_FALSE(std::ranges::any_of(report.failure->row_values,
+                                     [](const auto& column) { return column.first == "avm_mem_lastAccess"; }));
+}
+
+// Testing the sampled mode of the circuit check on a valid trace
+TEST_F(AvmMemoryTests, checkCircuitSampledRows)
+{
+    trace_builder.op_set(0, 4, 0, AvmMemoryTag::U8);
+    trace_builder.op_set(0, 9, 1, AvmMemoryTag::U8);
+    trace_builder.op_sub(0, 1, 0, 2, AvmMemoryTag::U8);
+    trace_builder.halt();
+
+    auto circuit_builder = AvmCircuitBuilder();
+    circuit_builder.set_trace(trace_builder.finalize());
+    const auto report =
+        AvmCircuitChecker::check_report(circuit_builder, { .num_sampled_rows = 100, .check_lookups = false });
+
+    EXPECT_TRUE(report.passed());
+    EXPECT_EQ(report.num_rows_checked, 100);
+}
+
 } // namespace tests_avm
@@ -0,0 +1,87 @@
+#include "avm_common.test.hpp"
+#include "barretenberg/vm/avm_trace/avm_relation_gates.hpp"
+
+namespace tests_avm {
+using namespace bb;
+
+namespace {
+
+/**
+ * @brief Check that a relation's skip condition is sound, i.e. that every subrelation vanishes whenever skip is true.
+ *
+ * @details Starting from an all-zero row, every column whose randomisation keeps the relation skippable (i.e. every
+ * column which is not gating the relation) is set to a random value. The relation must then evaluate to zero.
+ */
+template <typename Relation> void check_skip_is_sound()
+{
+    Flavor::AllValues values;
+    for (auto& value : values.get_all()) {
+        value = 0;
+    }
+    ASSERT_TRUE(Relation::skip(values));
+
+    size_t num_random_columns = 0;
+    for (auto& value : values.get_all()) {
+        value = FF::random_element();
+        if (Relation::skip(values)) {
+            num_random_columns++;
+        } else {
+            value = 0;
+        }
+    }
+    EXPECT_GT(num_random_columns, 0);
+
+    typename Relation::SumcheckArrayOfValuesOverSubrelations result;
+    for (auto& r : result) {
+        r = 0;
+    }
+    Relation::accumulate(result, values, {}, 1);
+    for (auto& r : result) {
+        EXPECT_EQ(r, 0);
+    }
+}
+
+} // namespace
+
+TEST(AvmRelationSkipTests, skipIsSound)
+{
+    check_skip_is_sound<Avm_vm::avm_alu<FF>>();
+    check_skip_is_sound<Avm_vm::avm_binary<FF>>();
+    check_skip_is_sound<Avm_vm::avm_main<FF>>();
+    check_skip_is_sound<Avm_vm::avm_mem<FF>>();
+}
+
+TEST(AvmRelationSkipTests, activeSubtraceIsNotSkipped)
+{
+    Flavor::AllValues values;
+    for (auto& value : values.get_all()) {
+        value = 0;
+    }
+    values.avm_alu_alu_sel = 1;
+    values.avm_binary_bin_sel = 1;
+    values.avm_main_mem_op_a = 1;
+    values.avm_mem_mem_sel = 1;
+
+    EXPECT_FALSE(Avm_vm::avm_alu<FF>::skip(values));
+    EXPECT_FALSE(Avm_vm::avm_binary<FF>::skip(values));
+    EXPECT_FALSE(Avm_vm::avm_main<FF>::skip(values));
+    EXPECT_FALSE(Avm_vm::avm_mem<FF>::skip(values));
+}
+
+// Gating columns are checked on both rows of a sumcheck edge
+TEST(AvmRelationSkipTests, skipOnEdge)
+{
+    using Edges = Flavor::ExtendedEdges;
+    Edges edges;
+    for (auto& edge : edges.get_all()) {
+        for (auto& evaluation : edge.evaluations) {
+            evaluation = 0;
+        }
+    }
+    EXPECT_TRUE(Avm_vm::avm_binary<FF>::skip(edges));
+
+    edges.avm_binary_bin_sel.value_at(1) = 1;
+    EXPECT_FALSE(Avm_vm::avm_binary<FF>::skip(edges));
+}
+
+} // namespace tests_avm
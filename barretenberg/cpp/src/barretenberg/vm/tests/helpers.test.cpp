@@ -22,7 +22,7 @@ void validate_trace(std::vector<Row>&& trace, bool with_proof)
 {
     auto circuit_builder = AvmCircuitBuilder();
     circuit_builder.set_trace(std::move(trace));
-    EXPECT_TRUE(circuit_builder.check_circuit());
+    EXPECT_TRUE(bb::avm_trace::AvmCircuitChecker::check(circuit_builder));
 
     if (with_proof) {
         auto composer = AvmComposer();